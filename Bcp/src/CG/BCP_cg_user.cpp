@@ -52,6 +52,8 @@ BCP_cg_user::send_cut(const BCP_cut& cut)
 {
   BCP_buffer& buf = p->msg_buf;
   buf.clear();
+  // tell the LP which solution the cut was generated for
+  buf.pack(p->node_index).pack(p->node_iteration);
   const int bcpind = cut.bcpind();
   const BCP_object_t obj_t = cut.obj_type();
   const BCP_obj_status stat = cut.status();
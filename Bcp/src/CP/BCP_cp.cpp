@@ -0,0 +1,273 @@
+// Copyright (C) 2000, International Business Machines
+// Corporation and others.  All Rights Reserved.
+
+#include <cstdlib>
+#include <algorithm>
+#include <utility>
+
+#include "BCP_math.hpp"
+#include "BCP_error.hpp"
+#include "BCP_message.hpp"
+#include "BCP_vector.hpp"
+#include "BCP_problem_core.hpp"
+#include "BCP_var.hpp"
+#include "BCP_cut.hpp"
+#include "BCP_USER.hpp"
+#include "BCP_cp.hpp"
+#include "BCP_cp_user.hpp"
+
+//#############################################################################
+
+BCP_cp_prob::BCP_cp_prob(int my_id, int parent) :
+    BCP_process(my_id, parent),
+    user(0), packer(0), msg_env(0), core(new BCP_problem_core),
+    upper_bound(BCP_DBL_MAX), check_round(0), sender(-1), phase(0),
+    node_level(0), node_index(0), node_iteration(0) {}
+
+
+BCP_cp_prob::~BCP_cp_prob()
+{
+   delete user;   user = 0;
+   delete packer; packer = 0;
+   delete core;   core = 0;
+   purge_ptr_vector(vars);
+   for (int i = cuts.size() - 1; i >= 0; --i) {
+      delete cuts[i]->cut;
+      delete cuts[i];
+   }
+   cuts.clear();
+}
+
+//#############################################################################
+
+BCP_var*
+BCP_cp_prob::unpack_var()
+{
+  BCP_object_t obj_t;
+  int bcpind;
+  BCP_var_t var_t;
+  double obj, lb, ub;
+  BCP_obj_status stat;
+  msg_buf.unpack(bcpind)
+         .unpack(obj_t).unpack(stat)
+         .unpack(var_t).unpack(obj).unpack(lb).unpack(ub);
+
+  BCP_var* var = 0;
+  switch (obj_t) {
+  case BCP_CoreObj:
+    var = new BCP_var_core(var_t, obj, lb, ub);
+    break;
+  case BCP_AlgoObj:
+    var = packer->unpack_var_algo(msg_buf);
+    var->set_var_type(var_t);
+    var->change_bounds(lb, ub);
+    var->set_obj(obj);
+    break;
+  default:
+    throw BCP_fatal_error("BCP_cp_prob::unpack_var(): unexpected obj_t.\n");
+  }
+  var->set_bcpind(bcpind);
+  var->set_status(stat);
+
+  return var;
+}
+
+//-----------------------------------------------------------------------------
+
+BCP_cut*
+BCP_cp_prob::unpack_cut()
+{
+  BCP_object_t obj_t;
+  int bcpind;
+  double lb, ub;
+  BCP_obj_status cutstat;
+  msg_buf.unpack(bcpind).unpack(obj_t).unpack(cutstat).unpack(lb).unpack(ub);
+
+  BCP_cut* cut = 0;
+  switch (obj_t) {
+  case BCP_CoreObj:
+    cut = new BCP_cut_core(lb, ub);
+    break;
+  case BCP_AlgoObj:
+    cut = packer->unpack_cut_algo(msg_buf);
+    cut->change_bounds(lb, ub);
+    break;
+  default:
+    throw BCP_fatal_error("BCP_cp_prob::unpack_cut(): unexpected obj_t.\n");
+  }
+  cut->set_bcpind(bcpind);
+  cut->set_status(cutstat);
+
+  return cut;
+}
+
+//-----------------------------------------------------------------------------
+
+void
+BCP_cp_prob::pack_cut(const BCP_cut& cut)
+{
+  const int bcpind = cut.bcpind();
+  msg_buf.pack(bcpind);
+  const BCP_object_t obj_t = cut.obj_type();
+  const BCP_obj_status cutstat = cut.status();
+  const double lb = cut.lb();
+  const double ub = cut.ub();
+  msg_buf.pack(obj_t).pack(cutstat).pack(lb).pack(ub);
+  switch (obj_t) {
+  case BCP_CoreObj:
+    break;
+  case BCP_AlgoObj:
+    packer->pack_cut_algo(&dynamic_cast<const BCP_cut_algo&>(cut), msg_buf);
+    break;
+  default:
+    throw BCP_fatal_error("BCP_cp_prob::pack_cut(): unexpected obj_t.\n");
+  }
+}
+
+//#############################################################################
+
+int
+BCP_cp_prob::unpack_cuts_to_pool()
+{
+   int cnt;
+   int level;
+   msg_buf.unpack(cnt).unpack(level);
+
+   int newcnt = 0;
+   cuts.reserve(cuts.size() + cnt);
+   while (--cnt >= 0) {
+      BCP_cut* cut = unpack_cut();
+      // A cut not yet known to the TM has a negative index in the LP, but
+      // its absolute value is already unique.
+      const int key = abs(cut->bcpind());
+      std::map<int, int>::iterator pos = cut_position.find(key);
+      if (pos == cut_position.end()) {
+	 cut_position[key] = cuts.size();
+	 cuts.unchecked_push_back(new BCP_cp_cut(cut, level, check_round));
+	 ++newcnt;
+      } else {
+	 // Already in the pool. Keep the smaller level and switch to the
+	 // (positive) index the TM knows about if that's available now.
+	 BCP_cp_cut* cpcut = cuts[pos->second];
+	 if (level < cpcut->level)
+	    cpcut->level = level;
+	 if (cut->bcpind() > 0)
+	    cpcut->cut->set_bcpind(cut->bcpind());
+	 delete cut;
+      }
+   }
+   return newcnt;
+}
+
+//#############################################################################
+
+int
+BCP_cp_prob::check_cuts()
+{
+   ++check_round;
+   const int cutnum = cuts.size();
+   if (cutnum == 0)
+      return 0;
+
+   // collect the cuts to be checked
+   const bool shallower_only =
+      par.entry(BCP_cp_par::CutPoolCheckOnlyShallowerCuts);
+   BCP_vec<int> pos;
+   BCP_vec<BCP_cut*> to_check;
+   pos.reserve(cutnum);
+   to_check.reserve(cutnum);
+   int i;
+   for (i = 0; i < cutnum; ++i) {
+      if (shallower_only && cuts[i]->level > node_level)
+	 continue;
+      pos.unchecked_push_back(i);
+      to_check.unchecked_push_back(cuts[i]->cut);
+   }
+   const int checknum = to_check.size();
+   if (checknum == 0)
+      return 0;
+
+   BCP_vec<double> violations(checknum, 0.0);
+   user->compute_violations(vars, x, to_check, violations);
+
+   // update the statistics and sort the violated cuts in decreasing order of
+   // their violation
+   const double tol = par.entry(BCP_cp_par::CutPoolViolationTolerance);
+   std::vector< std::pair<double, int> > violated;
+   for (i = 0; i < checknum; ++i) {
+      if (violations[i] > tol) {
+	 BCP_cp_cut* cpcut = cuts[pos[i]];
+	 ++cpcut->violated_count;
+	 cpcut->last_violated = check_round;
+	 violated.push_back(std::make_pair(-violations[i], pos[i]));
+      }
+   }
+   std::sort(violated.begin(), violated.end());
+
+   int sendnum = violated.size();
+   const int maxsend = par.entry(BCP_cp_par::CutPoolMaxCutsToSend);
+   if (maxsend > 0 && sendnum > maxsend)
+      sendnum = maxsend;
+   for (i = 0; i < sendnum; ++i) {
+      msg_buf.clear();
+      msg_buf.pack(node_index).pack(node_iteration);
+      pack_cut(*cuts[violated[i].second]->cut);
+      msg_env->send(sender, BCP_Msg_CutDescription, msg_buf);
+   }
+   return sendnum;
+}
+
+//#############################################################################
+
+static inline bool
+BCP_cp_cut_is_more_recent(const BCP_cp_cut* c0, const BCP_cp_cut* c1)
+{
+   if (c0->last_violated != c1->last_violated)
+      return c0->last_violated > c1->last_violated;
+   return c0->violated_count > c1->violated_count;
+}
+
+void
+BCP_cp_prob::purge_pool()
+{
+   const int oldsize = cuts.size();
+   const int max_age = par.entry(BCP_cp_par::CutPoolMaxAge);
+   const int max_size = par.entry(BCP_cp_par::CutPoolMaxSize);
+
+   // first get rid of the cuts that were not violated for too long
+   int i;
+   int kept = 0;
+   for (i = 0; i < oldsize; ++i) {
+      BCP_cp_cut* cpcut = cuts[i];
+      if (check_round - cpcut->last_violated > max_age) {
+	 delete cpcut->cut;
+	 delete cpcut;
+      } else {
+	 cuts[kept++] = cpcut;
+      }
+   }
+   cuts.erase(cuts.entry(kept), cuts.end());
+
+   // then, if the pool is still too big, keep the most recently violated
+   // ones
+   if (kept > max_size) {
+      std::sort(cuts.begin(), cuts.end(), BCP_cp_cut_is_more_recent);
+      for (i = max_size; i < kept; ++i) {
+	 delete cuts[i]->cut;
+	 delete cuts[i];
+      }
+      cuts.erase(cuts.entry(max_size), cuts.end());
+   }
+
+   const int newsize = cuts.size();
+   if (newsize == oldsize)
+      return;
+
+   cut_position.clear();
+   for (i = 0; i < newsize; ++i)
+      cut_position[abs(cuts[i]->cut->bcpind())] = i;
+
+   if (par.entry(BCP_cp_par::CpVerb_PoolPurge))
+      printf("CP:   %i cuts purged from the pool. Pool size: %i\n",
+	     oldsize - newsize, newsize);
+}
@@ -0,0 +1,176 @@
+// Copyright (C) 2000, International Business Machines
+// Corporation and others.  All Rights Reserved.
+#include <cstdio>
+#include <cerrno>
+#ifdef _MSC_VER
+#include <process.h>
+#endif
+
+#include "CoinTime.hpp"
+
+#include "BcpConfig.h"
+#include "BCP_os.hpp"
+
+#include "BCP_USER.hpp"
+#include "BCP_error.hpp"
+#include "BCP_buffer.hpp"
+#include "BCP_message.hpp"
+#include "BCP_problem_core.hpp"
+#include "BCP_main_fun.hpp"
+#include "BCP_cp_user.hpp"
+#include "BCP_cp.hpp"
+
+//#############################################################################
+
+BCP_process_t BCP_cp_main(BCP_message_environment* msg_env,
+			  USER_initialize* user_init,
+			  int my_id, int parent, double ub)
+{
+   BCP_cp_prob p(my_id, parent);
+   p.upper_bound = ub;
+   p.msg_env = msg_env;
+
+   // wait for the message with the parameters and unpack it
+   p.msg_buf.clear();
+   msg_env->receive(parent, BCP_Msg_ProcessParameters, p.msg_buf, -1);
+   p.par.unpack(p.msg_buf);
+
+   // Let us be nice
+   setpriority(PRIO_PROCESS, 0, p.par.entry(BCP_cp_par::NiceLevel));
+
+   FILE* logfile = 0;
+
+   const BCP_string& log = p.par.entry(BCP_cp_par::LogFileName);
+   if (! (p.par.entry(BCP_cp_par::LogFileName) == "")) {
+      int len = log.length();
+      char *logname = new char[len + 300];
+      memcpy(logname, log.c_str(), len);
+      memcpy(logname + len, "-cp-", 4);
+      len += 4;
+      gethostname(logname + len, 255);
+      len = strlen(logname);
+      logname[len++] = '-';
+      sprintf(logname + len, "%i", static_cast<int>(GETPID));
+      logfile = freopen(logname, "a", stdout);
+      if (logfile == 0) {
+	 fprintf(stderr, "Error while redirecting stdout: %i\n", errno);
+	 abort();
+      }
+      setvbuf(logfile, NULL, _IOLBF, 0); // make it line buffered
+      delete[] logname;
+   } else {
+      setvbuf(stdout, NULL, _IOLBF, 0); // make it line buffered
+   }
+
+   // now create the user universe
+   p.user = user_init->cp_init(p);
+   p.user->setCpProblemPointer(&p);
+   p.packer = user_init->packer_init(p.user);
+   p.packer->user_class = p.user;
+
+   // wait for the core description and process it
+   p.msg_buf.clear();
+   p.msg_env->receive(parent, BCP_Msg_CoreDescription, p.msg_buf, -1);
+   p.core->unpack(p.msg_buf);
+
+   // wait for the user info
+   p.msg_buf.clear();
+   msg_env->receive(parent, BCP_Msg_InitialUserInfo, p.msg_buf, -1);
+   p.user->unpack_module_data(p.msg_buf);
+
+   // ok, we're all geared up to store and check cuts
+   // wait for messages and process them...
+   BCP_message_tag msgtag;
+   BCP_process_t ptype = BCP_ProcessType_EndProcess;
+   while (true) {
+      p.msg_buf.clear();
+      msg_env->receive(BCP_AnyProcess, BCP_Msg_AnyMessage, p.msg_buf, 15);
+      msgtag = p.msg_buf.msgtag();
+      if (msgtag == BCP_Msg_NoMessage) {
+	 // test if the TM is still alive
+	 if (! p.msg_env->alive(parent))
+	    throw BCP_fatal_error("CP:   The TM has died -- CP exiting\n");
+      } else if (msgtag == BCP_Msg_ProcessType) {
+	  p.msg_buf.unpack(ptype);
+	  break;
+      } else {
+	 if (BCP_cp_process_message(p, p.msg_buf)) {
+	    // BCP_Msg_FinishedBCP arrived
+	    break;
+	 }
+      }
+   }
+   if (logfile)
+      fclose(logfile);
+
+   return ptype;
+}
+
+//#############################################################################
+
+bool
+BCP_cp_process_message(BCP_cp_prob& p, BCP_buffer& buf)
+{
+   p.process_message();
+   return (p.msg_buf.msgtag() == BCP_Msg_FinishedBCP);
+}
+
+void
+BCP_cp_prob::process_message()
+{
+   // Unlike a CG, the pool must answer every LP solution it receives: it is
+   // shared by several LP processes and each of them waits for a
+   // BCP_Msg_NoMoreCuts message for every solution it has sent.
+   int cnt;
+   double start;
+   double timing;
+   switch (msg_buf.msgtag()) {
+    case BCP_Msg_CutsToCutPool:
+      cnt = unpack_cuts_to_pool();
+      if (par.entry(BCP_cp_par::CpVerb_CutsReceivedAndSent))
+	 printf("CP:   %i new cuts from process %i. Pool size: %i\n",
+		cnt, msg_buf.sender(), static_cast<int>(cuts.size()));
+      if (static_cast<int>(cuts.size()) > par.entry(BCP_cp_par::CutPoolMaxSize))
+	 purge_pool();
+      break;
+
+    case BCP_Msg_ForCG_PrimalNonzeros:
+    case BCP_Msg_ForCG_PrimalFractions:
+    case BCP_Msg_ForCG_PrimalFull:
+    case BCP_Msg_ForCG_User:
+      start = CoinCpuTime();
+      msg_buf.unpack(node_level).unpack(node_index).unpack(node_iteration);
+      sender = msg_buf.sender();
+      user->unpack_primal_solution(msg_buf);
+      cnt = check_cuts();
+      if (par.entry(BCP_cp_par::CpVerb_CutsReceivedAndSent))
+	 printf("CP:   %i cuts sent to process %i (node %i, iteration %i)\n",
+		cnt, sender, node_index, node_iteration);
+      purge_pool();
+      // upon return send a no more cuts message
+      timing = CoinCpuTime() - start;
+      msg_buf.clear();
+      msg_buf.pack(node_index).pack(node_iteration).pack(timing);
+      msg_env->send(sender, BCP_Msg_NoMoreCuts, msg_buf);
+      break;
+
+    case BCP_Msg_UpperBound:
+      double new_ub;
+      msg_buf.unpack(new_ub);
+      if (new_ub < upper_bound)
+	 upper_bound = new_ub;
+      break;
+
+    case BCP_Msg_NextPhaseStarts:
+      phase++;
+      break;
+
+    case BCP_Msg_FinishedBCP:
+      return;
+
+    default:
+      // a bogus message
+      printf("Unknown message type arrived to CP: %i\n", msg_buf.msgtag());
+   }
+   msg_buf.clear();
+}
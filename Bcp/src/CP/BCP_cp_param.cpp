@@ -0,0 +1,98 @@
+// Copyright (C) 2000, International Business Machines
+// Corporation and others.  All Rights Reserved.
+#include "BCP_cp_param.hpp"
+#include "BCP_parameters.hpp"
+
+using std::make_pair;
+
+template <>
+void BCP_parameter_set<BCP_cp_par>::create_keyword_list() {
+   // Create the list of keywords for parameter file reading
+   //--------------------------------------------------------------------------
+   // CharPar
+   keys.push_back(make_pair(BCP_string("BCP_ReportWhenDefaultIsExecuted"),
+			    BCP_parameter(BCP_CharPar,
+					  ReportWhenDefaultIsExecuted)));
+   keys.push_back(make_pair(BCP_string("BCP_CutPoolCheckOnlyShallowerCuts"),
+			    BCP_parameter(BCP_CharPar,
+					  CutPoolCheckOnlyShallowerCuts)));
+   keys.push_back(make_pair(BCP_string("BCP_CpVerb_CutsReceivedAndSent"),
+			    BCP_parameter(BCP_CharPar,
+					  CpVerb_CutsReceivedAndSent)));
+   keys.push_back(make_pair(BCP_string("BCP_CpVerb_PoolPurge"),
+			    BCP_parameter(BCP_CharPar,
+					  CpVerb_PoolPurge)));
+//    keys.push_back(make_pair(BCP_string("BCP_"),
+// 			    BCP_parameter(BCP_CharPar,
+// 					  )));
+
+   //--------------------------------------------------------------------------
+   // IntPar
+   keys.push_back(make_pair(BCP_string("BCP_NiceLevel"),
+			    BCP_parameter(BCP_IntPar,
+					  NiceLevel)));
+   keys.push_back(make_pair(BCP_string("BCP_CutPoolMaxSize"),
+			    BCP_parameter(BCP_IntPar,
+					  CutPoolMaxSize)));
+   keys.push_back(make_pair(BCP_string("BCP_CutPoolMaxAge"),
+			    BCP_parameter(BCP_IntPar,
+					  CutPoolMaxAge)));
+   keys.push_back(make_pair(BCP_string("BCP_CutPoolMaxCutsToSend"),
+			    BCP_parameter(BCP_IntPar,
+					  CutPoolMaxCutsToSend)));
+//    keys.push_back(make_pair(BCP_string("BCP_"),
+// 			    BCP_parameter(BCP_IntPar,
+// 					  )));
+
+   //--------------------------------------------------------------------------
+   // DoublePar
+   keys.push_back(make_pair(BCP_string("BCP_CutPoolViolationTolerance"),
+			    BCP_parameter(BCP_DoublePar,
+					  CutPoolViolationTolerance)));
+//    keys.push_back(make_pair(BCP_string("BCP_"),
+// 			    BCP_parameter(BCP_DoublePar,
+// 					  )));
+
+   //--------------------------------------------------------------------------
+   // StringPar
+   keys.push_back(make_pair(BCP_string("BCP_LogFileName"),
+			    BCP_parameter(BCP_StringPar,
+					  LogFileName)));
+//    keys.push_back(make_pair(BCP_string("BCP_"),
+// 			    BCP_parameter(BCP_StringPar,
+// 					  )));
+
+   //--------------------------------------------------------------------------
+   // BoolArrayPar
+//    keys.push_back(make_pair(BCP_string("BCP_"),
+// 			    BCP_parameter(BCP_BoolArrayPar,
+// 					  Verbosity,
+// 					  )));
+}
+
+//#############################################################################
+
+template <>
+void BCP_parameter_set<BCP_cp_par>::set_default_entries(){
+   //--------------------------------------------------------------------------
+   // CharPar
+   set_entry(ReportWhenDefaultIsExecuted, true);
+   set_entry(MessagePassingIsSerial, false);
+   set_entry(CutPoolCheckOnlyShallowerCuts, false);
+   set_entry(CpVerb_CutsReceivedAndSent, false);
+   set_entry(CpVerb_PoolPurge, false);
+   //--------------------------------------------------------------------------
+   // IntPar
+   set_entry(NiceLevel, 0);
+   set_entry(CutPoolMaxSize, 10000);
+   set_entry(CutPoolMaxAge, 1000);
+   set_entry(CutPoolMaxCutsToSend, 0);
+   //--------------------------------------------------------------------------
+   // DoublePar
+   set_entry(CutPoolViolationTolerance, 1e-6);
+   //--------------------------------------------------------------------------
+   // StringPar
+   set_entry(LogFileName,"");
+   //--------------------------------------------------------------------------
+   // BoolArrayPar
+}
@@ -0,0 +1,100 @@
+// Copyright (C) 2000, International Business Machines
+// Corporation and others.  All Rights Reserved.
+
+#include "BCP_message_tag.hpp"
+#include "BCP_buffer.hpp"
+#include "BCP_error.hpp"
+#include "BCP_var.hpp"
+#include "BCP_cut.hpp"
+
+#include "BCP_cp.hpp"
+#include "BCP_cp_user.hpp"
+
+//#############################################################################
+// Informational methods for the user
+double BCP_cp_user::upper_bound() const    { return p->ub(); }
+int BCP_cp_user::current_phase() const     { return p->phase; }
+int BCP_cp_user::current_level() const     { return p->node_level; }
+int BCP_cp_user::current_index() const     { return p->node_index; }
+int BCP_cp_user::current_iteration() const { return p->node_iteration; }
+
+//#############################################################################
+// Informational methods for the user
+/* Methods to get/set BCP parameters on the fly */
+char
+BCP_cp_user::get_param(const BCP_cp_par::chr_params key) const
+{ return p->par.entry(key); }
+int
+BCP_cp_user::get_param(const BCP_cp_par::int_params key) const
+{ return p->par.entry(key); }
+double
+BCP_cp_user::get_param(const BCP_cp_par::dbl_params key) const
+{ return p->par.entry(key); }
+const BCP_string&
+BCP_cp_user::get_param(const BCP_cp_par::str_params key) const
+{ return p->par.entry(key); }
+
+void BCP_cp_user::set_param(const BCP_cp_par::chr_params key, const bool val)
+{ p->par.set_entry(key, val); }
+void BCP_cp_user::set_param(const BCP_cp_par::chr_params key, const char val)
+{ p->par.set_entry(key, val); }
+void BCP_cp_user::set_param(const BCP_cp_par::int_params key, const int val)
+{ p->par.set_entry(key, val); }
+void BCP_cp_user::set_param(const BCP_cp_par::dbl_params key, const double val)
+{ p->par.set_entry(key, val); }
+void BCP_cp_user::set_param(const BCP_cp_par::str_params key, const char * val)
+{ p->par.set_entry(key, val); }
+
+//#############################################################################
+
+void
+BCP_cp_user::unpack_module_data(BCP_buffer& buf)
+{
+  if (p->par.entry(BCP_cp_par::ReportWhenDefaultIsExecuted)) {
+    printf(" CP: Default unpack_module_data() executed.\n");
+  }
+}
+
+//#############################################################################
+
+void
+BCP_cp_user::unpack_primal_solution(BCP_buffer& buf)
+{
+  if (p->par.entry(BCP_cp_par::ReportWhenDefaultIsExecuted)) {
+    printf(" CP: Default unpack_primal_solution() executed.\n");
+  }
+
+   if (buf.msgtag() == BCP_Msg_ForCG_User) {
+      throw BCP_fatal_error("\
+CP: BCP_Msg_LpSolution_User message arrived but the unpack_primal_solution()\n\
+    function is not overridden.\n");
+   } else {
+      purge_ptr_vector(p->vars);
+      p->x.clear();
+      int varnum;
+      buf.unpack(varnum);
+      if (varnum > 0) {
+	 p->vars.reserve(varnum);
+	 p->x.reserve(varnum);
+	 double val;
+	 while (--varnum >= 0) {
+	    buf.unpack(val);
+	    p->x.unchecked_push_back(val);
+	    p->vars.unchecked_push_back(p->unpack_var());
+	 }
+      }
+   }
+}
+
+//#############################################################################
+
+void
+BCP_cp_user::compute_violations(const BCP_vec<BCP_var*>& vars,
+				const BCP_vec<double>& x,
+				const BCP_vec<BCP_cut*>& cuts,
+				BCP_vec<double>& violations)
+{
+  throw BCP_fatal_error("\
+CP: A Cut Pool process is used but BCP_cp_user::compute_violations()\n\
+    is not overridden.\n");
+}
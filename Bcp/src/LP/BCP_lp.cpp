@@ -17,43 +17,248 @@
 
 //#############################################################################
 
+int
+BCP_time_histogram::num() const
+{
+  int n = 0;
+  for (int i = 0; i < BinNum; ++i)
+    n += count[i];
+  return n;
+}
+void
+BCP_time_histogram::record(const double t)
+{
+  int bin = 0;
+  for (double limit = 1e-3; bin < BinNum - 1 && t >= limit; limit *= 2)
+    ++bin;
+  ++count[bin];
+  total += t;
+  if (t > longest)
+    longest = t;
+}
+void
+BCP_time_histogram::pack(BCP_buffer& buf) const
+{
+  for (int i = 0; i < BinNum; ++i)
+    buf.pack(count[i]);
+  buf.pack(total).pack(longest);
+}
+void
+BCP_time_histogram::unpack(BCP_buffer& buf)
+{
+  for (int i = 0; i < BinNum; ++i)
+    buf.unpack(count[i]);
+  buf.unpack(total).unpack(longest);
+}
+void
+BCP_time_histogram::display(const char* title) const
+{
+  const int n = num();
+  if (n == 0)
+    return;
+  printf("   %s: %i entries, average %.6f sec, longest %.6f sec\n",
+	 title, n, total / n, longest);
+  double limit = 1e-3;
+  for (int i = 0; i < BinNum; ++i, limit *= 2) {
+    if (count[i] == 0)
+      continue;
+    if (i == BinNum - 1) {
+      printf("      >= %10.3f sec : %i\n", limit / 2, count[i]);
+    } else {
+      printf("      <  %10.3f sec : %i\n", limit, count[i]);
+    }
+  }
+}
+void
+BCP_time_histogram::add(const BCP_time_histogram& hist)
+{
+  for (int i = 0; i < BinNum; ++i)
+    count[i] += hist.count[i];
+  total += hist.total;
+  if (hist.longest > longest)
+    longest = hist.longest;
+}
+
+//#############################################################################
+
 void
 BCP_lp_statistics::pack(BCP_buffer& buf)
 {
-   buf.pack(time_cut_generation)
+   buf.pack(time_feas_testing)
+      .pack(time_cut_generation)
       .pack(time_var_generation)
       .pack(time_heuristics)
       .pack(time_lp_solving)
-      .pack(time_branching);
+      .pack(time_branching)
+      .pack(time_node_setup)
+      .pack(nodes_set_up)
+      .pack(nodes_reused_lp)
+      .pack(sb_cache_lookups)
+      .pack(sb_cache_hits)
+      .pack(lp_iterations)
+      .pack(time_lp_modification)
+      .pack(time_pool_checks)
+      .pack(time_msg_packing)
+      .pack(time_msg_unpacking)
+      .pack(time_waiting_cg)
+      .pack(time_waiting_vg)
+      .pack(time_waiting_tm);
+   node_time.pack(buf);
+   lp_solve_time.pack(buf);
+   sb_candidate_time.pack(buf);
+   buf.pack(heur_calls)
+      .pack(heur_successes)
+      .pack(heur_skipped_frequency)
+      .pack(heur_skipped_depth)
+      .pack(heur_skipped_gap)
+      .pack(heur_skipped_time)
+      .pack(heur_skipped_adaptive)
+      .pack(heur_calls_by_depth)
+      .pack(heur_successes_by_depth)
+      .pack(heur_chances_by_depth);
+   heur_time.pack(buf);
 }
 void
 BCP_lp_statistics::unpack(BCP_buffer& buf)
 {
-   buf.unpack(time_cut_generation)
+   buf.unpack(time_feas_testing)
+      .unpack(time_cut_generation)
       .unpack(time_var_generation)
       .unpack(time_heuristics)
       .unpack(time_lp_solving)
-      .unpack(time_branching);
+      .unpack(time_branching)
+      .unpack(time_node_setup)
+      .unpack(nodes_set_up)
+      .unpack(nodes_reused_lp)
+      .unpack(sb_cache_lookups)
+      .unpack(sb_cache_hits)
+      .unpack(lp_iterations)
+      .unpack(time_lp_modification)
+      .unpack(time_pool_checks)
+      .unpack(time_msg_packing)
+      .unpack(time_msg_unpacking)
+      .unpack(time_waiting_cg)
+      .unpack(time_waiting_vg)
+      .unpack(time_waiting_tm);
+   node_time.unpack(buf);
+   lp_solve_time.unpack(buf);
+   sb_candidate_time.unpack(buf);
+   buf.unpack(heur_calls)
+      .unpack(heur_successes)
+      .unpack(heur_skipped_frequency)
+      .unpack(heur_skipped_depth)
+      .unpack(heur_skipped_gap)
+      .unpack(heur_skipped_time)
+      .unpack(heur_skipped_adaptive)
+      .unpack(heur_calls_by_depth)
+      .unpack(heur_successes_by_depth)
+      .unpack(heur_chances_by_depth);
+   heur_time.unpack(buf);
 }
 void
 BCP_lp_statistics::display() const
 {
   printf("LP statistics:\n");
+  printf("   time in feasibility test: %12.3f sec\n", time_feas_testing);
   printf("   time in cut generation  : %12.3f sec\n", time_cut_generation);
   printf("   time in var generation  : %12.3f sec\n", time_var_generation);
   printf("   time in heuristics      : %12.3f sec\n", time_heuristics);
   printf("   time in solving LPs     : %12.3f sec\n", time_lp_solving);
+  printf("   LP iterations           : %12i\n", lp_iterations);
   printf("   time in strong branching: %12.3f sec\n", time_branching);
+  printf("   time in node setup      : %12.3f sec\n", time_node_setup);
+  if (nodes_set_up > 0) {
+    printf("   nodes set up            : %12i (%i by reusing the LP)\n",
+	   nodes_set_up, nodes_reused_lp);
+    printf("   node setup time per node: %12.6f sec\n",
+	   time_node_setup / nodes_set_up);
+  }
+  if (sb_cache_lookups > 0) {
+    printf("   strong branching cache  : %i hits / %i lookups (%.1f%%)\n",
+	   sb_cache_hits, sb_cache_lookups,
+	   (100.0 * sb_cache_hits) / sb_cache_lookups);
+  }
+  printf("   time in LP modification : %12.3f sec\n", time_lp_modification);
+  printf("   time in pool checks     : %12.3f sec\n", time_pool_checks);
+  printf("   time in packing msgs    : %12.3f sec\n", time_msg_packing);
+  printf("   time in unpacking msgs  : %12.3f sec\n", time_msg_unpacking);
+  printf("   time waiting for CG/CP  : %12.3f sec\n", time_waiting_cg);
+  printf("   time waiting for VG/VP  : %12.3f sec\n", time_waiting_vg);
+  printf("   time waiting for TM     : %12.3f sec\n", time_waiting_tm);
+  node_time.display("node processing time");
+  lp_solve_time.display("LP solve time");
+  sb_candidate_time.display("strong branching time per candidate");
+  const int skipped = heur_skipped_frequency + heur_skipped_depth +
+    heur_skipped_gap + heur_skipped_time + heur_skipped_adaptive;
+  if (heur_calls + skipped > 0) {
+    printf("   heuristic calls         : %12i (%i improved the UB)\n",
+	   heur_calls, heur_successes);
+    printf("   heuristic calls skipped : %12i (frequency %i, depth %i,\n",
+	   skipped, heur_skipped_frequency, heur_skipped_depth);
+    printf("                              gap %i, time %i, adaptive %i)\n",
+	   heur_skipped_gap, heur_skipped_time, heur_skipped_adaptive);
+    printf("   heuristic per depth     : opportunities / calls / successes\n");
+    const int depth_num = heur_chances_by_depth.size();
+    for (int d = 0; d < depth_num; ++d) {
+      if (heur_chances_by_depth[d] == 0)
+	continue;
+      printf("      %4i: %8i / %8i / %8i\n", d, heur_chances_by_depth[d],
+	     heur_calls_by_depth[d], heur_successes_by_depth[d]);
+    }
+    heur_time.display("heuristic time");
+  }
   printf("\n");
 }
 void
+BCP_lp_statistics::heur_extend_to_depth(const int depth)
+{
+  while (static_cast<int>(heur_chances_by_depth.size()) <= depth) {
+    heur_calls_by_depth.push_back(0);
+    heur_successes_by_depth.push_back(0);
+    heur_chances_by_depth.push_back(0);
+  }
+}
+void
 BCP_lp_statistics::add(const BCP_lp_statistics& stat)
 {
+  time_feas_testing   += stat.time_feas_testing  ;
   time_cut_generation += stat.time_cut_generation;
   time_var_generation += stat.time_var_generation;
   time_heuristics     += stat.time_heuristics    ;
   time_lp_solving     += stat.time_lp_solving    ;
   time_branching      += stat.time_branching     ;
+  time_node_setup     += stat.time_node_setup    ;
+  nodes_set_up        += stat.nodes_set_up       ;
+  nodes_reused_lp     += stat.nodes_reused_lp    ;
+  sb_cache_lookups    += stat.sb_cache_lookups   ;
+  sb_cache_hits       += stat.sb_cache_hits      ;
+  lp_iterations       += stat.lp_iterations      ;
+  time_lp_modification += stat.time_lp_modification;
+  time_pool_checks    += stat.time_pool_checks   ;
+  time_msg_packing    += stat.time_msg_packing   ;
+  time_msg_unpacking  += stat.time_msg_unpacking ;
+  time_waiting_cg     += stat.time_waiting_cg    ;
+  time_waiting_vg     += stat.time_waiting_vg    ;
+  time_waiting_tm     += stat.time_waiting_tm    ;
+  node_time.add(stat.node_time);
+  lp_solve_time.add(stat.lp_solve_time);
+  sb_candidate_time.add(stat.sb_candidate_time);
+  heur_calls          += stat.heur_calls         ;
+  heur_successes      += stat.heur_successes     ;
+  heur_skipped_frequency += stat.heur_skipped_frequency;
+  heur_skipped_depth  += stat.heur_skipped_depth ;
+  heur_skipped_gap    += stat.heur_skipped_gap   ;
+  heur_skipped_time   += stat.heur_skipped_time  ;
+  heur_skipped_adaptive += stat.heur_skipped_adaptive;
+  const int depth_num = stat.heur_chances_by_depth.size();
+  if (depth_num > 0)
+    heur_extend_to_depth(depth_num - 1);
+  for (int d = 0; d < depth_num; ++d) {
+    heur_calls_by_depth[d] += stat.heur_calls_by_depth[d];
+    heur_successes_by_depth[d] += stat.heur_successes_by_depth[d];
+    heur_chances_by_depth[d] += stat.heur_chances_by_depth[d];
+  }
+  heur_time.add(stat.heur_time);
 }
 
 //#############################################################################
@@ -63,6 +268,7 @@ BCP_lp_prob::BCP_lp_prob(int my_id, int parent) :
    user(0),
    master_lp(0),
    lp_solver(0),
+   resident_lp(0),
    msg_env(0),
    core(new BCP_problem_core),
    core_as_change(new BCP_problem_core_change),
@@ -87,6 +293,7 @@ BCP_lp_prob::~BCP_lp_prob() {
    delete packer;
    delete master_lp;
    delete lp_solver;
+   delete resident_lp;
 
    delete core;
    delete core_as_change;
@@ -96,7 +303,6 @@ BCP_lp_prob::~BCP_lp_prob() {
    delete warmstartRoot;
 
    delete lp_result;
-   purge_ptr_vector(slack_pool);
 
    delete local_var_pool;
    delete local_cut_pool;
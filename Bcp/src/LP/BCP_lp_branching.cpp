@@ -3,8 +3,14 @@
 //#include <cfloat>
 #include <cstdio>
 #include <numeric>
+#include <algorithm>
 #include <utility> // for pair<>
 
+#include "BcpConfig.h"
+#ifdef HAVE_PTHREAD_H
+#include <pthread.h>
+#endif
+
 #include "CoinWarmStart.hpp"
 #include "CoinTime.hpp"
 
@@ -127,6 +133,8 @@ BCP_add_branching_objects(BCP_lp_prob& p,
 	p.user->vars_to_cols(cuts, new_vars, cols,
 			     *p.lp_result, BCP_Object_Branching, false);
 	BCP_lp_add_cols_to_lp(cols, lp);
+	p.propagator.reset();
+	p.slack_pool.delete_rows();
 	purge_ptr_vector(cols);
 
 	for (int i = 0; i < newvar_num; ++i) {
@@ -156,6 +164,7 @@ BCP_add_branching_objects(BCP_lp_prob& p,
 	}
 	BCP_fatal_error::abort_on_error = true;
 	BCP_lp_add_rows_to_lp(rows, lp);
+	p.propagator.reset();
 	purge_ptr_vector(rows);
 
 	for (int i = 0; i < newcut_num; ++i) {
@@ -243,6 +252,391 @@ BCP_mark_result_of_strong_branching(BCP_lp_prob& p,
 
 //#############################################################################
 
+/** If the candidate branches on a single variable (that was already in the
+    formulation when the LP was solved) then return its position, otherwise
+    return -1. */
+static inline int
+BCP_lp_single_var_pos(const BCP_lp_branching_object* can,
+		      const int orig_colnum)
+{
+    if (! can->forced_var_pos || can->forced_var_pos->size() != 1 ||
+	can->cuts_affected() > 0) {
+	return -1;
+    }
+    const int pos = (*can->forced_var_pos)[0];
+    return pos < orig_colnum ? pos : -1;
+}
+
+//-----------------------------------------------------------------------------
+
+/** If the candidate branches on a single variable (that was already in the
+    formulation when the LP was solved) then return its position and fill
+    out in which direction and how far the variable is moved in the
+    <code>child</code>-th child. Otherwise return -1. */
+int
+BCP_lp_single_var_branch(const BCP_lp_prob& p,
+			 const BCP_lp_branching_object* can,
+			 const int orig_colnum, const int child,
+			 bool& up, double& change)
+{
+    const int pos = BCP_lp_single_var_pos(can, orig_colnum);
+    if (pos < 0) {
+	return -1;
+    }
+    const double x = p.lp_result->x()[pos];
+    BCP_vec<double>::const_iterator bd = can->forced_var_bd_child(child);
+    const double etol = p.param(BCP_lp_par::IntegerTolerance);
+    if (bd[1] < x - etol) {
+	up = false;
+	change = x - bd[1];
+	return pos;
+    }
+    if (bd[0] > x + etol) {
+	up = true;
+	change = bd[0] - x;
+	return pos;
+    }
+    return -1;
+}
+
+//-----------------------------------------------------------------------------
+
+/** Record the outcome of presolving the children of a single variable
+    branching candidate in the pseudo-costs and in the strong branching
+    cache. Children marked in <code>skip</code> (e.g., whose results came
+    from the cache) and abandoned children are skipped. Only children
+    solved to optimality (or to the presolve iteration limit) update the
+    pseudo-costs. */
+static inline void
+BCP_lp_record_presolved(BCP_lp_prob& p, const int orig_colnum,
+			const BCP_presolved_lp_brobj* presolved,
+			const BCP_vec<bool>& skip)
+{
+    const BCP_lp_branching_object* can = presolved->candidate();
+    const int pos = BCP_lp_single_var_pos(can, orig_colnum);
+    if (pos < 0)
+	return;
+    const int bcpind = p.node->vars[pos]->bcpind();
+    const double objval = p.lp_result->objval();
+    const bool use_cache = p.param(BCP_lp_par::StrongBranchCacheAge) > 0;
+    bool up;
+    double change;
+    for (int i = 0; i < can->child_num; ++i) {
+	if (skip[i])
+	    continue;
+	const BCP_lp_result& res = presolved->lpres(i);
+	const int tc = res.termcode();
+	if (tc & BCP_Abandoned)
+	    continue;
+	if (use_cache) {
+	    BCP_vec<double>::const_iterator bd = can->forced_var_bd_child(i);
+	    p.sb_cache.insert(bcpind, bd[0], bd[1], p.node->level,
+			      tc, res.iternum(), res.objval() - objval);
+	}
+	if ((tc & (BCP_ProvenOptimal | BCP_IterationLimit)) &&
+	    BCP_lp_single_var_branch(p, can, orig_colnum, i, up, change) >= 0)
+	    p.pseudocosts.update(bcpind, up, change, res.objval() - objval);
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+/** Fill in the results of those children of a single variable branching
+    candidate that are found in the strong branching cache and mark them in
+    <code>cached</code> (which must have an entry for every child). */
+static inline void
+BCP_lp_sb_cache_lookup(BCP_lp_prob& p, const int orig_colnum,
+		       BCP_presolved_lp_brobj* presolved,
+		       BCP_vec<bool>& cached)
+{
+    const BCP_lp_branching_object* can = presolved->candidate();
+    const int pos = BCP_lp_single_var_pos(can, orig_colnum);
+    if (pos < 0)
+	return;
+    const int bcpind = p.node->vars[pos]->bcpind();
+    const double objval = p.lp_result->objval();
+    const int max_level_diff =
+	p.param(BCP_lp_par::StrongBranchCacheLevelDiff);
+    for (int i = 0; i < can->child_num; ++i) {
+	BCP_vec<double>::const_iterator bd = can->forced_var_bd_child(i);
+	++p.stat.sb_cache_lookups;
+	const BCP_sb_cache_entry* entry =
+	    p.sb_cache.find(bcpind, bd[0], bd[1], p.node->level,
+			    max_level_diff);
+	if (entry) {
+	    presolved->fake_results(i, entry->termcode, entry->iternum,
+				    objval + entry->objchange);
+	    cached[i] = true;
+	    ++p.stat.sb_cache_hits;
+	}
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+/** Test the feasibility of the LP solution of a freshly presolved child and
+    let the user generate cuts from it. */
+static inline void
+BCP_lp_check_presolved_child(BCP_lp_prob& p,
+			     BCP_presolved_lp_brobj* presolved, const int i,
+			     const OsiBabSolver* babSolver)
+{
+    BCP_lp_test_feasibility(p, presolved->lpres(i));
+    if (babSolver) {
+	p.user->generate_cuts_in_lp(presolved->lpres(i),
+				    p.node->vars, p.node->cuts,
+				    presolved->get_new_cuts()[i],
+				    presolved->get_new_rows()[i]);
+    }
+}
+
+//#############################################################################
+
+/** Print the result of presolving a candidate and compare it to the best
+    candidate so far. <code>tmp_presolved</code> is deleted (after being
+    swapped with <code>best_presolved</code> if it is better). Return whether
+    it became the best one. */
+static inline bool
+BCP_lp_compare_presolved(BCP_lp_prob& p, const int orig_colnum,
+			 BCP_vec<BCP_lp_branching_object*>& candidates,
+			 BCP_vec<BCP_lp_branching_object*>::iterator cani,
+			 BCP_presolved_lp_brobj* tmp_presolved,
+			 BCP_presolved_lp_brobj*& best_presolved)
+{
+    const BCP_lp_branching_object* can = *cani;
+    int i;
+    bool is_best = false;
+    if (p.param(BCP_lp_par::LpVerb_PresolveResult)) {
+	p.user->print(true, "LP:   Presolving:");
+	if (p.param(BCP_lp_par::LpVerb_PresolvePositions)) {
+	    can->print_branching_info(orig_colnum,
+				      p.lp_result->x(),
+				      p.lp_solver->getObjCoefficients());
+	}
+	for (i = 0; i < can->child_num; ++i) {
+	    const BCP_lp_result& res = tmp_presolved->lpres(i);
+	    const double lb = res.objval();
+	    p.user->print(true,
+			  (lb>BCP_DBL_MAX/10 ? " [%e,%i,%i]":" [%.4f,%i,%i]"),
+			  lb, res.termcode(), res.iternum());
+	}
+	p.user->print(true, "\n");
+    }
+    // Compare the current one with the best so far. Children taken from
+    // the strong branching cache have no LP solution, an overridden
+    // comparison can't be trusted with them, so the default one is used.
+    const bool cached =
+	! tmp_presolved->has_lp_solutions() ||
+	(best_presolved && ! best_presolved->has_lp_solutions());
+    const BCP_branching_object_relation relation = cached ?
+	p.user->BCP_lp_user::compare_branching_candidates(tmp_presolved,
+							  best_presolved) :
+	p.user->compare_branching_candidates(tmp_presolved, best_presolved);
+    switch (relation) {
+    case BCP_OldPresolvedIsBetter:
+	break;
+    case BCP_NewPresolvedIsBetter:
+	std::swap(tmp_presolved, best_presolved);
+	is_best = true;
+	break;
+    case BCP_NewPresolvedIsBetter_BranchOnIt:
+	// Free the remaining candidates if there are any. This also resets
+	// candidates.end(), thus 
+	purge_ptr_vector(candidates, cani + 1, candidates.end());
+	std::swap(tmp_presolved, best_presolved);
+	is_best = true;
+	break;
+    }
+    delete tmp_presolved;
+    return is_best;
+}
+
+//-----------------------------------------------------------------------------
+
+/** Presolve those children of the selected candidate whose results were
+    taken from the strong branching cache. Cached results are good enough to
+    rank the candidates, but they are not valid bounds for the children
+    (the parent LP may differ from the one they were computed at), so the
+    children that are actually created must be presolved for real. */
+static void
+BCP_lp_presolve_cached_children(BCP_lp_prob& p, const int orig_colnum,
+				const CoinWarmStart* ws,
+				BCP_presolved_lp_brobj* presolved,
+				const BCP_vec<bool>& cached,
+				const BCP_vec<int>& all_indices,
+				const BCP_vec<double>& rowbounds,
+				const BCP_vec<double>& colbounds,
+				const OsiBabSolver* babSolver)
+{
+    OsiSolverInterface* lp = p.lp_solver;
+    const BCP_lp_branching_object* can = presolved->candidate();
+    const int rownum = rowbounds.size() / 2;
+    const int colnum = colbounds.size() / 2;
+
+    // the warmstart is optimal, this should take no iterations
+    lp->setWarmStart(ws);
+    lp->resolve();
+    lp->markHotStart();
+    // the children that are not cached have already been recorded
+    BCP_vec<bool> recorded(can->child_num, true);
+    for (int i = 0; i < can->child_num; ++i) {
+	if (! cached[i])
+	    continue;
+	recorded[i] = false;
+	can->apply_child_bd(lp, i);
+	p.user->modify_lp_parameters(p.lp_solver, 1, true);
+	lp->solveFromHotStart();
+	presolved->get_results(*lp, i);
+	BCP_lp_check_presolved_child(p, presolved, i, babSolver);
+    }
+    if (can->cuts_affected() > 0)
+	lp->setRowSetBounds(all_indices.begin(), all_indices.entry(rownum),
+			    rowbounds.begin());
+    if (can->vars_affected() > 0)
+	lp->setColSetBounds(all_indices.begin(), all_indices.entry(colnum),
+			    colbounds.begin());
+    lp->unmarkHotStart();
+    BCP_lp_record_presolved(p, orig_colnum, presolved, recorded);
+}
+
+//#############################################################################
+
+#ifdef HAVE_PTHREAD_H
+
+/** The data a strong branching thread works with. Every thread has its own
+    copy of the LP, the presolved branching objects are shared and the
+    threads pick the next unprocessed one under the protection of a
+    mutex. */
+struct BCP_strong_branching_thread_data {
+    OsiSolverInterface* lp;
+    BCP_vec<BCP_presolved_lp_brobj*>* presolved;
+    const BCP_vec< BCP_vec<bool> >* cached;
+    int* next_cand;
+    pthread_mutex_t* mutex;
+    const BCP_vec<int>* all_indices;
+    const BCP_vec<double>* rowbounds;
+    const BCP_vec<double>* colbounds;
+    BCP_vec<double>* cand_time;
+};
+
+//-----------------------------------------------------------------------------
+
+/** The body of a strong branching thread. Only the LP solver (the thread's
+    own copy) is touched here, everything that invokes user methods is done
+    by the main thread once the threads are finished. */
+static void*
+BCP_strong_branching_thread(void* arg)
+{
+    BCP_strong_branching_thread_data& d =
+	*static_cast<BCP_strong_branching_thread_data*>(arg);
+    OsiSolverInterface* lp = d.lp;
+    const int rownum = d.rowbounds->size() / 2;
+    const int colnum = d.colbounds->size() / 2;
+    const int cand_num = d.presolved->size();
+
+    // the copy must be solved before hot starts can be used. Since the
+    // warmstart is optimal this should take no iterations.
+    lp->resolve();
+    lp->markHotStart();
+    while (true) {
+	pthread_mutex_lock(d.mutex);
+	const int cand_ind = (*d.next_cand)++;
+	pthread_mutex_unlock(d.mutex);
+	if (cand_ind >= cand_num)
+	    break;
+	const double cand0 = CoinWallclockTime();
+	BCP_presolved_lp_brobj* tmp_presolved = (*d.presolved)[cand_ind];
+	const BCP_lp_branching_object* can = tmp_presolved->candidate();
+	const BCP_vec<bool>& cached = (*d.cached)[cand_ind];
+	for (int i = 0; i < can->child_num; ++i) {
+	    if (cached[i])
+		continue;
+	    can->apply_child_bd(lp, i);
+	    lp->solveFromHotStart();
+	    tmp_presolved->get_results(*lp, i);
+	}
+	if (can->cuts_affected() > 0)
+	    lp->setRowSetBounds(d.all_indices->begin(),
+				d.all_indices->entry(rownum),
+				d.rowbounds->begin());
+	if (can->vars_affected() > 0)
+	    lp->setColSetBounds(d.all_indices->begin(),
+				d.all_indices->entry(colnum),
+				d.colbounds->begin());
+	(*d.cand_time)[cand_ind] = CoinWallclockTime() - cand0;
+    }
+    lp->unmarkHotStart();
+    return 0;
+}
+
+//-----------------------------------------------------------------------------
+
+/** Presolve the candidates concurrently on <code>thread_num</code> copies of
+    the LP solver. The results are stored into <code>presolved</code> (which
+    has an entry for each candidate) and the time spent on each candidate
+    into <code>cand_time</code>. The children marked in <code>cached</code>
+    are skipped. */
+static void
+BCP_lp_presolve_candidates_in_threads(BCP_lp_prob& p, const int thread_num,
+				      const CoinWarmStart* ws,
+				      BCP_vec<BCP_presolved_lp_brobj*>& presolved,
+				      const BCP_vec< BCP_vec<bool> >& cached,
+				      const BCP_vec<int>& all_indices,
+				      const BCP_vec<double>& rowbounds,
+				      const BCP_vec<double>& colbounds,
+				      BCP_vec<double>& cand_time)
+{
+    int next_cand = 0;
+    pthread_mutex_t mutex;
+    pthread_mutex_init(&mutex, NULL);
+
+    BCP_vec<BCP_strong_branching_thread_data> data;
+    data.reserve(thread_num);
+    BCP_vec<pthread_t> threads(thread_num, pthread_t());
+    BCP_vec<bool> started(thread_num, false);
+
+    int t;
+    for (t = 0; t < thread_num; ++t) {
+	BCP_strong_branching_thread_data d;
+	d.lp = p.lp_solver->clone();
+	d.lp->setWarmStart(ws);
+	if (p.param(BCP_lp_par::MaxPresolveIter) > 0) {
+	    d.lp->setIntParam(OsiMaxNumIterationHotStart,
+			      p.param(BCP_lp_par::MaxPresolveIter));
+	}
+	// bound changes always imply that primal feasibility is lost.
+	p.user->modify_lp_parameters(d.lp, 1, true);
+	d.presolved = &presolved;
+	d.cached = &cached;
+	d.next_cand = &next_cand;
+	d.mutex = &mutex;
+	d.all_indices = &all_indices;
+	d.rowbounds = &rowbounds;
+	d.colbounds = &colbounds;
+	d.cand_time = &cand_time;
+	data.unchecked_push_back(d);
+    }
+    for (t = 0; t < thread_num; ++t) {
+	started[t] = pthread_create(&threads[t], NULL,
+				    BCP_strong_branching_thread, &data[t]) == 0;
+    }
+    for (t = 0; t < thread_num; ++t) {
+	if (started[t]) {
+	    pthread_join(threads[t], NULL);
+	} else {
+	    // could not create the thread. Do its work here, it just picks up
+	    // whatever candidates are left over.
+	    BCP_strong_branching_thread(&data[t]);
+	}
+	delete data[t].lp;
+    }
+    pthread_mutex_destroy(&mutex);
+}
+
+#endif
+
+//#############################################################################
+
 static inline int
 BCP_lp_perform_strong_branching(BCP_lp_prob& p,
 				BCP_vec<BCP_lp_branching_object*>& candidates,
@@ -267,9 +661,6 @@ BCP_lp_perform_strong_branching(BCP_lp_prob& p,
 
     const CoinWarmStart * ws = p.lp_solver->getWarmStart();
 
-    // prepare for strong branching
-    lp->markHotStart();
-
     // save the lower/upper bounds of every var/cut
     BCP_vec<double> rowbounds(2 * rownum, 0.0);
     BCP_vec<double> colbounds(2 * colnum, 0.0);
@@ -302,20 +693,93 @@ BCP_lp_perform_strong_branching(BCP_lp_prob& p,
 	lp->setIntParam(OsiMaxNumIterationHotStart,
 			p.param(BCP_lp_par::MaxPresolveIter));
     }
+    // children above the UB need not be solved to optimality. The copies
+    // of the LP used by the threads inherit this.
+    BCP_lp_check_ub(p);
+    BCP_lp_set_objective_cutoff(p, *lp);
 
     p.user->print(p.param(BCP_lp_par::LpVerb_StrongBranchResult),
 		  "\nLP: Starting strong branching:\n\n");
 
     const OsiBabSolver* babSolver = p.user->getOsiBabSolver();
 
+    const bool use_cache = p.param(BCP_lp_par::StrongBranchCacheAge) > 0;
+    if (use_cache) {
+	p.sb_cache.new_round(p.param(BCP_lp_par::StrongBranchCacheAge));
+    }
+    // which children of the best candidate have cached results
+    BCP_vec<bool> best_cached;
+
+#ifdef HAVE_PTHREAD_H
+    const int thread_num =
+	std::min<int>(p.param(BCP_lp_par::StrongBranchThreadNum),
+		      candidates.size());
+    if (thread_num > 1) {
+	// Presolve the candidates concurrently, then process the results the
+	// same way (and in the same order) as in the sequential case.
+	BCP_vec<BCP_presolved_lp_brobj*> presolved;
+	BCP_vec< BCP_vec<bool> > cached;
+	presolved.reserve(candidates.size());
+	cached.reserve(candidates.size());
+	for (cani = candidates.begin(); cani != candidates.end(); ++cani) {
+	    presolved.unchecked_push_back(new BCP_presolved_lp_brobj(*cani));
+	    cached.unchecked_push_back(BCP_vec<bool>((*cani)->child_num,
+						     false));
+	    if (use_cache) {
+		BCP_lp_sb_cache_lookup(p, orig_colnum, presolved.back(),
+				       cached.back());
+	    }
+	}
+	BCP_vec<double> cand_time(candidates.size(), 0.0);
+	BCP_lp_presolve_candidates_in_threads(p, thread_num, ws, presolved,
+					      cached, all_indices,
+					      rowbounds, colbounds, cand_time);
+	for (i = 0; i < static_cast<int>(cand_time.size()); ++i)
+	    p.stat.sb_candidate_time.record(cand_time[i]);
+	int cand_ind = 0;
+	for (cani = candidates.begin(); cani != candidates.end(); ++cani) {
+	    BCP_presolved_lp_brobj* tmp_presolved = presolved[cand_ind];
+	    BCP_vec<bool>& tmp_cached = cached[cand_ind];
+	    presolved[cand_ind++] = 0;
+	    for (i = 0; i < (*cani)->child_num; ++i) {
+		if (! tmp_cached[i])
+		    BCP_lp_check_presolved_child(p, tmp_presolved, i,
+						 babSolver);
+	    }
+	    BCP_lp_record_presolved(p, orig_colnum, tmp_presolved,
+				    tmp_cached);
+	    if (BCP_lp_compare_presolved(p, orig_colnum, candidates, cani,
+					 tmp_presolved, best_presolved)) {
+		best_cached.swap(tmp_cached);
+	    }
+	}
+	// if a candidate was selected before all were compared then the
+	// presolved objects of the rest are still here
+	purge_ptr_vector(presolved);
+    } else
+#endif
+    {
+    // prepare for strong branching
+    lp->markHotStart();
+
     int cand_ind = -1;
     for (cani = candidates.begin(); cani != candidates.end(); ++cani){
+	const double cand0 = CoinWallclockTime();
 	// Create a temporary branching object to hold the current results
 	BCP_presolved_lp_brobj* tmp_presolved =
 	    new BCP_presolved_lp_brobj(*cani);
 	const BCP_lp_branching_object* can = *cani;
 	++cand_ind;
+	BCP_vec<bool> cached(can->child_num, false);
+	if (use_cache) {
+	    BCP_lp_sb_cache_lookup(p, orig_colnum, tmp_presolved, cached);
+	}
+	// a better UB may have arrived since the previous candidate, that
+	// tightens the cutoff for the children of this one.
+	BCP_lp_check_ub(p);
 	for (i = 0; i < can->child_num; ++i){
+	    if (cached[i])
+		continue;
 	    can->apply_child_bd(lp, i);
 	    // bound changes always imply that primal feasibility is lost.
 	    p.user->modify_lp_parameters(p.lp_solver, 1, true);
@@ -328,13 +792,7 @@ BCP_lp_perform_strong_branching(BCP_lp_prob& p,
 #endif
 	    lp->solveFromHotStart();
 	    tmp_presolved->get_results(*lp, i);
-	    BCP_lp_test_feasibility(p, tmp_presolved->lpres(i));
-	    if (babSolver) {
-		p.user->generate_cuts_in_lp(tmp_presolved->lpres(i),
-					    p.node->vars, p.node->cuts,
-					    tmp_presolved->get_new_cuts()[i],
-					    tmp_presolved->get_new_rows()[i]);
-	    }
+	    BCP_lp_check_presolved_child(p, tmp_presolved, i, babSolver);
 	}
 	// reset the bounds of the affected vars/cuts
 	if (can->cuts_affected() > 0)
@@ -343,43 +801,25 @@ BCP_lp_perform_strong_branching(BCP_lp_prob& p,
 	if (can->vars_affected() > 0)
 	    lp->setColSetBounds(all_indices.begin(), all_indices.entry(colnum),
 				colbounds.begin());
+	p.stat.sb_candidate_time.record(CoinWallclockTime() - cand0);
 
-	if (p.param(BCP_lp_par::LpVerb_PresolveResult)) {
-	    p.user->print(true, "LP:   Presolving:");
-	    if (p.param(BCP_lp_par::LpVerb_PresolvePositions)) {
-		can->print_branching_info(orig_colnum,
-					  p.lp_result->x(),
-					  p.lp_solver->getObjCoefficients());
-	    }
-	    for (i = 0; i < can->child_num; ++i) {
-		const BCP_lp_result& res = tmp_presolved->lpres(i);
-		const double lb = res.objval();
-		p.user->print(true,
-			      (lb>BCP_DBL_MAX/10 ? " [%e,%i,%i]":" [%.4f,%i,%i]"),
-			      lb, res.termcode(), res.iternum());
-	    }
-	    p.user->print(true, "\n");
+	BCP_lp_record_presolved(p, orig_colnum, tmp_presolved, cached);
+	if (BCP_lp_compare_presolved(p, orig_colnum, candidates, cani,
+				     tmp_presolved, best_presolved)) {
+	    best_cached.swap(cached);
 	}
-	// Compare the current one with the best so far
-	switch (p.user->compare_branching_candidates(tmp_presolved,
-						     best_presolved)) {
-	case BCP_OldPresolvedIsBetter:
-	    break;
-	case BCP_NewPresolvedIsBetter:
-	    std::swap(tmp_presolved, best_presolved);
-	    break;
-	case BCP_NewPresolvedIsBetter_BranchOnIt:
-	    // Free the remaining candidates if there are any. This also resets
-	    // candidates.end(), thus 
-	    purge_ptr_vector(candidates, cani + 1, candidates.end());
-	    std::swap(tmp_presolved, best_presolved);
-	    break;
-	}
-	delete tmp_presolved;
     }
 
     // indicate to the lp solver that strong branching is done
     lp->unmarkHotStart();
+    }
+
+    if (std::find(best_cached.begin(), best_cached.end(), true) !=
+	best_cached.end()) {
+	BCP_lp_presolve_cached_children(p, orig_colnum, ws, best_presolved,
+					best_cached, all_indices,
+					rowbounds, colbounds, babSolver);
+    }
     p.lp_solver->setWarmStart(ws);
 
     // delete all the candidates but the selected one (candidates will just
@@ -471,9 +911,14 @@ BCP_lp_select_branching_object: branching forced but no candidates selected\n");
     const int orig_colnum = p.node->vars.size();
 
     // if branching candidates are not presolved then choose the first
-    // branching candidate as the best candidate.
+    // branching candidate as the best candidate. A single candidate that is
+    // marked reliable (e.g., in reliability branching) is not presolved
+    // either.
     int selected = 0;
-    if (p.param(BCP_lp_par::MaxPresolveIter) < 0) {
+    const bool presolve =
+	p.param(BCP_lp_par::MaxPresolveIter) >= 0 &&
+	! (candidates.size() == 1 && candidates[0]->reliable_);
+    if (! presolve) {
 	if (candidates.size() > 1) {
 	    p.user->print(true, "\
 LP: Strong branching is disabled but more than one candidate is selected.\n\
@@ -526,7 +971,7 @@ LP: Strong branching is disabled but more than one candidate is selected.\n\
     // now throw out the fathomable ones. This can be done only if nothing
     // needs to be priced, there already is an upper bound and strong branching
     // was enabled (otherwise we don't have the LPs solved)
-    if (p.param(BCP_lp_par::MaxPresolveIter) >= 0) {
+    if (presolve) {
 	BCP_print_brobj_stat(p, orig_colnum, candidates.size(), selected,
 			     best_presolved);
     }
@@ -627,6 +1072,7 @@ BCP_lp_branch(BCP_lp_prob& p)
     switch (do_branch){
     case BCP_DoNotBranch_Fathomed:
 	BCP_lp_send_cuts_to_cp(p, -1);
+	BCP_lp_send_vars_to_vp(p);
 	BCP_lp_perform_fathom(p,"LP:   Forcibly fathoming node in branch().\n",
 			      BCP_Msg_NodeDescription_Discarded);
 	return BCP_BranchingFathomedThisNode;
@@ -649,8 +1095,9 @@ BCP_lp_branch(BCP_lp_prob& p)
     int keep = BCP_lp_send_node_description(p, best_presolved,
 					    BCP_Msg_NoMessage);
 
-    // send out the cuts to be sent to the CP
+    // send out the cuts to be sent to the CP and the vars to the VP
     BCP_lp_send_cuts_to_cp(p, -1);
+    BCP_lp_send_vars_to_vp(p);
 
     if (keep < 0){ // if no diving then return quickly
 	if (p.param(BCP_lp_par::LpVerb_FathomInfo)) {
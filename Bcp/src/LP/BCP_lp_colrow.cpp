@@ -7,6 +7,7 @@
 
 #include "CoinHelperFunctions.hpp"
 #include "CoinWarmStartBasis.hpp"
+#include "CoinTime.hpp"
 
 #include "BCP_problem_core.hpp"
 #include "BCP_lp_node.hpp"
@@ -53,6 +54,20 @@ bool BCP_lp_fix_vars(BCP_lp_prob& p)
 
    BCP_lp_check_ub(p);
 
+   // Reduced cost fixing at the root is valid in the whole tree. Remember
+   // the bounds to see what has changed.
+   const bool global_fixing =
+      p.param(BCP_lp_par::GlobalReducedCostFixing) &&
+      p.node->level == 0 && p.node->colgen != BCP_GenerateColumns;
+   BCP_vec<double> old_bd;
+   if (global_fixing) {
+      old_bd.reserve(2 * varnum);
+      for (i = 0; i < varnum; ++i) {
+	 old_bd.unchecked_push_back(vars[i]->lb());
+	 old_bd.unchecked_push_back(vars[i]->ub());
+      }
+   }
+
    if (lpres.dj()) {
      p.user->reduced_cost_fixing(lpres.dj(), lpres.x(),
 				 p.ub() - lpres.objval() - p.granularity(),
@@ -62,6 +77,14 @@ bool BCP_lp_fix_vars(BCP_lp_prob& p)
       printf("LP: Reduced cost fixing has changed the bounds on %i vars\n",
 	     newly_changed);
    }
+   if (global_fixing && newly_changed > 0) {
+      BCP_vec<int> tightened;
+      for (i = 0; i < varnum; ++i) {
+	 if (vars[i]->lb() != old_bd[2*i] || vars[i]->ub() != old_bd[2*i+1])
+	    tightened.push_back(i);
+      }
+      BCP_lp_send_global_var_bounds(p, tightened);
+   }
       
    p.var_bound_changes_since_logical_fixing += newly_changed;
 
@@ -140,6 +163,37 @@ bool BCP_lp_fix_vars(BCP_lp_prob& p)
 
 //#############################################################################
 
+bool BCP_lp_propagate_bounds(BCP_lp_prob& p)
+{
+   BCP_var_set& vars = p.node->vars;
+   BCP_vec<int> changed_pos;
+   BCP_vec<double> new_bd;
+
+   if (! p.propagator.propagate(*p.lp_solver, vars,
+				p.param(BCP_lp_par::BoundPropagationMaxRowVisits),
+				changed_pos, new_bd)) {
+      if (p.param(BCP_lp_par::LpVerb_VarTightening)) {
+	 printf("LP: Bound propagation has proved the LP infeasible\n");
+      }
+      return false;
+   }
+
+   const int change_num = changed_pos.size();
+   if (change_num > 0) {
+      p.lp_solver->setColSetBounds(changed_pos.begin(), changed_pos.end(),
+				   new_bd.begin());
+      vars.set_lb_ub(changed_pos, new_bd.begin());
+      p.var_bound_changes_since_logical_fixing += change_num;
+      if (p.param(BCP_lp_par::LpVerb_VarTightening)) {
+	 printf("LP: Bound propagation has changed the bounds on %i vars\n",
+		change_num);
+      }
+   }
+   return true;
+}
+
+//#############################################################################
+
 static void
 BCP_lp_reset_positions(const BCP_vec<int>& deletable, BCP_vec<int>& pos,
 		       const bool error_if_deletable)
@@ -212,6 +266,11 @@ void BCP_lp_delete_cols_and_rows(BCP_lp_prob& p,
    BCP_vec<int> deletable;
    deletable.reserve(CoinMax(varnum, cutnum));
 
+   // Whether the aged out vars/cuts are kept in the local pools. Not when the
+   // node is about to be left.
+   const bool keep_in_pool = ! can && ! from_fathom &&
+      p.param(BCP_lp_par::KeepDeletedInLocalPool);
+
    // find out which columns could be deleted
    p.user->select_vars_to_delete(lpres, vars, cuts, from_fathom, deletable);
 
@@ -268,10 +327,31 @@ void BCP_lp_delete_cols_and_rows(BCP_lp_prob& p,
       if (bas) {
 	 bas->deleteColumns(del_num, &deletable[0]);
       }
+      if (keep_in_pool) {
+	 // The vars deleted because they are ineffective go into the local
+	 // var pool, the pricing brings them back if they are useful again
+	 BCP_lp_var_pool& vp = *p.local_var_pool;
+	 const int prev_size = vp.size();
+	 for (int i = 0; i < del_num; ++i) {
+	    BCP_var* var = vars[deletable[i]];
+	    if (var->effective_count() < 0 && ! var->is_to_be_removed() &&
+		var->lb() < var->ub()) {
+	       var->set_effective_count(0);
+	       vp.push_back(new BCP_lp_waiting_col(var));
+	       vars[deletable[i]] = 0;
+	    }
+	 }
+	 if (static_cast<int>(vp.size()) > prev_size)
+	    vp.cols_are_valid(false);
+      }
+      const double time0 = CoinCpuTime();
       p.lp_solver->deleteCols(del_num, &deletable[0]);
+      p.stat.time_lp_modification += CoinCpuTime() - time0;
+      p.propagator.reset();
       purge_ptr_vector_by_index(dynamic_cast< BCP_vec<BCP_var*>& >(vars),
 				deletable.begin(), deletable.end());
       p.local_cut_pool->rows_are_valid(false);
+      p.slack_pool.delete_rows();
    }
 
    // Now do the same for rows
@@ -327,13 +407,43 @@ void BCP_lp_delete_cols_and_rows(BCP_lp_prob& p,
 	 if (can->implied_cut_pos)
 	    BCP_lp_reset_positions(deletable, *can->implied_cut_pos, false);
       } else {
-	 if (p.param(BCP_lp_par::BranchOnCuts))
-	    p.node->cuts.move_deletable_to_pool(deletable, p.slack_pool);
+	 if (p.param(BCP_lp_par::BranchOnCuts) ||
+	     p.param(BCP_lp_par::SlackCutDiscardingStrategy) ==
+	     BCP_DiscardSlackCutsLeastRecentlyUsed) {
+	    const int max_size =
+	       p.param(BCP_lp_par::SlackCutDiscardingStrategy) ==
+	       BCP_DiscardSlackCutsLeastRecentlyUsed ?
+	       p.param(BCP_lp_par::SlackPoolMaxSize) : 0;
+	    for (int i = 0; i < del_num; ++i) {
+	       BCP_cut* cut = cuts[deletable[i]];
+	       cut->set_effective_count(0);
+	       p.slack_pool.add(cut, p.node->index, max_size);
+	       cuts[deletable[i]] = 0;
+	    }
+	 } else if (keep_in_pool) {
+	    // Similarly to the vars, the ineffective cuts go into the local
+	    // cut pool and come back if they are violated again
+	    BCP_lp_cut_pool& cp = *p.local_cut_pool;
+	    const int prev_size = cp.size();
+	    for (int i = 0; i < del_num; ++i) {
+	       BCP_cut* cut = cuts[deletable[i]];
+	       if (cut->effective_count() < 0 && ! cut->is_to_be_removed()) {
+		  cut->set_effective_count(0);
+		  cp.push_back(new BCP_lp_waiting_row(cut));
+		  cuts[deletable[i]] = 0;
+	       }
+	    }
+	    if (static_cast<int>(cp.size()) > prev_size)
+	       cp.rows_are_valid(false);
+	 }
       }
       if (bas) {
 	 bas->deleteRows(del_num, &deletable[0]);
       }
+      const double time0 = CoinCpuTime();
       p.lp_solver->deleteRows(deletable.size(), &deletable[0]);
+      p.stat.time_lp_modification += CoinCpuTime() - time0;
+      p.propagator.reset();
       purge_ptr_vector_by_index(dynamic_cast< BCP_vec<BCP_cut*>& >(cuts),
 				deletable.begin(), deletable.end());
       p.node->lb_at_cutgen.erase_by_index(deletable);
@@ -406,6 +516,41 @@ void BCP_lp_adjust_row_effectiveness(BCP_lp_prob& p)
 
 //#############################################################################
 
+void BCP_lp_adjust_col_effectiveness(BCP_lp_prob& p)
+{
+  // Columns are worth aging only if they can come back by pricing
+  if (p.param(BCP_lp_par::IneffectiveColsBeforeDelete) <= 0 ||
+      p.node->colgen != BCP_GenerateColumns)
+    return;
+
+  const BCP_lp_result& lpres = *p.lp_result;
+  const double * x = lpres.x();
+  const double * dj = lpres.dj();
+  const double * clb = p.lp_solver->getColLower();
+  const double petol = lpres.primalTolerance();
+  const double detol = lpres.dualTolerance();
+
+  BCP_var_set& vars = p.node->vars;
+  int i, ineff = 0;
+  const int varnum = vars.size();
+  for (i = p.core->varnum(); i < varnum; ++i) {
+    BCP_var *var = vars[i];
+    // ineffective: nonbasic at its lower bound and it would stay there
+    if (x[i] < clb[i] + petol && dj[i] > detol) {
+      var->decrease_effective_count();
+      if (! var->is_non_removable())
+	++ineff;
+    } else {
+      var->increase_effective_count();
+    }
+  }
+  if (p.param(BCP_lp_par::LpVerb_ColEffectivenessCount))
+    printf("LP:   Col effectiveness: colnum: %i ineffective: %i\n",
+	   varnum, ineff);
+}
+
+//#############################################################################
+
 int BCP_lp_add_from_local_cut_pool(BCP_lp_prob& p)
 {
    // First find out how many do we want to add
@@ -488,7 +633,10 @@ int BCP_lp_add_from_local_cut_pool(BCP_lp_prob& p)
      p.node->cuts.unchecked_push_back(cut);
    }
    rows -= added_rows;
+   const double time0 = CoinCpuTime();
    p.lp_solver->addRows(added_rows, rows, rlb.begin(), rub.begin());
+   p.stat.time_lp_modification += CoinCpuTime() - time0;
+   p.propagator.reset();
    cpi = first - 1;
    while (++cpi != last) {
      (*cpi)->clear_cut();
@@ -519,9 +667,10 @@ int BCP_lp_add_from_local_var_pool(BCP_lp_prob& p)
 {
    // First find out how many do we want to add
    BCP_lp_var_pool& vp = *p.local_var_pool;
+   // columns skipped by partial pricing are not candidates
    size_t added_cols =
       std::min<size_t>(size_t(p.param(BCP_lp_par::MaxVarsAddedPerIteration)),
-		       vp.size());
+		       size_t(vp.priced_num()));
 
    if (added_cols == 0)
      return 0;
@@ -575,8 +724,14 @@ int BCP_lp_add_from_local_var_pool(BCP_lp_prob& p)
      obj.unchecked_push_back(col->Objective());
    }
    cols -= added_cols;
+   const double time0 = CoinCpuTime();
    p.lp_solver->addCols(added_cols, cols,
 			clb.begin(), cub.begin(), obj.begin());
+   p.stat.time_lp_modification += CoinCpuTime() - time0;
+   p.propagator.reset();
+   // the cached rows have no coefficients for the new columns
+   p.local_cut_pool->rows_are_valid(false);
+   p.slack_pool.delete_rows();
    vpi = first - 1;
    while (++vpi != last) {
      (*vpi)->clear_var();
@@ -5,9 +5,11 @@
 #include "CoinWarmStartPrimalDual.hpp"
 #include "CoinWarmStartBasis.hpp"
 
+#include "BCP_lp.hpp"
 #include "BCP_lp_functions.hpp"
 #include "BCP_warmstart_dual.hpp"
 #include "BCP_warmstart_primaldual.hpp"
+#include "BCP_warmstart_basis.hpp"
 
 BCP_warmstart*
 BCP_lp_convert_CoinWarmStart(BCP_lp_prob& p, CoinWarmStart*& warmstart)
@@ -15,13 +17,17 @@ BCP_lp_convert_CoinWarmStart(BCP_lp_prob& p, CoinWarmStart*& warmstart)
   if (warmstart == NULL)
     return NULL;
 
+  const bool single_precision =
+    p.param(BCP_lp_par::WarmstartSinglePrecision);
+
   {
     const CoinWarmStartDual* ws =
       dynamic_cast<const CoinWarmStartDual*>(warmstart);
     if (ws != NULL) {
       const int size = ws->size();
       const double* dual = ws->dual();
-      BCP_warmstart* bcp_ws = new BCP_warmstart_dual(dual, dual+size);
+      BCP_warmstart* bcp_ws =
+	new BCP_warmstart_dual(dual, dual+size, single_precision);
       delete warmstart;
       warmstart = NULL;
       return bcp_ws;
@@ -37,7 +43,8 @@ BCP_lp_convert_CoinWarmStart(BCP_lp_prob& p, CoinWarmStart*& warmstart)
       const double* primal = ws->primal();
       const double* dual = ws->dual();
       BCP_warmstart* bcp_ws =
-	  new BCP_warmstart_primaldual(primal, primal+psize, dual, dual+dsize);
+	  new BCP_warmstart_primaldual(primal, primal+psize, dual, dual+dsize,
+				       single_precision);
       delete warmstart;
       warmstart = NULL;
       return bcp_ws;
@@ -48,10 +55,21 @@ BCP_lp_convert_CoinWarmStart(BCP_lp_prob& p, CoinWarmStart*& warmstart)
     const CoinWarmStartBasis* ws =
       dynamic_cast<const CoinWarmStartBasis*>(warmstart);
     if (ws != NULL) {
-      // *FIXME* : want to convert it to BCP_warmstart_basis
+      const int vnum = ws->getNumStructural();
+      const int cnum = ws->getNumArtificial();
+      BCP_vec<char> vstat(vnum, 0);
+      BCP_vec<char> cstat(cnum, 0);
+      int i;
+      for (i = 0; i < vnum; ++i)
+	vstat[i] = static_cast<char>(ws->getStructStatus(i));
+      for (i = 0; i < cnum; ++i)
+	cstat[i] = static_cast<char>(ws->getArtifStatus(i));
+      BCP_warmstart* bcp_ws =
+	new BCP_warmstart_basis(vstat.begin(), vstat.end(),
+				cstat.begin(), cstat.end());
       delete warmstart;
       warmstart = NULL;
-      return NULL;
+      return bcp_ws;
     }
   }
 
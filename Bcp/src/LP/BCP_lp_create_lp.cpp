@@ -1,8 +1,11 @@
 // Copyright (C) 2000, International Business Machines
 // Corporation and others.  All Rights Reserved.
+#include <cstdlib>
+#include <set>
 
 #include "OsiSolverInterface.hpp"
 #include "CoinWarmStart.hpp"
+#include "CoinTime.hpp"
 
 #include "BCP_matrix.hpp"
 #include "BCP_problem_core.hpp"
@@ -13,9 +16,124 @@
 #include "BCP_lp.hpp"
 #include "BCP_lp_functions.hpp"
 
-void BCP_lp_create_lp(BCP_lp_prob& p)
+/** Compare the extra objects whose columns/rows are in the LP solver
+    (<code>old_ind</code>) to the extra objects of the new node
+    (<code>new_ind</code>). Objects can be kept only if they are in the same
+    order in both lists, since new columns/rows can only be appended. The
+    LP positions to be deleted are appended to <code>del_pos</code> and the
+    number of objects of the new node already in the LP is returned (those
+    are at the beginning of <code>new_ind</code>). */
+static int
+BCP_lp_match_resident_objects(const BCP_vec<int>& old_ind,
+			      const BCP_vec<int>& new_ind, const int corenum,
+			      BCP_vec<int>& del_pos)
 {
-  p.user->load_problem(*p.lp_solver, p.core, p.node->vars, p.node->cuts);
+  const int oldnum = old_ind.size();
+  const int newnum = new_ind.size();
+  const std::set<int> in_new(new_ind.begin(), new_ind.end());
+  int i = 0;
+  int j = 0;
+  while (i < oldnum && j < newnum) {
+    if (old_ind[i] == new_ind[j]) {
+      ++i;
+      ++j;
+    } else if (in_new.find(old_ind[i]) == in_new.end()) {
+      del_pos.push_back(corenum + i);
+      ++i;
+    } else {
+      // new_ind[j] would have to be inserted in front of old_ind[i]
+      break;
+    }
+  }
+  for ( ; i < oldnum; ++i)
+    del_pos.push_back(corenum + i);
+  return j;
+}
+
+//#############################################################################
+
+/** Turn the LP solver left over from the previous node into the formulation
+    of the current node: delete the columns/rows of the vars/cuts not in
+    this node and add the new ones. The bounds are set by the caller. */
+static void
+BCP_lp_update_resident_lp(BCP_lp_prob& p)
+{
+  OsiSolverInterface& lp = *p.lp_solver;
+  BCP_var_set& vars = p.node->vars;
+  BCP_cut_set& cuts = p.node->cuts;
+  const int bvarnum = p.core->varnum();
+  const int bcutnum = p.core->cutnum();
+  const int varnum = vars.size();
+  const int cutnum = cuts.size();
+  int i;
+
+  BCP_vec<int> new_ind;
+  BCP_vec<int> del_pos;
+
+  new_ind.reserve(cutnum - bcutnum);
+  for (i = bcutnum; i < cutnum; ++i)
+    new_ind.unchecked_push_back(abs(cuts[i]->bcpind()));
+  const int kept_cutnum = bcutnum +
+    BCP_lp_match_resident_objects(p.resident_cut_ind, new_ind, bcutnum,
+				  del_pos);
+  if (del_pos.size() > 0)
+    lp.deleteRows(del_pos.size(), del_pos.begin());
+
+  new_ind.clear();
+  del_pos.clear();
+  new_ind.reserve(varnum - bvarnum);
+  for (i = bvarnum; i < varnum; ++i)
+    new_ind.unchecked_push_back(abs(vars[i]->bcpind()));
+  const int kept_varnum = bvarnum +
+    BCP_lp_match_resident_objects(p.resident_var_ind, new_ind, bvarnum,
+				  del_pos);
+  if (del_pos.size() > 0)
+    lp.deleteCols(del_pos.size(), del_pos.begin());
+  const bool colset_changed = del_pos.size() > 0 || kept_varnum < varnum;
+
+  // Add the new cols (they are expanded on the cuts already in the LP), then
+  // the new rows (expanded on every var), just like load_problem() does.
+  if (kept_varnum < varnum) {
+    BCP_vec<BCP_var*> added_vars(vars.entry(kept_varnum), vars.end());
+    BCP_vec<BCP_cut*> kept_cuts(cuts.begin(), cuts.entry(kept_cutnum));
+    BCP_vec<BCP_col*> cols;
+    cols.reserve(added_vars.size());
+    p.user->vars_to_cols(kept_cuts, added_vars, cols,
+			 *p.lp_result, BCP_Object_FromTreeManager, false);
+    BCP_lp_add_cols_to_lp(cols, &lp);
+    purge_ptr_vector(cols);
+  }
+  if (kept_cutnum < cutnum) {
+    BCP_vec<BCP_cut*> added_cuts(cuts.entry(kept_cutnum), cuts.end());
+    BCP_vec<BCP_row*> rows;
+    rows.reserve(added_cuts.size());
+    p.user->cuts_to_rows(vars, added_cuts, rows,
+			 *p.lp_result, BCP_Object_FromTreeManager, false);
+    BCP_lp_add_rows_to_lp(rows, &lp);
+    purge_ptr_vector(rows);
+  }
+
+  // The integrality info refers to column positions; it is recreated in
+  // BCP_lp_prepare_for_new_node().
+  if (colset_changed)
+    lp.deleteObjects();
+
+  ++p.stat.nodes_reused_lp;
+}
+
+//#############################################################################
+
+void BCP_lp_create_lp(BCP_lp_prob& p, const bool reuse)
+{
+  const double time0 = CoinCpuTime();
+  if (reuse) {
+    BCP_lp_update_resident_lp(p);
+  } else {
+    p.user->load_problem(*p.lp_solver, p.core, p.node->vars, p.node->cuts);
+  }
+  // the rows of the LP are not the ones the propagator has seen
+  p.propagator.reset();
+  p.stabilizer.reset();
   BCP_var_set& vars = p.node->vars;
   BCP_cut_set& cuts = p.node->cuts;
   const int varnum = vars.size();
@@ -53,6 +171,7 @@ void BCP_lp_create_lp(BCP_lp_prob& p)
   if (p.local_cut_pool) {
     p.local_cut_pool->rows_are_valid(false);
   }
+  p.slack_pool.delete_rows();
   if (p.local_var_pool) {
     p.local_var_pool->cols_are_valid(false);
   }
@@ -69,4 +188,7 @@ void BCP_lp_create_lp(BCP_lp_prob& p)
     delete p.node->warmstart;
     p.node->warmstart = 0;
   }
+
+  ++p.stat.nodes_set_up;
+  p.stat.time_node_setup += CoinCpuTime() - time0;
 }
@@ -88,9 +88,11 @@ LP:   Fathoming node (discovered not restorable inf.)\n",
 		    vars_to_add[i]->set_bcpind(-BCP_lp_next_var_index(p));
 		}
 		BCP_lp_add_cols_to_lp(cols_to_add, p.lp_solver);
+		p.propagator.reset();
 		purge_ptr_vector(cols_to_add);
 		p.node->vars.append(vars_to_add);
 		p.local_cut_pool->rows_are_valid(false);
+		p.slack_pool.delete_rows();
 		if (p.param(BCP_lp_par::LpVerb_ColumnGenerationInfo))
 		    printf("LP:   %i variables added while restoring feasibility\n",
 			   static_cast<int>(vars_to_add.size()));
@@ -147,9 +149,11 @@ LP:   Fathoming node (discovered tdf & high cost)\n",
 		vars_to_add[i]->set_bcpind(-BCP_lp_next_var_index(p));
 	    }
 	    BCP_lp_add_cols_to_lp(cols_to_add, p.lp_solver);
+	    p.propagator.reset();
 	    purge_ptr_vector(cols_to_add);
 	    p.node->vars.append(vars_to_add);
 	    p.local_cut_pool->rows_are_valid(false);
+	    p.slack_pool.delete_rows();
 	    if (p.param(BCP_lp_par::LpVerb_ColumnGenerationInfo))
 		printf("LP:   %i variables added in price-out (not TDF :-( )\n",
 		       static_cast<int>(vars_to_add.size()));
@@ -174,7 +178,12 @@ void
 BCP_price_vars(BCP_lp_prob& p, const bool from_fathom,
 	       BCP_vec<BCP_var*>& vars_to_add, BCP_vec<BCP_col*>& cols_to_add)
 {
-    const BCP_lp_result& lpres = *p.lp_result;
+    // the stabilized duals (if any) are used only within var generation
+    const BCP_lp_result& lpres = from_fathom ?
+	*p.lp_result : p.stabilizer.pricing_result(*p.lp_result);
+
+    // collect the reports of this pricing round for the Lagrangian bound
+    p.lagrangian.start_round(p.user->pricer_num());
 
     bool generated_algo_var = false;
     const size_t to_add = vars_to_add.size();
@@ -187,6 +196,9 @@ BCP_price_vars(BCP_lp_prob& p, const bool from_fathom,
 	p.user->generate_vars_in_lp(lpres, p.node->vars, p.node->cuts,
 				    from_fathom, vars_to_add, cols_to_add);
     }
+    // the independent pricing subproblems of the user
+    BCP_lp_run_pricers(p, lpres, from_fathom, to_add,
+		       vars_to_add, cols_to_add);
     if (vars_to_add.size() > to_add) {
 	generated_algo_var = true;
 	if (cols_to_add.size() > to_add) {
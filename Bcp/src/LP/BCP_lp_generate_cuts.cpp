@@ -1,5 +1,8 @@
 // Copyright (C) 2000, International Business Machines
 // Corporation and others.  All Rights Reserved.
+#include <cstdio>
+#include <algorithm>
+
 #include "CoinTime.hpp"
 
 #include "BCP_lp_functions.hpp"
@@ -10,6 +13,77 @@
 #include "BCP_lp.hpp"
 #include "BCP_lp_node.hpp"
 
+/** Check the cuts in the slack pool that are valid at the current node
+    against the current primal solution and move the violated ones into the
+    local cut pool. The missing rows of the slack cuts are expanded in one
+    batch. (Whenever columns are added or deleted the rows are dropped, see
+    BCP_lp_slack_pool::delete_rows().) Return the number of cuts moved. */
+static int
+BCP_lp_recheck_slack_pool(BCP_lp_prob& p, const BCP_lp_result& lpres)
+{
+    BCP_lp_slack_pool& sp = p.slack_pool;
+    if (sp.size() == 0 ||
+	p.param(BCP_lp_par::SlackCutDiscardingStrategy) !=
+	BCP_DiscardSlackCutsLeastRecentlyUsed)
+	return 0;
+
+    int i;
+    const int size = sp.size();
+    BCP_vec<int> pos;
+    BCP_vec<BCP_cut*> cuts;
+    for (i = 0; i < size; ++i) {
+	BCP_cut* cut = sp.cut(i);
+	if (sp.row(i) == 0 && ! cut->is_to_be_removed() && sp.is_on_path(i)) {
+	    pos.push_back(i);
+	    cuts.push_back(cut);
+	}
+    }
+    if (cuts.size() > 0) {
+	BCP_vec<BCP_row*> rows;
+	rows.reserve(cuts.size());
+	p.user->cuts_to_rows(p.node->vars, cuts, rows,
+			     lpres, BCP_Object_Leftover, false);
+	if (rows.size() != cuts.size()) {
+	    throw BCP_fatal_error("\
+LP: uneven cuts/rows sizes when expanding the slack pool.\n");
+	}
+	const int num = pos.size();
+	for (i = 0; i < num; ++i)
+	    sp.set_row(pos[i], rows[i]);
+    }
+
+    double petol = 0.0;
+    p.lp_solver->getDblParam(OsiPrimalTolerance, petol);
+    const double* x = lpres.x();
+    BCP_lp_cut_pool& cp = *p.local_cut_pool;
+    int moved = 0;
+    // from the back since the last entry takes the place of a taken one
+    for (i = size - 1; i >= 0; --i) {
+	const BCP_row* row = sp.row(i);
+	if (row == 0)
+	    continue;
+	const double viol =
+	    BCP_row_violation(row->getIndices(), row->getElements(),
+			      row->getNumElements(),
+			      row->LowerBound(), row->UpperBound(), x);
+	sp.set_violation(i, viol, petol);
+	if (viol > petol) {
+	    BCP_cut* cut;
+	    BCP_row* wrow;
+	    sp.take(i, cut, wrow);
+	    cp.push_back(new BCP_lp_waiting_row(cut, wrow, viol));
+	    ++moved;
+	}
+    }
+    sp.tick();
+
+    if (p.param(BCP_lp_par::LpVerb_ReportLocalCutPoolSize))
+	printf("LP:   Number of violated cuts in the slack pool: %i\n", moved);
+    return moved;
+}
+
+//#############################################################################
+
 int BCP_lp_generate_cuts(BCP_lp_prob& p,
 			 bool varset_changed, const bool from_repricing)
 {
@@ -47,6 +121,14 @@ int BCP_lp_generate_cuts(BCP_lp_prob& p,
     if (p.param(BCP_lp_par::LpVerb_ReportLocalCutPoolSize))
 	printf("LP:   Number of leftover cuts: %i\n", prev_size);
 
+    // Recycle the slack cuts that are violated again. If there are any then
+    // the separation in the LP process is skipped in this iteration.
+    double time1 = CoinCpuTime();
+    const bool recycled =
+	BCP_lp_recheck_slack_pool(p, lpres) > 0;
+    p.stat.time_pool_checks += CoinCpuTime() - time1;
+    prev_size = cp.size();
+
     // Generate cuts within the LP process
     BCP_vec<BCP_cut*> new_cuts;
     BCP_vec<BCP_row*> new_rows;
@@ -55,10 +137,13 @@ int BCP_lp_generate_cuts(BCP_lp_prob& p,
 	new_rows = p.new_rows;
 	p.new_cuts.clear();
 	p.new_rows.clear();
-    } else {
+    } else if (! recycled) {
 	p.user->generate_cuts_in_lp(lpres, p.node->vars, p.node->cuts,
 				    new_cuts, new_rows);
     }
+    // the independent separators of the user
+    if (! recycled)
+	BCP_lp_run_separators(p, lpres, new_cuts, new_rows);
     if (new_cuts.size() > 0) {
 	const int new_size = new_cuts.size();
 	if (new_rows.size() != 0) {
@@ -90,7 +175,10 @@ LP: uneven new_cuts/new_rows sizes in generate_cuts_in_lp().\n");
     // Compute the violation for everything in the local cut pool and throw out
     // the ones not violated
     if (prev_size > 0) {
-	cp.compute_violations(lpres, cp.begin(), cp.end());
+	time1 = CoinCpuTime();
+	cp.compute_violations(lpres, cp.begin(), cp.end(),
+			      p.param(BCP_lp_par::CutViolationThreadNum));
+	p.stat.time_pool_checks += CoinCpuTime() - time1;
 	double petol = 0.0;
 	p.lp_solver->getDblParam(OsiPrimalTolerance, petol);
 	const int cnt = cp.remove_nonviolated(petol);
@@ -99,6 +187,9 @@ LP: uneven new_cuts/new_rows sizes in generate_cuts_in_lp().\n");
 	prev_size = cp.size();
     }
 
+    const bool check_pool =
+	! (p.node->iteration_count %
+	   p.param(BCP_lp_par::CutPoolCheckFrequency)) || varset_changed;
     if (p.param(BCP_lp_par::MessagePassingIsSerial)) {
 	// If the message passing environment is not really parallel (i.e.,
 	// while the CG/CP are working the LP stops and also the LP must
@@ -108,21 +199,35 @@ LP: uneven new_cuts/new_rows sizes in generate_cuts_in_lp().\n");
 	//  - at the beginning of a chain (but not in the root in the
 	//    first phase)
 	//  - or this is the cut_pool_check_freq-th iteration.
-	if (p.node->cg != -1 || p.node->cp != -1) {
-	    const BCP_message_tag msgtag = BCP_lp_pack_for_cg(p);
-	    if (p.node->cg != -1) {
-		++p.no_more_cuts_cnt;
-		p.msg_env->send(p.node->cg, msgtag, p.msg_buf);
-	    }
-	    if (p.node->cp != -1) {
-		if (! (p.node->iteration_count %
-		       p.param(BCP_lp_par::CutPoolCheckFrequency))
-		    || varset_changed) {
-		    ++p.no_more_cuts_cnt;
-		    p.msg_env->send(p.node->cp, msgtag, p.msg_buf);
-		}
-	    }
+	BCP_lp_send_for_cg(p, check_pool, false);
+    }
+
+    const bool async = p.param(BCP_lp_par::AsynchronousGeneration) &&
+	! p.param(BCP_lp_par::MessagePassingIsSerial);
+    if (async) {
+	// Pick up whatever the CG/CP have sent so far (possibly for earlier
+	// LP solutions) without waiting. If there is something to add then
+	// the LP is resolved right away and the CG/CP keep working in the
+	// background. Otherwise make sure they work on the current solution
+	// and wait for them as usual.
+	if (p.param(BCP_lp_par::CompareNewCutsToOldOnes))
+	    BCP_lp_build_cut_hash_index(p);
+	BCP_lp_receive_pending(p);
+	double petol = 0.0;
+	p.lp_solver->getDblParam(OsiPrimalTolerance, petol);
+	cp.remove_nonviolated(petol);
+	if (cp.size() > 0) {
+	    p.no_more_cuts_cnt = 0;
+	} else {
+	    BCP_lp_send_for_cg(p, check_pool, true);
 	}
+	prev_size = cp.size();
+    }
+
+    if (p.no_more_cuts_cnt > 0 &&
+	p.param(BCP_lp_par::CompareNewCutsToOldOnes)) {
+	// index the cuts we have so that the new ones can be checked quickly
+	BCP_lp_build_cut_hash_index(p);
     }
 
     if (p.no_more_cuts_cnt > 0){
@@ -139,8 +244,10 @@ LP: uneven new_cuts/new_rows sizes in generate_cuts_in_lp().\n");
 
 	while(true){
 	    p.msg_buf.clear();
+	    const double wait0 = CoinWallclockTime();
 	    p.msg_env->receive(BCP_AnyProcess, BCP_Msg_AnyMessage,
 			       p.msg_buf, tout);
+	    p.stat.time_waiting_cg += CoinWallclockTime() - wait0;
 	    if (p.msg_buf.msgtag() == BCP_Msg_NoMessage){
 		// check that everyone is still alive
 		if (! p.msg_env->alive(p.get_parent() /*tree_manager*/))
@@ -182,6 +289,7 @@ LP:   The VP has died -- LP exiting\n");
     }
     // reset no_more_cuts_cnt to 0
     p.no_more_cuts_cnt = 0;
+    p.cut_hash_index.deactivate();
 
     if (p.param(BCP_lp_par::LpVerb_ReportLocalCutPoolSize)) {
 	printf("LP:   Number of cuts received from CG: %i\n",
@@ -195,7 +303,9 @@ LP:   The VP has died -- LP exiting\n");
 	double petol = 0.0;
 	p.lp_solver->getDblParam(OsiPrimalTolerance, petol);
 	const int cnt = cp.remove_nonviolated(petol);
-	if (cnt > 0) {
+	// in asynchronous generation cuts generated for earlier solutions
+	// may arrive while waiting, those need not be violated
+	if (cnt > 0 && ! async) {
 	    printf("\
 LP: *WARNING*: There are nonviolated cuts in the local CP\n\
                at the end of cut generation.\n\
@@ -1,6 +1,7 @@
 // Copyright (C) 2000, International Business Machines
 // Corporation and others.  All Rights Reserved.
 #include <cstdio>
+#include <cmath>
 #include "CoinTime.hpp"
 #include "BCP_lp_functions.hpp"
 #include "BCP_enum.hpp"
@@ -10,6 +11,140 @@
 #include "BCP_lp.hpp"
 #include "BCP_lp_node.hpp"
 
+/** Send the dual solution to the variable pool and wait for its answer.
+    Return the number of vars received from the pool that have negative
+    reduced cost. */
+static int
+BCP_lp_price_from_var_pool(BCP_lp_prob& p, const bool cutset_changed)
+{
+   BCP_lp_var_pool& vp = *p.local_var_pool;
+   const int prev_size = vp.size();
+
+   if (p.param(BCP_lp_par::CompareNewVarsToOldOnes)) {
+      // index the vars we have so that the new ones can be checked quickly.
+      // In a serial environment the VP answers within the send, so this
+      // must be done first.
+      BCP_lp_build_var_hash_index(p);
+   }
+
+   const BCP_message_tag msgtag = BCP_lp_pack_for_vg(p);
+   ++p.no_more_vars_cnt;
+   BCP_lp_send_solution(p, p.node->vp, msgtag);
+
+   double detol = 0.0;
+   p.lp_solver->getDblParam(OsiDualTolerance, detol);
+
+   // In a parallel environment we wait until the VP answers. The VG may
+   // have the solution already and its vars may arrive meanwhile; those are
+   // not counted as vars from the pool.
+   int received_other = 0;
+   int cnt_other = 0;
+   const double all_vars_time_out = cutset_changed ?
+      p.param(BCP_lp_par::FirstLP_AllVarsTimeout) :
+      p.param(BCP_lp_par::LaterLP_AllVarsTimeout);
+   double tout = all_vars_time_out;
+   const double tin = CoinCpuTime();
+   while (p.no_more_vars_cnt > 0 && BCP_lp_is_busy(p, p.node->vp)) {
+      p.msg_buf.clear();
+      const double wait0 = CoinWallclockTime();
+      p.msg_env->receive(BCP_AnyProcess, BCP_Msg_AnyMessage, p.msg_buf, tout);
+      p.stat.time_waiting_vg += CoinWallclockTime() - wait0;
+      if (p.msg_buf.msgtag() == BCP_Msg_NoMessage) {
+	 if (! p.msg_env->alive(p.node->vp))
+	    throw BCP_fatal_error("LP:   The VP has died -- LP exiting\n");
+	 if (p.param(BCP_lp_par::LpVerb_ReportVarGenTimeout))
+	    printf("LP:   Receive vars from VP timed out after %f secs\n",
+		   all_vars_time_out);
+	 break;
+      }
+      const bool from_vp = p.msg_buf.sender() == p.node->vp;
+      const int old_size = vp.size();
+      p.process_message();
+      if (! from_vp) {
+	 const int new_size = vp.size();
+	 received_other += new_size - old_size;
+	 for (int i = old_size; i < new_size; ++i) {
+	    if (vp[i]->red_cost() < -detol)
+	       ++cnt_other;
+	 }
+      }
+      if (tout >= 0)
+	 tout = std::max<double>(0.0, all_vars_time_out - (CoinCpuTime()-tin));
+   }
+   p.var_hash_index.deactivate();
+
+   int cnt = -cnt_other;
+   for (int i = vp.size() - 1; i >= prev_size; --i) {
+      if (vp[i]->red_cost() < -detol)
+	 ++cnt;
+   }
+   if (p.param(BCP_lp_par::LpVerb_ReportLocalVarPoolSize))
+      printf("LP:   Number of vars received from VP: %i (%i price out)\n",
+	     static_cast<int>(vp.size()) - prev_size - received_other, cnt);
+   return cnt;
+}
+
+//#############################################################################
+
+void BCP_lp_stabilize_duals(BCP_lp_prob& p, const bool cutset_changed)
+{
+   // The stability center is meaningless if the rows have changed
+   if (cutset_changed)
+      p.stabilizer.reset();
+
+   const double alpha = p.param(BCP_lp_par::DualSmoothingFactor);
+   const double box = p.param(BCP_lp_par::DualBoxStepSize);
+   const bool async = p.param(BCP_lp_par::AsynchronousGeneration) &&
+      ! p.param(BCP_lp_par::MessagePassingIsSerial);
+   if ((alpha <= 0 && box <= 0) || async ||
+       p.node->colgen != BCP_GenerateColumns) {
+      p.stabilizer.end_round(*p.lp_result, false);
+      return;
+   }
+   p.stabilizer.start_round(*p.lp_solver, *p.lp_result, alpha, box);
+}
+
+//#############################################################################
+
+/** Compute the Lagrangian bound of the node from what the pricing has
+    reported and update the lower bound of the node. Return true if pricing
+    should stop at the node: the bound exceeds the upper bound, it is close
+    enough to the LP value or it has stalled. */
+static bool
+BCP_lp_check_lagrangian_bound(BCP_lp_prob& p, const BCP_lp_result& lpres)
+{
+   double bound;
+   if (! p.lagrangian.compute(lpres.objval(),
+			      p.param(BCP_lp_par::LagrangianStallImprovement),
+			      bound))
+      return false;
+   if (bound > p.node->true_lower_bound)
+      p.node->true_lower_bound = bound;
+   const bool verb = p.param(BCP_lp_par::LpVerb_ColumnGenerationInfo);
+   if (verb)
+      printf("LP:   Lagrangian bound: %.4f , LP value: %.4f\n",
+	     bound, lpres.objval());
+   if (p.over_ub(p.node->true_lower_bound))
+      return true;
+
+   const double gaptol = p.param(BCP_lp_par::LagrangianGapTolerance);
+   const double gap = lpres.objval() - p.lagrangian.best();
+   if (gaptol > 0 && gap <= gaptol * (1.0 + std::abs(lpres.objval()))) {
+      if (verb)
+	 printf("LP:   Lagrangian gap closed, stopping pricing.\n");
+      return true;
+   }
+   const int stall = p.param(BCP_lp_par::LagrangianStallRounds);
+   if (stall > 0 && p.lagrangian.stalled() >= stall) {
+      if (verb)
+	 printf("LP:   Lagrangian bound stalled, stopping pricing.\n");
+      return true;
+   }
+   return false;
+}
+
+//#############################################################################
+
 int BCP_lp_generate_vars(BCP_lp_prob& p,
 			 bool cutset_changed, const bool from_repricing)
 {
@@ -47,138 +182,210 @@ int BCP_lp_generate_vars(BCP_lp_prob& p,
    if (p.param(BCP_lp_par::LpVerb_ReportLocalVarPoolSize))
       printf("LP:   Number of leftover vars: %i\n", prev_size);
 
-   // Generate vars within the LP process
-   BCP_vec<BCP_var*> new_vars;
-   BCP_vec<BCP_col*> new_cols;
-   BCP_price_vars(p, false /* not from fathom */, new_vars, new_cols);
-   if (new_vars.size() > 0) {
-      const int new_size = new_vars.size();
-      vp.reserve(vp.size() + new_size);
-      for (int i = 0; i < new_size; ++i) {
-	 new_vars[i]->set_bcpind(-BCP_lp_next_var_index(p));
-	 vp.unchecked_push_back(new BCP_lp_waiting_col(new_vars[i],
-						       new_cols[i]));
-      }
-      new_cols.clear();
-      new_vars.clear();
-      if (p.param(BCP_lp_par::LpVerb_ReportLocalVarPoolSize))
-	 printf("LP:   Number of vars generated in the LP process: %i\n",
-		new_size);
+   // Price the columns stored in the variable pool first. If some of them
+   // price out then the pricing of the user (in this process and in the VG)
+   // is skipped in this iteration.
+   bool vp_priced_out = false;
+   if (p.node->vp != -1 &&
+       (! (p.node->iteration_count %
+	   p.param(BCP_lp_par::VarPoolCheckFrequency))
+	|| cutset_changed)) {
+      vp_priced_out = BCP_lp_price_from_var_pool(p, cutset_changed) > 0;
       prev_size = vp.size();
    }
 
-   // Compute the reduced cost for everything in the local var pool and throw
-   // out the ones with positive reduced cost
-   if (prev_size > 0) {
-      vp.compute_red_costs(lpres, vp.begin(), vp.end());
-      //      char dumpname[200];
-      //sprintf(dumpname, "reducedcosts-%i-%i",
-      //      p.node->index, p.node->iteration_count);
-      //FILE* dumpfile = fopen(dumpname, "w");
-      //for (int i = 0; i < prev_size; ++i) {
-      //	 fprintf(dumpfile, "%.6f\n", vp[i]->red_cost());
-      //}
-      //fclose(dumpfile);
-      double detol = 0.0;
-      p.lp_solver->getDblParam(OsiDualTolerance, detol);
-      const int cnt = vp.remove_positives(detol);
-      if (p.param(BCP_lp_par::LpVerb_ReportLocalVarPoolSize))
-	 printf("LP:   Positive rc (hence removed): %i\n", cnt);
-      prev_size = vp.size();
-   }
+   const bool async = p.param(BCP_lp_par::AsynchronousGeneration) &&
+      ! p.param(BCP_lp_par::MessagePassingIsSerial);
 
-   if (p.param(BCP_lp_par::MessagePassingIsSerial)) {
-      // If the message passing environment is not really parallel (i.e., while
-      // the VG/VP are working the LP stops and also the LP must immediately
-      // process any vars sent back then this is the place to send the lp
-      // solution to the VG/VP.
-      // send the current solution to VG, and also to VP if we are either
-      //  - at the beginning of a chain (but not in the root in the
-      //    first phase)
-      //  - or this is the var_pool_check_freq-th iteration.
-      if (p.node->vg != -1 || p.node->vp != -1) {
-	 const BCP_message_tag msgtag = BCP_lp_pack_for_vg(p);
-	 if (p.node->vg != -1) {
-	    ++p.no_more_vars_cnt;
-	    p.msg_env->send(p.node->vg, msgtag, p.msg_buf);
+   // Price (in the LP process and in the VG). With dual stabilization
+   // the vars are generated for the stabilized duals, but only those
+   // pricing out with the LP duals are kept. If there are none then
+   // pricing is repeated with less stabilized duals.
+   while (true) {
+      // Generate vars within the LP process
+      BCP_vec<BCP_var*> new_vars;
+      BCP_vec<BCP_col*> new_cols;
+      if (! vp_priced_out)
+	 BCP_price_vars(p, false /* not from fathom */, new_vars, new_cols);
+      if (new_vars.size() > 0) {
+	 const int new_size = new_vars.size();
+	 vp.reserve(vp.size() + new_size);
+	 for (int i = 0; i < new_size; ++i) {
+	    new_vars[i]->set_bcpind(-BCP_lp_next_var_index(p));
+	    vp.unchecked_push_back(new BCP_lp_waiting_col(new_vars[i],
+							  new_cols[i]));
 	 }
-	 if (p.node->vp != -1) {
-	    if (! (p.node->iteration_count %
-		   p.param(BCP_lp_par::VarPoolCheckFrequency))
-		|| cutset_changed) {
-	       ++p.no_more_vars_cnt;
-	       p.msg_env->send(p.node->vp, msgtag, p.msg_buf);
-	    }
+	 new_cols.clear();
+	 new_vars.clear();
+	 if (p.param(BCP_lp_par::LpVerb_ReportLocalVarPoolSize))
+	    printf("LP:   Number of vars generated in the LP process: %i\n",
+		   new_size);
+	 prev_size = vp.size();
+      }
+
+      // Compute the reduced cost for everything in the local var pool and
+      // throw out the ones with positive reduced cost
+      if (prev_size > 0) {
+	 double detol = 0.0;
+	 p.lp_solver->getDblParam(OsiDualTolerance, detol);
+	 const int partial = p.param(BCP_lp_par::VarPoolPartialPricingNum);
+	 const double time1 = CoinCpuTime();
+	 if (partial > 0) {
+	    vp.compute_red_costs_partially(lpres, detol, partial);
+	 } else {
+	    vp.compute_red_costs(lpres, vp.begin(), vp.end());
 	 }
+	 p.stat.time_pool_checks += CoinCpuTime() - time1;
+	 //      char dumpname[200];
+	 //sprintf(dumpname, "reducedcosts-%i-%i",
+	 //      p.node->index, p.node->iteration_count);
+	 //FILE* dumpfile = fopen(dumpname, "w");
+	 //for (int i = 0; i < prev_size; ++i) {
+	 //         fprintf(dumpfile, "%.6f\n", vp[i]->red_cost());
+	 //}
+	 //fclose(dumpfile);
+	 const int cnt = vp.remove_positives(detol);
+	 if (p.param(BCP_lp_par::LpVerb_ReportLocalVarPoolSize))
+	    printf("LP:   Positive rc (hence removed): %i\n", cnt);
+	 prev_size = vp.size();
       }
-   }
 
-   if (p.no_more_vars_cnt > 0){
-      // Receive vars if we have sent out the lp solution somewhere.
-      // set the timeout (all the times are in microseconds).
-      double first_var_time_out = cutset_changed ?
-	 p.param(BCP_lp_par::FirstLP_FirstVarTimeout) :
-	 p.param(BCP_lp_par::LaterLP_FirstVarTimeout);
-      double all_vars_time_out = cutset_changed ?
-	 p.param(BCP_lp_par::FirstLP_AllVarsTimeout) :
-	 p.param(BCP_lp_par::LaterLP_AllVarsTimeout);
-      double tout = vp.size() == 0 ? first_var_time_out : all_vars_time_out;
-      double tin = CoinCpuTime();
-
-      while(true){
-	 p.msg_buf.clear();
-	 p.msg_env->receive(BCP_AnyProcess, BCP_Msg_AnyMessage,
-			    p.msg_buf, tout);
-	 if (p.msg_buf.msgtag() == BCP_Msg_NoMessage){
-	    // check that everyone is still alive
-	    if (! p.msg_env->alive(p.get_parent() /*tree_manager*/))
-	       throw BCP_fatal_error("LP:   The TM has died -- LP exiting\n");
-	    if (p.node->cg != -1 && ! p.msg_env->alive(p.node->cg))
-	       throw BCP_fatal_error("LP:   The CG has died -- LP exiting\n");
-	    if (p.node->cp != -1 && ! p.msg_env->alive(p.node->cp))
-	       throw BCP_fatal_error("LP:   The CP has died -- LP exiting\n");
-	    if (p.node->vg != -1 && ! p.msg_env->alive(p.node->vg))
-	       throw BCP_fatal_error("LP:   The VG has died -- LP exiting\n");
-	    if (p.node->vp != -1 && ! p.msg_env->alive(p.node->vp))
-	       throw BCP_fatal_error("LP:   The VP has died -- LP exiting\n");
-	    // now the message queue is empty and received_message has
-	    // returned, i.e., we have waited enough
-	    if (p.param(BCP_lp_par::LpVerb_ReportVarGenTimeout))
-	       printf("LP:   Receive vars timed out after %f secs\n",
-		      (prev_size != static_cast<int>(vp.size())?
-		       all_vars_time_out : first_var_time_out));
-	    break;
+      if (p.param(BCP_lp_par::MessagePassingIsSerial)) {
+	 // If the message passing environment is not really parallel (i.e.,
+	 // while the VG is working the LP stops and also the LP must
+	 // immediately process any vars sent back then this is the place to
+	 // send the lp solution to the VG (unless the VP has already provided
+	 // vars). The VP has been queried above.
+	 if (! vp_priced_out)
+	    BCP_lp_send_for_vg(p, false);
+      }
+
+      if (async) {
+	 // Pick up whatever the VG has sent so far (possibly for earlier LP
+	 // solutions) without waiting. If there is something to add then
+	 // the LP is resolved right away and the VG keeps working in the
+	 // background. Otherwise make sure it works on the current solution
+	 // and wait for it as usual.
+	 if (p.param(BCP_lp_par::CompareNewVarsToOldOnes))
+	    BCP_lp_build_var_hash_index(p);
+	 BCP_lp_receive_pending(p);
+	 double detol = 0.0;
+	 p.lp_solver->getDblParam(OsiDualTolerance, detol);
+	 vp.remove_positives(detol);
+	 if (vp.size() > 0) {
+	    p.no_more_vars_cnt = 0;
+	 } else if (! vp_priced_out) {
+	    BCP_lp_send_for_vg(p, true);
 	 }
-	 p.process_message();
-	 // break out if no more vars can come
-	 if (p.no_more_vars_cnt == 0)
-	    break;
-
-	 // reset the timeout
-	 tout = vp.size() == 0 ? first_var_time_out : all_vars_time_out;
-	 if (tout >= 0){
-	    // with this tout we'll read out the rest of the message queue
-	    // even if var generation times out.
-	    tout = std::max<double>(0.0, tout - (CoinCpuTime() - tin));
+	 prev_size = vp.size();
+      }
+
+      if (p.no_more_vars_cnt > 0 &&
+	  p.param(BCP_lp_par::CompareNewVarsToOldOnes)) {
+	 // index the vars we have so that the new ones can be checked quickly
+	 BCP_lp_build_var_hash_index(p);
+      }
+
+      if (p.no_more_vars_cnt > 0){
+	 // Receive vars if we have sent out the lp solution somewhere.
+	 // set the timeout (all the times are in microseconds).
+	 double first_var_time_out = cutset_changed ?
+	    p.param(BCP_lp_par::FirstLP_FirstVarTimeout) :
+	    p.param(BCP_lp_par::LaterLP_FirstVarTimeout);
+	 double all_vars_time_out = cutset_changed ?
+	    p.param(BCP_lp_par::FirstLP_AllVarsTimeout) :
+	    p.param(BCP_lp_par::LaterLP_AllVarsTimeout);
+	 double tout =
+	    vp.size() == 0 ? first_var_time_out : all_vars_time_out;
+	 double tin = CoinCpuTime();
+
+	 while(true){
+	    p.msg_buf.clear();
+	    const double wait0 = CoinWallclockTime();
+	    p.msg_env->receive(BCP_AnyProcess, BCP_Msg_AnyMessage,
+			       p.msg_buf, tout);
+	    p.stat.time_waiting_vg += CoinWallclockTime() - wait0;
+	    if (p.msg_buf.msgtag() == BCP_Msg_NoMessage){
+	       // check that everyone is still alive
+	       if (! p.msg_env->alive(p.get_parent() /*tree_manager*/))
+		  throw BCP_fatal_error("LP:   The TM has died -- LP exiting\n");
+	       if (p.node->cg != -1 && ! p.msg_env->alive(p.node->cg))
+		  throw BCP_fatal_error("LP:   The CG has died -- LP exiting\n");
+	       if (p.node->cp != -1 && ! p.msg_env->alive(p.node->cp))
+		  throw BCP_fatal_error("LP:   The CP has died -- LP exiting\n");
+	       if (p.node->vg != -1 && ! p.msg_env->alive(p.node->vg))
+		  throw BCP_fatal_error("LP:   The VG has died -- LP exiting\n");
+	       if (p.node->vp != -1 && ! p.msg_env->alive(p.node->vp))
+		  throw BCP_fatal_error("LP:   The VP has died -- LP exiting\n");
+	       // now the message queue is empty and received_message has
+	       // returned, i.e., we have waited enough
+	       if (p.param(BCP_lp_par::LpVerb_ReportVarGenTimeout))
+		  printf("LP:   Receive vars timed out after %f secs\n",
+			 (prev_size != static_cast<int>(vp.size())?
+			  all_vars_time_out : first_var_time_out));
+	       break;
+	    }
+	    p.process_message();
+	    // break out if no more vars can come
+	    if (p.no_more_vars_cnt == 0)
+	       break;
+
+	    // reset the timeout
+	    tout = vp.size() == 0 ? first_var_time_out : all_vars_time_out;
+	    if (tout >= 0){
+	       // with this tout we'll read out the rest of the message queue
+	       // even if var generation times out.
+	       tout = std::max<double>(0.0, tout - (CoinCpuTime() - tin));
+	    }
 	 }
       }
+      // reset no_more_vars_cnt to 0
+      p.no_more_vars_cnt = 0;
+      p.var_hash_index.deactivate();
+
+      if (p.param(BCP_lp_par::LpVerb_ReportLocalVarPoolSize)) {
+	 printf("LP:   Number of vars received from VG: %i\n",
+		static_cast<int>(vp.size() - prev_size));
+	 printf("LP:   Total number of vars in local pool: %i\n",
+		static_cast<int>(vp.size()));
+      }
+
+      if (! p.stabilizer.active())
+	 break;
+      double detol = 0.0;
+      p.lp_solver->getDblParam(OsiDualTolerance, detol);
+      vp.remove_positives(detol);
+      prev_size = vp.size();
+      if (prev_size > 0 || ! p.stabilizer.misprice(*p.lp_solver, lpres))
+	 break;
+      if (p.param(BCP_lp_par::LpVerb_ColumnGenerationInfo))
+	 printf("LP:   Mispricing with stabilized duals (%i), alpha: %.3f\n",
+		p.stabilizer.misprices(), p.stabilizer.alpha());
+      vp_priced_out = false;
+      if (! p.param(BCP_lp_par::MessagePassingIsSerial)) {
+	 // in the serial case the new duals are sent in the loop
+	 BCP_lp_send_for_vg(p, false);
+      }
    }
-   // reset no_more_vars_cnt to 0
-   p.no_more_vars_cnt = 0;
-
-   if (p.param(BCP_lp_par::LpVerb_ReportLocalVarPoolSize)) {
-      printf("LP:   Number of vars received from VG: %i\n",
-	     static_cast<int>(vp.size() - prev_size));
-      printf("LP:   Total number of vars in local pool: %i\n",
-	     static_cast<int>(vp.size()));
+   // The Lagrangian bound is valid only if the last pricing was done by the
+   // user with the LP duals
+   if (! vp_priced_out && ! p.stabilizer.active() &&
+       p.node->colgen == BCP_GenerateColumns &&
+       (lpres.termcode() & BCP_ProvenOptimal)) {
+      if (BCP_lp_check_lagrangian_bound(p, lpres))
+	 purge_ptr_vector(vp);
    }
+   p.stabilizer.end_round(lpres, vp.size() > 0);
 
    if (vp.size() > 0) {
       const int oldsize = vp.size();
       double detol = 0.0;
       p.lp_solver->getDblParam(OsiDualTolerance, detol);
       const int cnt = vp.remove_positives(detol);
-      if (cnt > 0) {
+      // in asynchronous generation vars generated for earlier solutions may
+      // arrive while waiting, those need not price out
+      if (cnt > 0 && ! async && p.param(BCP_lp_par::DualSmoothingFactor) <= 0
+	  && p.param(BCP_lp_par::DualBoxStepSize) <= 0) {
 	 printf("\
 LP: *WARNING*: There are vars with positive red cost in the local VP\n\
                at the end of var generation.\n\
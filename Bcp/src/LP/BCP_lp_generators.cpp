@@ -0,0 +1,280 @@
+// Copyright (C) 2000, International Business Machines
+// Corporation and others.  All Rights Reserved.
+#include <algorithm>
+#include <cstdio>
+#include <exception>
+#include <string>
+
+#include "BcpConfig.h"
+#ifdef HAVE_PTHREAD_H
+#include <pthread.h>
+#endif
+
+#include "BCP_error.hpp"
+#include "BCP_matrix.hpp"
+#include "BCP_lp_result.hpp"
+#include "BCP_lp_user.hpp"
+#include "BCP_lp.hpp"
+#include "BCP_lp_node.hpp"
+#include "BCP_lp_functions.hpp"
+
+//#############################################################################
+
+/** The data a separator/pricer thread works with. The threads pick the next
+    separator (pricer) to run under the protection of a mutex and store the
+    results in the slot of that separator (pricer). Thus the merged result
+    does not depend on which thread ran what. */
+struct BCP_lp_generator_thread_data {
+    BCP_lp_user* user;
+    const BCP_lp_result* lpres;
+    const BCP_vec<BCP_var*>* vars;
+    const BCP_vec<BCP_cut*>* cuts;
+    bool pricing;
+    bool before_fathom;
+    int job_num;
+    int* next_job;
+#ifdef HAVE_PTHREAD_H
+    pthread_mutex_t* mutex;
+#endif
+    BCP_vec< BCP_vec<BCP_cut*> >* new_cuts;
+    BCP_vec< BCP_vec<BCP_row*> >* new_rows;
+    BCP_vec< BCP_vec<BCP_var*> >* new_vars;
+    BCP_vec< BCP_vec<BCP_col*> >* new_cols;
+    /** The error message of each separator (pricer) that failed, empty for
+	the others */
+    BCP_vec<std::string>* errors;
+};
+
+//-----------------------------------------------------------------------------
+
+static void*
+BCP_lp_generator_thread(void* arg)
+{
+    BCP_lp_generator_thread_data& d =
+	*static_cast<BCP_lp_generator_thread_data*>(arg);
+    while (true) {
+#ifdef HAVE_PTHREAD_H
+	if (d.mutex)
+	    pthread_mutex_lock(d.mutex);
+#endif
+	const int job = (*d.next_job)++;
+#ifdef HAVE_PTHREAD_H
+	if (d.mutex)
+	    pthread_mutex_unlock(d.mutex);
+#endif
+	if (job >= d.job_num)
+	    break;
+	try {
+	    if (d.pricing) {
+		d.user->run_pricer(job, *d.lpres, *d.vars, *d.cuts,
+				   d.before_fathom,
+				   (*d.new_vars)[job], (*d.new_cols)[job]);
+	    } else {
+		d.user->run_separator(job, *d.lpres, *d.vars, *d.cuts,
+				      (*d.new_cuts)[job], (*d.new_rows)[job]);
+	    }
+	}
+	catch (BCP_fatal_error& err) {
+	    // an exception must not leave the thread; the main thread
+	    // throws once every thread is finished.
+	    (*d.errors)[job] = err.what();
+	    if ((*d.errors)[job].empty())
+		(*d.errors)[job] = "BCP_fatal_error";
+	}
+	catch (std::exception& err) {
+	    // the same for anything else a user generator may throw
+	    (*d.errors)[job] = err.what();
+	    if ((*d.errors)[job].empty())
+		(*d.errors)[job] = "std::exception";
+	}
+	catch (...) {
+	    (*d.errors)[job] = "unknown exception";
+	}
+    }
+    return 0;
+}
+
+//-----------------------------------------------------------------------------
+
+/** Run the <code>d.job_num</code> separators (pricers) described in
+    <code>d</code>, on several threads if the \c GeneratorThreadNum parameter
+    says so. */
+static void
+BCP_lp_run_generators(BCP_lp_prob& p, BCP_lp_generator_thread_data& d)
+{
+    int next_job = 0;
+    d.next_job = &next_job;
+    BCP_vec<std::string> errors(d.job_num, std::string());
+    d.errors = &errors;
+
+#ifdef HAVE_PTHREAD_H
+    d.mutex = 0;
+    const int thread_num =
+	std::min<int>(p.param(BCP_lp_par::GeneratorThreadNum), d.job_num);
+    if (thread_num > 1) {
+	pthread_mutex_t mutex;
+	pthread_mutex_init(&mutex, NULL);
+	d.mutex = &mutex;
+	BCP_vec<BCP_lp_generator_thread_data> data(thread_num, d);
+	BCP_vec<pthread_t> threads(thread_num, pthread_t());
+	BCP_vec<bool> started(thread_num, false);
+	int t;
+	for (t = 0; t < thread_num; ++t) {
+	    started[t] = pthread_create(&threads[t], NULL,
+					BCP_lp_generator_thread, &data[t]) == 0;
+	}
+	for (t = 0; t < thread_num; ++t) {
+	    if (started[t]) {
+		pthread_join(threads[t], NULL);
+	    } else {
+		// could not create the thread. Do its work here, it just picks
+		// up whatever jobs are left over.
+		BCP_lp_generator_thread(&data[t]);
+	    }
+	}
+	pthread_mutex_destroy(&mutex);
+	d.mutex = 0;
+    } else
+#endif
+    {
+	BCP_lp_generator_thread(&d);
+    }
+
+    std::string msg;
+    for (int job = 0; job < d.job_num; ++job) {
+	if (errors[job].empty())
+	    continue;
+	char head[100];
+	sprintf(head, "LP: %s %i failed: ",
+		d.pricing ? "run_pricer()" : "run_separator()", job);
+	msg += head;
+	msg += errors[job];
+	if (msg[msg.length() - 1] != '\n')
+	    msg += '\n';
+    }
+    if (! msg.empty())
+	throw BCP_fatal_error(msg);
+}
+
+//#############################################################################
+
+void
+BCP_lp_run_separators(BCP_lp_prob& p, const BCP_lp_result& lpres,
+		      BCP_vec<BCP_cut*>& new_cuts, BCP_vec<BCP_row*>& new_rows)
+{
+    const int sep_num = p.user->separator_num();
+    if (sep_num <= 0)
+	return;
+
+    BCP_vec< BCP_vec<BCP_cut*> > sep_cuts(sep_num, BCP_vec<BCP_cut*>());
+    BCP_vec< BCP_vec<BCP_row*> > sep_rows(sep_num, BCP_vec<BCP_row*>());
+
+    BCP_lp_generator_thread_data d;
+    d.user = p.user;
+    d.lpres = &lpres;
+    d.vars = &p.node->vars;
+    d.cuts = &p.node->cuts;
+    d.pricing = false;
+    d.before_fathom = false;
+    d.job_num = sep_num;
+    d.new_cuts = &sep_cuts;
+    d.new_rows = &sep_rows;
+    d.new_vars = 0;
+    d.new_cols = 0;
+    BCP_lp_run_generators(p, d);
+
+    // The rows of the cuts already in new_cuts must be there before the
+    // rows of the separators are appended.
+    if (new_rows.size() != new_cuts.size()) {
+	if (new_rows.size() != 0) {
+	    throw BCP_fatal_error("\
+LP: uneven new_cuts/new_rows sizes in generate_cuts_in_lp().\n");
+	}
+	p.user->cuts_to_rows(p.node->vars, new_cuts, new_rows,
+			     lpres, BCP_Object_FromGenerator, false);
+    }
+
+    // merge the results in the order of the separators
+    for (int i = 0; i < sep_num; ++i) {
+	BCP_vec<BCP_cut*>& cuts = sep_cuts[i];
+	BCP_vec<BCP_row*>& rows = sep_rows[i];
+	if (cuts.size() == 0)
+	    continue;
+	if (rows.size() == 0) {
+	    p.user->cuts_to_rows(p.node->vars, cuts, rows,
+				 lpres, BCP_Object_FromGenerator, false);
+	}
+	if (rows.size() != cuts.size()) {
+	    throw BCP_fatal_error("\
+LP: uneven new_cuts/new_rows sizes in run_separator().\n");
+	}
+	new_cuts.append(cuts);
+	new_rows.append(rows);
+    }
+}
+
+//#############################################################################
+
+void
+BCP_lp_run_pricers(BCP_lp_prob& p, const BCP_lp_result& lpres,
+		   const bool before_fathom, const int first,
+		   BCP_vec<BCP_var*>& new_vars, BCP_vec<BCP_col*>& new_cols)
+{
+    const int pricer_num = p.user->pricer_num();
+    if (pricer_num <= 0)
+	return;
+
+    BCP_vec< BCP_vec<BCP_var*> > pricer_vars(pricer_num,
+					     BCP_vec<BCP_var*>());
+    BCP_vec< BCP_vec<BCP_col*> > pricer_cols(pricer_num,
+					     BCP_vec<BCP_col*>());
+
+    BCP_lp_generator_thread_data d;
+    d.user = p.user;
+    d.lpres = &lpres;
+    d.vars = &p.node->vars;
+    d.cuts = &p.node->cuts;
+    d.pricing = true;
+    d.before_fathom = before_fathom;
+    d.job_num = pricer_num;
+    d.new_cuts = 0;
+    d.new_rows = 0;
+    d.new_vars = &pricer_vars;
+    d.new_cols = &pricer_cols;
+    // the pricers report on the subproblems the round was started with
+    p.lagrangian.fix_subproblem_num(true);
+    BCP_lp_run_generators(p, d);
+    p.lagrangian.fix_subproblem_num(false);
+
+    // The columns of the vars already in new_vars (from position first on)
+    // must be there before the columns of the pricers are appended.
+    if (new_cols.size() != new_vars.size()) {
+	if (static_cast<int>(new_cols.size()) != first) {
+	    throw BCP_fatal_error("\
+LP: uneven new_vars/new_cols sizes in generate_vars_in_lp().\n");
+	}
+	BCP_vec<BCP_var*> vars(new_vars.entry(first), new_vars.end());
+	BCP_vec<BCP_col*> cols;
+	p.user->vars_to_cols(p.node->cuts, vars, cols,
+			     lpres, BCP_Object_FromGenerator, false);
+	new_cols.append(cols);
+    }
+
+    // merge the results in the order of the pricers
+    for (int i = 0; i < pricer_num; ++i) {
+	BCP_vec<BCP_var*>& vars = pricer_vars[i];
+	BCP_vec<BCP_col*>& cols = pricer_cols[i];
+	if (vars.size() == 0)
+	    continue;
+	if (cols.size() == 0) {
+	    p.user->vars_to_cols(p.node->cuts, vars, cols,
+				 lpres, BCP_Object_FromGenerator, false);
+	}
+	if (cols.size() != vars.size()) {
+	    throw BCP_fatal_error("\
+LP: uneven new_vars/new_cols sizes in run_pricer().\n");
+	}
+	new_vars.append(vars);
+	new_cols.append(cols);
+    }
+}
@@ -0,0 +1,102 @@
+// Copyright (C) 2000, International Business Machines
+// Corporation and others.  All Rights Reserved.
+#include <cmath>
+
+#include "BCP_lp_lagrangian.hpp"
+
+//#############################################################################
+
+void
+BCP_lp_lagrangian_bound::start_round(const int subproblem_num)
+{
+    _reported.clear();
+    _min_rc.clear();
+    _multiplicity.clear();
+    _min_rc_ratio.clear();
+    _rejected = false;
+    if (subproblem_num > 0) {
+	_reported.insert(_reported.end(), subproblem_num, 0);
+	_min_rc.insert(_min_rc.end(), subproblem_num, 0.0);
+	_multiplicity.insert(_multiplicity.end(), subproblem_num, 0.0);
+	_min_rc_ratio.insert(_min_rc_ratio.end(), subproblem_num, 0.0);
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void
+BCP_lp_lagrangian_bound::report(const int subproblem, const double min_rc,
+				const double multiplicity,
+				const double min_rc_ratio)
+{
+    if (subproblem < 0)
+	return;
+    const int size = _reported.size();
+    if (subproblem >= size) {
+	if (_fixed) {
+	    // resizing could race with the other pricers
+	    _rejected = true;
+	    return;
+	}
+	const int add = subproblem + 1 - size;
+	_reported.insert(_reported.end(), add, 0);
+	_min_rc.insert(_min_rc.end(), add, 0.0);
+	_multiplicity.insert(_multiplicity.end(), add, 0.0);
+	_min_rc_ratio.insert(_min_rc_ratio.end(), add, 0.0);
+    }
+    _reported[subproblem] = 1;
+    _min_rc[subproblem] = min_rc;
+    _multiplicity[subproblem] = multiplicity;
+    _min_rc_ratio[subproblem] = min_rc_ratio;
+}
+
+//-----------------------------------------------------------------------------
+
+bool
+BCP_lp_lagrangian_bound::compute(const double lp_objval,
+				 const double improvement, double& bound)
+{
+    // Every subproblem the round was started with (and every one reported
+    // beyond those) must have reported, otherwise there is no bound.
+    const int size = _reported.size();
+    if (size == 0 || _rejected)
+	return false;
+    int i;
+    for (i = 0; i < size; ++i) {
+	if (! _reported[i])
+	    return false;
+    }
+
+    bool farley = lp_objval >= 0;
+    double lagr = lp_objval;
+    double min_ratio = 0.0;
+    for (i = 0; i < size; ++i) {
+	if (_min_rc[i] < 0) {
+	    if (_multiplicity[i] >= BCP_DBL_MAX) {
+		lagr = -BCP_DBL_MAX;
+	    } else if (lagr > -BCP_DBL_MAX) {
+		lagr += _multiplicity[i] * _min_rc[i];
+	    }
+	}
+	if (_min_rc_ratio[i] <= -BCP_DBL_MAX) {
+	    farley = false;
+	} else if (_min_rc_ratio[i] < min_ratio) {
+	    min_ratio = _min_rc_ratio[i];
+	}
+    }
+    bound = lagr;
+    if (farley) {
+	const double fb = lp_objval / (1.0 - min_ratio);
+	if (fb > bound)
+	    bound = fb;
+    }
+
+    if (bound > _best + improvement * (1.0 + std::abs(_best))) {
+	_stalled = 0;
+    } else {
+	++_stalled;
+    }
+    if (bound > _best)
+	_best = bound;
+    return true;
+}
@@ -1,6 +1,8 @@
 // Copyright (C) 2000, International Business Machines
 // Corporation and others.  All Rights Reserved.
 #include <cstdio>
+#include <cmath>
+#include <algorithm>
 #include "CoinTime.hpp"
 #include "BCP_message.hpp"
 #include "BCP_error.hpp"
@@ -12,7 +14,115 @@
 #include "BCP_warmstart.hpp"
 #include "BCP_solution.hpp"
 
-void BCP_lp_main_loop(BCP_lp_prob& p)
+//#############################################################################
+
+/** Resolve the LP relaxation. If the \c ResolveIterationChunk parameter is
+    set then do it in chunks and poll for a new upper bound in between: a
+    better upper bound tightens the dual objective limit and the solver
+    stops as soon as the limit is reached instead of finishing the solve. */
+static void
+BCP_lp_resolve(BCP_lp_prob& p)
+{
+    OsiSolverInterface& lp = *p.lp_solver;
+    const int chunk = p.param(BCP_lp_par::ResolveIterationChunk);
+    if (chunk <= 0 || p.node->colgen == BCP_GenerateColumns) {
+	lp.resolve();
+	return;
+    }
+
+    int maxiter;
+    lp.getIntParam(OsiMaxNumIteration, maxiter);
+    int iternum = 0;
+    while (true) {
+	lp.setIntParam(OsiMaxNumIteration, std::min(chunk, maxiter - iternum));
+	lp.resolve();
+	iternum += lp.getIterationCount();
+	if (! lp.isIterationLimitReached() || iternum >= maxiter)
+	    break;
+	// this updates the dual objective limit if a better UB has arrived
+	BCP_lp_check_ub(p);
+	if (lp.isDualObjectiveLimitReached())
+	    break;
+    }
+    lp.setIntParam(OsiMaxNumIteration, maxiter);
+}
+
+//#############################################################################
+
+/** Decide whether the heuristic (BCP_lp_user::generate_heuristic_solution())
+    should be invoked in the current iteration (see the
+    <code>Heuristic*</code> parameters) and record the decision in the
+    statistics. */
+static bool
+BCP_lp_heuristic_is_due(BCP_lp_prob& p, const BCP_lp_result& lpres)
+{
+    BCP_lp_statistics& stat = p.stat;
+
+    const int freq = p.param(BCP_lp_par::HeuristicFrequency);
+    if (freq > 1 && (p.node->iteration_count - 1) % freq != 0) {
+	++stat.heur_skipped_frequency;
+	return false;
+    }
+
+    const int depth = p.node->level;
+    const int max_depth = p.param(BCP_lp_par::HeuristicMaxDepth);
+    if (max_depth >= 0 && depth > max_depth) {
+	++stat.heur_skipped_depth;
+	return false;
+    }
+
+    const double min_gap = p.param(BCP_lp_par::HeuristicMinGap);
+    if (min_gap > 0 && p.has_ub()) {
+	const double ub = p.ub();
+	const double gap = (ub - lpres.objval()) / std::max(1.0, fabs(ub));
+	if (gap < min_gap) {
+	    ++stat.heur_skipped_gap;
+	    return false;
+	}
+    }
+
+    const double max_frac = p.param(BCP_lp_par::HeuristicMaxTimeFraction);
+    if (max_frac < 1.0 && stat.time_heuristics > max_frac * CoinCpuTime()) {
+	++stat.heur_skipped_time;
+	return false;
+    }
+
+    stat.heur_extend_to_depth(depth);
+    const int chance = stat.heur_chances_by_depth[depth]++;
+    if (! p.param(BCP_lp_par::HeuristicAdaptive))
+	return true;
+
+    // Throttle the calls at this depth if the heuristic rarely succeeds
+    // here. Every interval-th opportunity is still taken, so the success
+    // rate keeps being sampled.
+    const int calls = stat.heur_calls_by_depth[depth];
+    if (calls < p.param(BCP_lp_par::HeuristicAdaptiveMinCalls))
+	return true;
+    const double rate =
+	static_cast<double>(stat.heur_successes_by_depth[depth]) / calls;
+    const double min_rate =
+	p.param(BCP_lp_par::HeuristicAdaptiveMinSuccessRate);
+    if (rate >= min_rate)
+	return true;
+    // a non-positive maximum interval means no throttling at all
+    const int max_interval =
+	std::max<int>(1, p.param(BCP_lp_par::HeuristicAdaptiveMaxInterval));
+    const int interval = rate > 0 ?
+	std::min(max_interval, static_cast<int>(ceil(min_rate / rate))) :
+	max_interval;
+    if (chance % interval == 0)
+	return true;
+    ++stat.heur_skipped_adaptive;
+    return false;
+}
+
+//#############################################################################
+
+/** Process the search tree node received from the TM and the nodes the LP
+    process dives into from there. <code>nodeStart</code> is the time the
+    node currently processed was started. */
+static void
+BCP_lp_process_nodes(BCP_lp_prob& p, double& nodeStart)
 {
     BCP_lp_result& lpres = *p.lp_result;
     // argument flag for a number of functions. of course, here we invoke those
@@ -28,12 +138,11 @@ void BCP_lp_main_loop(BCP_lp_prob& p)
     bool cutset_changed = true;
     double time0;
 
-    double nodeStart = CoinCpuTime();
-
     p.user->print(p.param(BCP_lp_par::LpVerb_ProcessedNodeIndex), "\n");
     p.user->print(p.param(BCP_lp_par::LpVerb_ProcessedNodeIndex),
 		  "LP: **** Processing NODE %i on LEVEL %i (from TM) ****\n",
 		  p.node->index, p.node->level);
+    p.slack_pool.new_node(p.node->index, false);
     // let the user do whatever she wants before the new node starts
     BCP_lp_prepare_for_new_node(p);
 
@@ -47,9 +156,27 @@ void BCP_lp_main_loop(BCP_lp_prob& p)
 		      "LP: *** Starting iteration %i ***\n",
 		      p.node->iteration_count);
 
+	// Tighten the bounds by propagating them on the rows. If that proves
+	// the node infeasible then prune it right away. There is no LP result
+	// yet to compress the LP with, so the node description is sent as is.
+	if (p.param(BCP_lp_par::BoundPropagation) &&
+	    p.node->colgen == BCP_DoNotGenerateColumns_Fathom) {
+	    if (! BCP_lp_propagate_bounds(p)) {
+		p.user->print(p.param(BCP_lp_par::LpVerb_FathomInfo),
+			      "LP:   Pruning node (bound propagation)\n");
+		BCP_lp_send_node_description(p, 0,
+					     BCP_Msg_NodeDescription_Infeas_Pruned);
+		BCP_lp_clean_up_node(p);
+		return;
+	    }
+	}
+
 	// Solve the lp relaxation and get the results
 	time0 = CoinCpuTime();
 	BCP_lp_check_ub(p);
+	// Set the cutoff from the current UB (the user can still override it
+	// in modify_lp_parameters()).
+	BCP_lp_set_objective_cutoff(p, *p.lp_solver);
 	// Whether primal/dual feasibility was affected at the end of an
 	// iteration. See doc of BCP_lp_user::modify_lp_parameters
 	const int changeType = (varset_changed ? 2:0) + (cutset_changed ? 1:0);
@@ -61,10 +188,13 @@ void BCP_lp_main_loop(BCP_lp_prob& p)
 		p.node->level, p.node->index, p.node->iteration_count);
 	p.lp_solver->writeMps(fname, "mps");
 #endif
-	p.lp_solver->resolve();
+	BCP_lp_resolve(p);
 	lpres.get_results(*p.lp_solver);
 	const int tc = lpres.termcode();
-	p.stat.time_lp_solving += CoinCpuTime() - time0;
+	time0 = CoinCpuTime() - time0;
+	p.stat.time_lp_solving += time0;
+	p.stat.lp_solve_time.record(time0);
+	p.stat.lp_iterations += lpres.iternum();
 
 	if (varset_changed) {
 	    p.node->lb_at_cutgen.clear();
@@ -155,6 +285,8 @@ LP:   Terminating and fathoming due to proven high cost.\n",
 
 	  p.no_more_cuts_cnt = 0;
 	  p.no_more_vars_cnt = 0;
+	  // Compute the duals to price with before they are sent anywhere
+	  BCP_lp_stabilize_duals(p, cutset_changed);
 	  if (! p.param(BCP_lp_par::MessagePassingIsSerial)) {
 	    // If the message passing environment is really parallel (i.e.,
 	    // while the CG/CP are working we can do something else) then:
@@ -164,40 +296,20 @@ LP:   Terminating and fathoming due to proven high cost.\n",
 	    //    pool at the top of the root, too, which is unnecessary, but
 	    //    it doesn't hurt and no big time is lost.)
 	    //  - or this is the cut_pool_check_freq-th iteration.
-	    if (p.node->cg != -1 || p.node->cp != -1) {
-	      const BCP_message_tag msgtag = BCP_lp_pack_for_cg(p);
-	      if (p.node->cg != -1) {
-		++p.no_more_cuts_cnt;
-		p.msg_env->send(p.node->cg, msgtag, p.msg_buf);
-	      }
-	      if (p.node->cp != -1) {
-		if (! (p.node->iteration_count %
-		       p.param(BCP_lp_par::CutPoolCheckFrequency))
-		    || varset_changed) {
-		  ++p.no_more_cuts_cnt;
-		  p.msg_env->send(p.node->cp, msgtag, p.msg_buf);
-		}
-	      }
-	    }
-	    // Similarly, send stuff to the VG/VP
-	    if (p.node->vg != -1 || p.node->vp != -1) {
-	      const BCP_message_tag msgtag = BCP_lp_pack_for_vg(p);
-	      if (p.node->vg != -1) {
-		++p.no_more_vars_cnt;
-		p.msg_env->send(p.node->vg, msgtag, p.msg_buf);
-	      }
-	      if (p.node->vp != -1) {
-		if (! (p.node->iteration_count %
-		       p.param(BCP_lp_par::VarPoolCheckFrequency))
-		    || cutset_changed) {
-		  ++p.no_more_vars_cnt;
-		  p.msg_env->send(p.node->cp, msgtag, p.msg_buf);
-		}
-	      }
-	    }
+	    // In asynchronous generation a process still working on an
+	    // earlier solution does not get this one (yet).
+	    BCP_lp_send_for_cg(p,
+			       ! (p.node->iteration_count %
+				  p.param(BCP_lp_par::CutPoolCheckFrequency))
+			       || varset_changed,
+			       false);
+	    // Similarly, send stuff to the VG. (The VP is queried in
+	    // BCP_lp_generate_vars(), before pricing.)
+	    BCP_lp_send_for_vg(p, false);
 	  }
 
 	  BCP_lp_adjust_row_effectiveness(p);
+	  BCP_lp_adjust_col_effectiveness(p);
 
 	  // Generate and receive the cuts
 	  const int cuts_to_add_cnt =
@@ -205,12 +317,33 @@ LP:   Terminating and fathoming due to proven high cost.\n",
 	  // Generate and receive the vars
 	  const int vars_to_add_cnt =
 	    BCP_lp_generate_vars(p, cutset_changed, from_repricing);
+	  // the pricing may have proved a high enough Lagrangian bound
+	  if (p.over_ub(p.node->true_lower_bound)) {
+	    BCP_lp_perform_fathom(p, "\
+LP:   Terminating and fathoming due to proven high cost (Lagrangian bound).\n",
+				  BCP_Msg_NodeDescription_OverUB_Pruned);
+	    return;
+	  }
 
-	  time0 = CoinCpuTime();
-	  BCP_solution* sol =
-	    p.user->generate_heuristic_solution(lpres,
-						p.node->vars, p.node->cuts);
-	  p.stat.time_heuristics += CoinCpuTime() - time0;
+	  BCP_solution* sol = NULL;
+	  if (BCP_lp_heuristic_is_due(p, lpres)) {
+	    const double old_ub = p.ub();
+	    time0 = CoinCpuTime();
+	    sol = p.user->generate_heuristic_solution(lpres,
+						      p.node->vars,
+						      p.node->cuts);
+	    const double heur_time = CoinCpuTime() - time0;
+	    p.stat.time_heuristics += heur_time;
+	    p.stat.heur_time.record(heur_time);
+	    const int depth = p.node->level;
+	    ++p.stat.heur_calls;
+	    ++p.stat.heur_calls_by_depth[depth];
+	    if (sol != NULL &&
+		sol->objective_value() < old_ub - p.granularity()) {
+	      ++p.stat.heur_successes;
+	      ++p.stat.heur_successes_by_depth[depth];
+	    }
+	  }
 	  // If the sol is a generic sol then look through the vars in it, and
 	  // if any of them has 0 bcpindex then assign an index to it.
 	  BCP_solution_generic* gsol = dynamic_cast<BCP_solution_generic*>(sol);
@@ -276,11 +409,13 @@ LP:   Terminating and fathoming due to proven high cost (good heur soln!).\n",
 	    p.user->print(p.param(BCP_lp_par::LpVerb_NodeTime),
 			  "BCP_lp: Time spent in this node: %15.4f seconds\n",
 			  CoinCpuTime() - nodeStart);
+	    p.stat.node_time.record(CoinCpuTime() - nodeStart);
 	    nodeStart = CoinCpuTime();
 	    p.user->print(p.param(BCP_lp_par::LpVerb_ProcessedNodeIndex),"\n");
 	    p.user->print(p.param(BCP_lp_par::LpVerb_ProcessedNodeIndex),
 			  "LP: **** Processing NODE %i on LEVEL %i (dived) ****\n",
 			  p.node->index, p.node->level);
+	    p.slack_pool.new_node(p.node->index, true);
 	    // let the user do whatever she wants before the new node starts
 	    BCP_lp_prepare_for_new_node(p);
 	    // here we don't have to delete cols and rows, it's done as part of
@@ -315,3 +450,12 @@ LP:   Terminating and fathoming due to proven high cost (good heur soln!).\n",
 	}
     }
 }
+
+//#############################################################################
+
+void BCP_lp_main_loop(BCP_lp_prob& p)
+{
+    double nodeStart = CoinCpuTime();
+    BCP_lp_process_nodes(p, nodeStart);
+    p.stat.node_time.record(CoinCpuTime() - nodeStart);
+}
@@ -1,5 +1,7 @@
 // Copyright (C) 2000, International Business Machines
 // Corporation and others.  All Rights Reserved.
+#include <cstdlib>
+#include <algorithm>
 
 #include "BCP_warmstart.hpp"
 #include "BCP_lp_result.hpp"
@@ -25,9 +27,9 @@ void BCP_lp_process_result(BCP_lp_prob& p, const BCP_lp_result& lpres)
 void BCP_lp_purge_slack_pool(BCP_lp_prob& p)
 {
   BCP_vec<int> purge;
-  p.user->purge_slack_pool(p.slack_pool, purge);
+  p.user->purge_slack_pool(p.slack_pool.cuts(), purge);
   if (purge.size() > 0)
-    purge_ptr_vector_by_index(p.slack_pool, purge.begin(), purge.end());
+    p.slack_pool.purge(purge);
 }
 
 //#############################################################################
@@ -60,8 +62,26 @@ void BCP_lp_clean_up_node(BCP_lp_prob& p)
 {
   p.node->clean();
   BCP_vec<BCP_var*>& vars = p.node->vars;
-  purge_ptr_vector(vars, vars.entry(p.core->varnum()), vars.end());
   BCP_vec<BCP_cut*>& cuts = p.node->cuts;
+  // Remember what's in the LP solver so that the next node can reuse it.
+  // (Unless the LP solver does not correspond to the node any more.)
+  p.resident_var_ind.clear();
+  p.resident_cut_ind.clear();
+  if (p.param(BCP_lp_par::ReuseLpBetweenNodes) &&
+      p.lp_solver->getNumCols() == static_cast<int>(vars.size()) &&
+      p.lp_solver->getNumRows() == static_cast<int>(cuts.size())) {
+    int i;
+    const int varnum = vars.size();
+    p.resident_var_ind.reserve(varnum - p.core->varnum());
+    for (i = p.core->varnum(); i < varnum; ++i)
+      p.resident_var_ind.unchecked_push_back(abs(vars[i]->bcpind()));
+    const int cutnum = cuts.size();
+    p.resident_cut_ind.reserve(cutnum - p.core->cutnum());
+    for (i = p.core->cutnum(); i < cutnum; ++i)
+      p.resident_cut_ind.unchecked_push_back(abs(cuts[i]->bcpind()));
+    p.resident_lp = p.lp_solver;
+  }
+  purge_ptr_vector(vars, vars.entry(p.core->varnum()), vars.end());
   purge_ptr_vector(cuts, cuts.entry(p.core->cutnum()), cuts.end());
   p.parent->clean();
   // Also, the local pools might contain only locally valid
@@ -96,7 +116,7 @@ BCP_message_tag BCP_lp_pack_for_vg(BCP_lp_prob& p)
 
   buf.set_msgtag(BCP_Msg_ForVG_User);
 
-  p.user->pack_dual_solution(buf, *p.lp_result,
+  p.user->pack_dual_solution(buf, p.stabilizer.pricing_result(*p.lp_result),
 			     p.node->vars, p.node->cuts);
 
   return buf.msgtag();
@@ -135,6 +155,7 @@ BCP_lp_prepare_for_new_node(BCP_lp_prob& p)
 					  vcp, vbd, ccp, cbd);
 
   p.sol = NULL;
+  p.lagrangian.reset();
 
   if (2 * vcp.size() != vbd.size()) {
     throw BCP_fatal_error("new node init returned uneven var vectors\n");
@@ -183,6 +204,36 @@ BCP_lp_prepare_for_new_node(BCP_lp_prob& p)
     cuts.set_lb_ub(ccp, cbd.begin());
   }
 
+  // Apply the globally valid bounds received from the TM. If they
+  // contradict the bounds of the node then the LP becomes infeasible and
+  // the node is pruned.
+  if (! p.global_var_bounds.empty()) {
+    vcp.clear();
+    vbd.clear();
+    for (i = 0; i < varnum; ++i) {
+      const BCP_var* var = vars[i];
+      if (var->bcpind() <= 0)
+	continue;
+      std::map<int, std::pair<double, double> >::const_iterator gb =
+	p.global_var_bounds.find(var->bcpind());
+      if (gb == p.global_var_bounds.end())
+	continue;
+      if (gb->second.first > var->lb() || gb->second.second < var->ub()) {
+	vcp.push_back(i);
+	vbd.push_back(std::max(var->lb(), gb->second.first));
+	vbd.push_back(std::min(var->ub(), gb->second.second));
+      }
+    }
+    if (vcp.size() > 0) {
+      lp.setColSetBounds(vcp.begin(), vcp.end(), vbd.begin());
+      vars.set_lb_ub(vcp, vbd.begin());
+      if (p.param(BCP_lp_par::LpVerb_VarTightening)) {
+	printf("LP: Global bounds have changed the bounds on %i vars\n",
+	       static_cast<int>(vcp.size()));
+      }
+    }
+  }
+
   if (lp.numberObjects() == 0) {
     if (!p.intAndSosObjects.empty()) {
       lp.addObjects(p.intAndSosObjects.size(), &p.intAndSosObjects[0]);
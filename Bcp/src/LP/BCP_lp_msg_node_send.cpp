@@ -2,6 +2,7 @@
 // Corporation and others.  All Rights Reserved.
 #include <functional>
 
+#include "CoinTime.hpp"
 #include "BCP_message.hpp"
 #include "BCP_problem_core.hpp"
 #include "BCP_branch.hpp"
@@ -178,57 +179,7 @@ BCP_lp_pack_noncore_vars(BCP_lp_prob& p, BCP_vec<int>& deleted_pos)
     // we'll need the list of deleted variable positions when we set of the
     // warmstart information to be sent.
     BCP_obj_set_change wrtp;
-    wrtp._storage = BCP_Storage_WrtParent;
-
-    const BCP_vec<int>& old_added_bcpind = p.parent->var_set._new_objs;
-    const BCP_vec<BCP_obj_change>& old_added_desc = p.parent->var_set._change;
-    const int old_added_num = old_added_bcpind.size();
-    wrtp._del_change_pos.reserve(old_added_num);
-
-    BCP_vec<int> chpos;
-    chpos.reserve(new_added_num);
-
-    int i, j;
-
-    // first check how many entry has been deleted from oldvars
-    for (i = 0, j = 0; i < new_added_num && j < old_added_num; ++j) {
-	const BCP_var* const v = vars[i];
-	const BCP_obj_change& old = old_added_desc[j];
-	if (v->bcpind() == old_added_bcpind[j]) {
-	    // added_bcpind ALWAYS has real indices, so this really separates
-	    if (v->lb()!=old.lb || v->ub()!=old.ub || v->status()!=old.stat)
-		chpos.unchecked_push_back(i);
-	    ++i;
-	} else {
-	    wrtp._del_change_pos.unchecked_push_back(j);
-	}
-    }
-    // append the remains of old_added to _del_change_pos
-    for ( ; j < old_added_num; ++j) {
-	wrtp._del_change_pos.unchecked_push_back(j);
-    }
-    // _deleted_num is the current length of _del_change_pos
-    wrtp._deleted_num = wrtp._del_change_pos.size();
-
-    // the rest are the set of really new vars, and also the position of those
-    // vars must be appended to chpos.
-    wrtp._new_objs.reserve(new_added_num - i);
-    for ( ; i < new_added_num; ++i){
-	const int bcpind = vars[i]->bcpind();
-	wrtp._new_objs.unchecked_push_back(bcpind > 0 ? bcpind : -bcpind);
-	chpos.unchecked_push_back(i);
-    }
-    // append chpos to _del_change_pos to get the final list
-    wrtp._del_change_pos.append(chpos);
-    
-    // finally, create _change: just pick up things based on chpos
-    const int chnum = chpos.size();
-    wrtp._change.reserve(chnum);
-    for (i = 0; i < chnum; ++i) {
-	const BCP_var* const var = vars[chpos[i]];
-	wrtp._change.unchecked_push_back(BCP_obj_change(var->lb(), var->ub(),
-							var->status()));
-    }
+    wrtp.set_wrt_parent(p.parent->var_set, expl);
    
     deleted_pos.clear();
     deleted_pos.append(wrtp._del_change_pos.begin(),
@@ -322,57 +273,7 @@ BCP_lp_pack_noncore_cuts(BCP_lp_prob& p, BCP_vec<int>& deleted_pos)
     // we'll need the list of deleted cutiable positions when we set of the
     // warmstart information to be sent.
     BCP_obj_set_change wrtp;
-    wrtp._storage = BCP_Storage_WrtParent;
-
-    const BCP_vec<int>& old_added_bcpind = p.parent->cut_set._new_objs;
-    const BCP_vec<BCP_obj_change>& old_added_desc = p.parent->cut_set._change;
-    const int old_added_num = old_added_bcpind.size();
-    wrtp._del_change_pos.reserve(old_added_num);
-
-    BCP_vec<int> chpos;
-    chpos.reserve(new_added_num);
-
-    int i, j;
-
-    // first check how many entry has been deleted from oldcuts
-    for (i = 0, j = 0; i < new_added_num && j < old_added_num; ++j) {
-	const BCP_cut* const c = cuts[i];
-	const BCP_obj_change& old = old_added_desc[j];
-	if (c->bcpind() == old_added_bcpind[j]) {
-	    // added_bcpind ALWAYS has real indices, so this really separates
-	    if (c->lb()!=old.lb || c->ub()!=old.ub || c->status()!=old.stat)
-		chpos.unchecked_push_back(i);
-	    ++i;
-	} else {
-	    wrtp._del_change_pos.unchecked_push_back(j);
-	}
-    }
-    // append the remains of old_added to _del_change_pos
-    for ( ; j < old_added_num; ++j) {
-	wrtp._del_change_pos.unchecked_push_back(j);
-    }
-    // _deleted_num is the current length of _del_change_pos
-    wrtp._deleted_num = wrtp._del_change_pos.size();
-
-    // the rest are the set of really new cuts, and also the position of those
-    // cuts must be appended to chpos.
-    wrtp._new_objs.reserve(new_added_num - i);
-    for ( ; i < new_added_num; ++i){
-	const int bcpind = cuts[i]->bcpind();
-	wrtp._new_objs.unchecked_push_back(bcpind > 0 ? bcpind : -bcpind);
-	chpos.unchecked_push_back(i);
-    }
-    // append chpos to _del_change_pos to get the final list
-    wrtp._del_change_pos.append(chpos);
-    
-    // finally, create _change: just pick up things based on chpos
-    const int chnum = chpos.size();
-    wrtp._change.reserve(chnum);
-    for (i = 0; i < chnum; ++i) {
-	const BCP_cut* const cut = cuts[chpos[i]];
-	wrtp._change.unchecked_push_back(BCP_obj_change(cut->lb(), cut->ub(),
-							cut->status()));
-    }
+    wrtp.set_wrt_parent(p.parent->cut_set, expl);
    
     deleted_pos.clear();
     deleted_pos.append(wrtp._del_change_pos.begin(),
@@ -469,6 +370,27 @@ BCP_lp_pack_branching_info(BCP_lp_prob& p, BCP_presolved_lp_brobj* lp_brobj)
    BCP_internal_brobj int_brobj(*lp_brobj->candidate());
    int_brobj.pack(buf);
 
+   // The pseudo-cost information of the children: for each child the bcpind
+   // of the branching variable (-1 if the child is not created by branching
+   // on a single variable) and the distance the variable is moved (negative
+   // if down). The TM forwards the final bound of the children to every LP
+   // process, so bother only if the pseudo-costs are used.
+   const BCP_lp_branching_object* can = lp_brobj->candidate();
+   const int colnum = p.node->vars.size();
+   const bool use_pc = p.param(BCP_lp_par::PseudoCostReliability) > 0;
+   BCP_vec<int> pc_bcpind(child_num, -1);
+   BCP_vec<double> pc_change(child_num, 0.0);
+   for (int i = 0; use_pc && i < child_num; ++i) {
+     bool up;
+     double change;
+     const int pos = BCP_lp_single_var_branch(p, can, colnum, i, up, change);
+     if (pos >= 0) {
+       pc_bcpind[i] = p.node->vars[pos]->bcpind();
+       pc_change[i] = up ? change : -change;
+     }
+   }
+   buf.pack(p.lp_result->objval()).pack(pc_bcpind).pack(pc_change);
+
    int keep = -1;
    if (p.node->dive != BCP_DoNotDive){
       for (int i = child_num - 1; i >= 0; --i)
@@ -493,6 +415,7 @@ int BCP_lp_send_node_description(BCP_lp_prob& p,
 {
    BCP_buffer& buf = p.msg_buf;
    BCP_lp_node& node = *p.node;
+   const double time0 = CoinCpuTime();
 
    // let's start with saying who this node is and what is the lb we got
    buf.clear();
@@ -570,10 +493,12 @@ LP: there is ws info in BCP_lp_send_node_description()!\n");
       // (20 lines below) to decide whether we have to get the diving info or
       // not.
       p.node->dive = BCP_UnknownDivingStatus;
+      p.stat.time_msg_packing += CoinCpuTime() - time0;
       p.msg_env->send(p.get_parent() /*tree_manager*/,
 		      BCP_Msg_NodeDescriptionWithBranchingInfo, buf);
    }else{
       // we came from fathom()
+      p.stat.time_msg_packing += CoinCpuTime() - time0;
       p.msg_env->send(p.get_parent() /*tree_manager*/, msgtag, buf);
    }
 
@@ -591,8 +516,10 @@ LP: there is ws info in BCP_lp_send_node_description()!\n");
    if (p.node->dive == BCP_UnknownDivingStatus) {
       // We got to receive the diving information by hand
       p.msg_buf.clear();
+      const double wait0 = CoinWallclockTime();
       p.msg_env->receive(p.get_parent() /*tree_manager*/,
 			 BCP_Msg_DivingInfo, buf, -1);
+      p.stat.time_waiting_tm += CoinWallclockTime() - wait0;
       BCP_lp_unpack_diving_info(p, p.msg_buf);
    }
 
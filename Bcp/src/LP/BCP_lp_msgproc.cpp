@@ -1,7 +1,12 @@
 // Copyright (C) 2000, International Business Machines
 // Corporation and others.  All Rights Reserved.
+#include <cstdlib>
+#include <cmath>
+#include <algorithm>
 #include <functional>
 
+#include "CoinTime.hpp"
+
 #include "BCP_message.hpp"
 #include "BCP_lp_user.hpp"
 #include "BCP_lp_node.hpp"
@@ -24,6 +29,218 @@ void BCP_lp_check_ub(BCP_lp_prob& p)
 }
 
 //#############################################################################
+// Hash based duplicate detection of the newly arrived cuts and vars
+
+static inline size_t
+BCP_lp_cut_hash(const BCP_cut* cut)
+{
+  return cut->obj_type() == BCP_AlgoObj ?
+    static_cast<const BCP_cut_algo*>(cut)->hash_value() : 0;
+}
+
+static inline size_t
+BCP_lp_var_hash(const BCP_var* var)
+{
+  return var->obj_type() == BCP_AlgoObj ?
+    static_cast<const BCP_var_algo*>(var)->hash_value() : 0;
+}
+
+//-----------------------------------------------------------------------------
+
+void
+BCP_lp_build_cut_hash_index(BCP_lp_prob& p)
+{
+  BCP_lp_hash_index<BCP_cut, BCP_row>& index = p.cut_hash_index;
+  index.activate();
+  // The cuts in the formulation are not expanded, only those with a hash
+  // value of their own can be indexed.
+  const BCP_cut_set& cuts = p.node->cuts;
+  const int cutnum = cuts.size();
+  int i;
+  for (i = 0; i < cutnum; ++i) {
+    const size_t hash = BCP_lp_cut_hash(cuts[i]);
+    if (hash != 0)
+      index.insert(hash, cuts[i], 0);
+  }
+  const BCP_lp_cut_pool& cp = *p.local_cut_pool;
+  const int poolsize = cp.size();
+  for (i = 0; i < poolsize; ++i) {
+    const BCP_cut* cut = cp[i]->cut();
+    const size_t hash = BCP_lp_cut_hash(cut);
+    if (hash != 0) {
+      index.insert(hash, cut, 0);
+    } else if (cp[i]->row()) {
+      index.insert(cp[i]->row()->hash_value(), cut, cp[i]->row());
+    }
+  }
+}
+
+//-----------------------------------------------------------------------------
+
+/** Return true if the new cut (expanded into <code>row</code>) duplicates an
+    indexed one, otherwise add it to the index and return false. */
+static bool
+BCP_lp_check_new_cut(BCP_lp_prob& p, const BCP_cut* cut, const BCP_row* row)
+{
+  typedef BCP_lp_hash_index<BCP_cut, BCP_row>::const_iterator index_iter;
+  BCP_lp_hash_index<BCP_cut, BCP_row>& index = p.cut_hash_index;
+  size_t hash = BCP_lp_cut_hash(cut);
+  if (hash != 0) {
+    std::pair<index_iter, index_iter> range = index.equal_range(hash);
+    for ( ; range.first != range.second; ++range.first) {
+      const BCP_lp_hash_index<BCP_cut, BCP_row>::entry& e =
+	range.first->second;
+      if (e.vec)
+	continue;
+      switch (p.user->compare_cuts(e.obj, cut)) {
+      case BCP_FirstObjIsBetter:
+      case BCP_ObjsAreSame:
+	return true;
+      case BCP_SecondObjIsBetter:
+      case BCP_DifferentObjs:
+	break;
+      }
+    }
+    index.insert(hash, cut, 0);
+  } else {
+    hash = row->hash_value();
+    std::pair<index_iter, index_iter> range = index.equal_range(hash);
+    for ( ; range.first != range.second; ++range.first) {
+      const BCP_lp_hash_index<BCP_cut, BCP_row>::entry& e =
+	range.first->second;
+      if (e.vec && e.vec->is_same_up_to_scaling(*row))
+	return true;
+    }
+    index.insert(hash, cut, row);
+  }
+  return false;
+}
+
+//-----------------------------------------------------------------------------
+
+void
+BCP_lp_build_var_hash_index(BCP_lp_prob& p)
+{
+  BCP_lp_hash_index<BCP_var, BCP_col>& index = p.var_hash_index;
+  index.activate();
+  // The vars in the formulation are not expanded, only those with a hash
+  // value of their own can be indexed.
+  const BCP_var_set& vars = p.node->vars;
+  const int varnum = vars.size();
+  int i;
+  for (i = 0; i < varnum; ++i) {
+    const size_t hash = BCP_lp_var_hash(vars[i]);
+    if (hash != 0)
+      index.insert(hash, vars[i], 0);
+  }
+  const BCP_lp_var_pool& vp = *p.local_var_pool;
+  const int poolsize = vp.size();
+  for (i = 0; i < poolsize; ++i) {
+    const BCP_var* var = vp[i]->var();
+    const size_t hash = BCP_lp_var_hash(var);
+    if (hash != 0) {
+      index.insert(hash, var, 0);
+    } else if (vp[i]->col()) {
+      index.insert(vp[i]->col()->hash_value(), var, vp[i]->col());
+    }
+  }
+}
+
+//-----------------------------------------------------------------------------
+
+/** Return true if the new var (expanded into <code>col</code>) duplicates an
+    indexed one, otherwise add it to the index and return false. */
+static bool
+BCP_lp_check_new_var(BCP_lp_prob& p, const BCP_var* var, const BCP_col* col)
+{
+  typedef BCP_lp_hash_index<BCP_var, BCP_col>::const_iterator index_iter;
+  BCP_lp_hash_index<BCP_var, BCP_col>& index = p.var_hash_index;
+  size_t hash = BCP_lp_var_hash(var);
+  if (hash != 0) {
+    std::pair<index_iter, index_iter> range = index.equal_range(hash);
+    for ( ; range.first != range.second; ++range.first) {
+      const BCP_lp_hash_index<BCP_var, BCP_col>::entry& e =
+	range.first->second;
+      if (e.vec)
+	continue;
+      switch (p.user->compare_vars(e.obj, var)) {
+      case BCP_FirstObjIsBetter:
+      case BCP_ObjsAreSame:
+	return true;
+      case BCP_SecondObjIsBetter:
+      case BCP_DifferentObjs:
+	break;
+      }
+    }
+    index.insert(hash, var, 0);
+  } else {
+    hash = col->hash_value();
+    std::pair<index_iter, index_iter> range = index.equal_range(hash);
+    for ( ; range.first != range.second; ++range.first) {
+      const BCP_lp_hash_index<BCP_var, BCP_col>::entry& e =
+	range.first->second;
+      if (e.vec && e.vec->is_same(*col))
+	return true;
+    }
+    index.insert(hash, var, col);
+  }
+  return false;
+}
+
+//#############################################################################
+
+/** Return whether a var with the same internal index as <code>var</code> is
+    already in the formulation. (The sign of the index shows only whether
+    the TM knows about the var yet.) */
+static bool
+BCP_lp_var_in_formulation(const BCP_lp_prob& p, const BCP_var& var)
+{
+  const int ind = abs(var.bcpind());
+  const BCP_var_set& vars = p.node->vars;
+  const int varnum = vars.size();
+  for (int i = p.core->varnum(); i < varnum; ++i) {
+    if (abs(vars[i]->bcpind()) == ind)
+      return true;
+  }
+  return false;
+}
+
+//-----------------------------------------------------------------------------
+
+/** Record that <code>sender</code> has finished with the LP solution of
+    iteration <code>node_itcnt</code> at node <code>node_index</code>. */
+static void
+BCP_lp_solution_answered(BCP_lp_prob& p, const int sender,
+			 const int node_index, const int node_itcnt)
+{
+  std::map<int, int>::iterator cnt = p.unanswered_solutions.find(sender);
+  if (cnt == p.unanswered_solutions.end() || cnt->second == 0)
+    return;
+  // A CG/VG answers the solutions in the order they were sent, so when the
+  // last solution sent is answered the process is surely idle.
+  const std::pair<int, int>& last = p.last_solution_sent[sender];
+  if (last.first == node_index && last.second == node_itcnt)
+    cnt->second = 0;
+  else
+    --cnt->second;
+}
+
+//-----------------------------------------------------------------------------
+
+/** Whether a cut/var generated for the LP solution of iteration
+    <code>node_itcnt</code> at node <code>node_index</code> must be
+    discarded. */
+static inline bool
+BCP_lp_result_is_stale(const BCP_lp_prob& p,
+		       const int node_index, const int node_itcnt)
+{
+  if (node_index != p.node->index)
+    return true;
+  return (node_itcnt != p.node->iteration_count &&
+	  ! p.param(BCP_lp_par::FilterStaleGeneratorResults));
+}
+
+//-----------------------------------------------------------------------------
 
 void
 BCP_lp_prob::process_message()
@@ -54,9 +271,16 @@ LP: BCP_Msg_InitialUserInfo arrived in BCP_lp_prob::process_message().\n");
     break;
 
   case BCP_Msg_CutDescription:
+    msg_buf.unpack(node_index).unpack(node_itcnt);
+    if (BCP_lp_result_is_stale(*this, node_index, node_itcnt)) {
+      msg_buf.clear();
+      return;
+    }
     cut = unpack_cut();
-    if (param(BCP_lp_par::CompareNewCutsToOldOnes)){
-      // check if we already have this cut in the local cut pool
+    if (param(BCP_lp_par::CompareNewCutsToOldOnes) &&
+	! cut_hash_index.is_active()){
+      // check if we already have this cut in the local cut pool. (If the
+      // hash index is active then the cut is checked once it is expanded.)
       BCP_lp_cut_pool::iterator oldcut = local_cut_pool->begin();
       BCP_lp_cut_pool::iterator lastoldcut = local_cut_pool->end();
       while (oldcut != lastoldcut){
@@ -88,6 +312,12 @@ LP: BCP_Msg_InitialUserInfo arrived in BCP_lp_prob::process_message().\n");
       const int cutnum = cuts.size();
       for (int i = 0; i < cutnum; ++i) {
 	cut = cuts[i];
+	if (cut_hash_index.is_active() &&
+	    BCP_lp_check_new_cut(*this, cut, rows[i])) {
+	  delete rows[i];
+	  delete cut;
+	  continue;
+	}
 	if (! from_pool) 
 	  cut->set_bcpind(-BCP_lp_next_cut_index(*this));
 	cut->dont_send_to_pool(cpid == -1 || from_pool);
@@ -106,15 +336,23 @@ LP: BCP_Msg_InitialUserInfo arrived in BCP_lp_prob::process_message().\n");
     double cutgen_time;
     msg_buf.unpack(node_index).unpack(node_itcnt).unpack(cutgen_time);
     stat.time_cut_generation += cutgen_time;
+    BCP_lp_solution_answered(*this, msg_buf.sender(), node_index, node_itcnt);
     if (no_more_cuts_cnt >= 0 &&
 	node->index == node_index && node->iteration_count == node_itcnt)
       no_more_cuts_cnt--;
     break;
 
   case BCP_Msg_VarDescription:
+    msg_buf.unpack(node_index).unpack(node_itcnt);
+    if (BCP_lp_result_is_stale(*this, node_index, node_itcnt)) {
+      msg_buf.clear();
+      return;
+    }
     var = unpack_var();
-    if (param(BCP_lp_par::CompareNewVarsToOldOnes)){
-      // check if we already have this var in the local var pool
+    if (param(BCP_lp_par::CompareNewVarsToOldOnes) &&
+	! var_hash_index.is_active()){
+      // check if we already have this var in the local var pool. (If the
+      // hash index is active then the var is checked once it is expanded.)
       BCP_lp_var_pool::iterator oldvar = local_var_pool->begin();
       BCP_lp_var_pool::iterator lastoldvar = local_var_pool->end();
       while (oldvar != lastoldvar){
@@ -134,6 +372,14 @@ LP: BCP_Msg_InitialUserInfo arrived in BCP_lp_prob::process_message().\n");
 
     if (no_more_vars_cnt >= 0){ // we are waiting for vars
       const bool from_pool = (vpid == msg_buf.sender());
+      if (from_pool && BCP_lp_var_in_formulation(*this, *var)) {
+	// The pool does not know about the branching decisions in this
+	// subtree; a var in the formulation may have negative reduced cost
+	// only because it is fixed to zero. It must not come back.
+	delete var;   var = 0;
+	msg_buf.clear();
+	return;
+      }
       BCP_lp_var_pool& vp = *local_var_pool;
       const int old_vp_size = vp.size();
       BCP_vec<BCP_col*> cols;
@@ -146,6 +392,12 @@ LP: BCP_Msg_InitialUserInfo arrived in BCP_lp_prob::process_message().\n");
       const int varnum = vars.size();
       for (int i = 0; i < varnum; ++i) {
 	var = vars[i];
+	if (var_hash_index.is_active() &&
+	    BCP_lp_check_new_var(*this, var, cols[i])) {
+	  delete cols[i];
+	  delete var;
+	  continue;
+	}
 	if (! from_pool) 
 	  var->set_bcpind(-BCP_lp_next_var_index(*this));
 	var->dont_send_to_pool(vpid == -1 || from_pool);
@@ -164,6 +416,7 @@ LP: BCP_Msg_InitialUserInfo arrived in BCP_lp_prob::process_message().\n");
     double vargen_time;
     msg_buf.unpack(node_index).unpack(node_itcnt).unpack(vargen_time);
     stat.time_var_generation += vargen_time;
+    BCP_lp_solution_answered(*this, msg_buf.sender(), node_index, node_itcnt);
     if (no_more_vars_cnt >= 0 &&
 	node->index == node_index && node->iteration_count == node_itcnt)
       no_more_vars_cnt--;
@@ -173,6 +426,14 @@ LP: BCP_Msg_InitialUserInfo arrived in BCP_lp_prob::process_message().\n");
     BCP_lp_process_ub_message(*this, msg_buf);
     break;
 
+  case BCP_Msg_GlobalVarBounds:
+    BCP_lp_process_global_var_bounds(*this, msg_buf);
+    break;
+
+  case BCP_Msg_ChildBound:
+    BCP_lp_process_child_bound(*this, msg_buf);
+    break;
+
   case BCP_Msg_WarmstartRoot:
     {
       BCP_warmstart* ws = packer->unpack_warmstart(msg_buf);
@@ -183,19 +444,36 @@ LP: BCP_Msg_InitialUserInfo arrived in BCP_lp_prob::process_message().\n");
     break;
 
   case BCP_Msg_ActiveNodeData:
-    BCP_lp_unpack_active_node(*this, msg_buf);
-    // load the lp formulation into the lp solver
-    lp_solver = master_lp->clone();
-    if (node->colgen != BCP_GenerateColumns) {
-      // FIXME: If we had a flag in the node that indicates not to
-      // generate cols in it and in its descendants then the dual obj
-      // limit could still be set...
-      lp_solver->setDblParam(OsiDualObjectiveLimit, ub() - granularity());
+    {
+      const double time0 = CoinCpuTime();
+      BCP_lp_unpack_active_node(*this, msg_buf);
+      stat.time_msg_unpacking += CoinCpuTime() - time0;
+
+      // load the lp formulation into the lp solver. If the LP of the
+      // previous node was kept then only modify that.
+      const bool reuse = resident_lp != NULL &&
+	core->varnum() > 0 && core->cutnum() > 0;
+      if (reuse) {
+	lp_solver = resident_lp;
+      } else {
+	delete resident_lp;
+	lp_solver = master_lp->clone();
+      }
+      resident_lp = NULL;
+      if (node->colgen != BCP_GenerateColumns) {
+	BCP_lp_set_objective_cutoff(*this, *lp_solver);
+      } else if (reuse) {
+	double limit;
+	master_lp->getDblParam(OsiDualObjectiveLimit, limit);
+	lp_solver->setDblParam(OsiDualObjectiveLimit, limit);
+      }
+      BCP_lp_create_lp(*this, reuse);
+      BCP_lp_main_loop(*this);
+      // BCP_lp_clean_up_node() has set resident_lp if the LP is to be kept
+      if (resident_lp != lp_solver)
+	delete lp_solver;
+      lp_solver = NULL;
     }
-    BCP_lp_create_lp(*this);
-    BCP_lp_main_loop(*this);
-    delete lp_solver;
-    lp_solver = NULL;
     break;
 
   case BCP_Msg_DivingInfo:
@@ -277,24 +555,96 @@ BCP_lp_next_cut_index(BCP_lp_prob& p)
 
 //#############################################################################
 
+void BCP_lp_set_objective_cutoff(BCP_lp_prob& p, OsiSolverInterface& lp)
+{
+  // FIXME: If we had a flag in the node that indicates not to
+  // generate cols in it and in its descendants then the dual obj
+  // limit could still be set...
+  if (p.node->colgen != BCP_GenerateColumns) {
+    lp.setDblParam(OsiDualObjectiveLimit, p.ub() - p.granularity());
+  }
+}
+
+//#############################################################################
+
 void BCP_lp_process_ub_message(BCP_lp_prob& p, BCP_buffer& buf)
 {
   double new_ub;
   buf.unpack(new_ub);
-  if (p.ub(new_ub) && p.lp_solver && p.node &&
-      p.node->colgen != BCP_GenerateColumns) {
-    // FIXME: If we had a flag in the node that indicates not to
-    // generate cols in it and in its descendants then the dual obj
-    // limit could still be set...
-    p.lp_solver->setDblParam(OsiDualObjectiveLimit,new_ub-p.granularity());
+  if (p.ub(new_ub) && p.lp_solver && p.node) {
+    BCP_lp_set_objective_cutoff(p, *p.lp_solver);
   }
 }
 
 //#############################################################################
 
+void BCP_lp_process_global_var_bounds(BCP_lp_prob& p, BCP_buffer& buf)
+{
+  int cnt;
+  buf.unpack(cnt);
+  while (--cnt >= 0) {
+    int bcpind;
+    double lb, ub;
+    buf.unpack(bcpind).unpack(lb).unpack(ub);
+    std::map<int, std::pair<double, double> >::iterator gb =
+      p.global_var_bounds.find(bcpind);
+    if (gb == p.global_var_bounds.end()) {
+      p.global_var_bounds[bcpind] = std::make_pair(lb, ub);
+    } else {
+      gb->second.first = std::max(lb, gb->second.first);
+      gb->second.second = std::min(ub, gb->second.second);
+    }
+  }
+}
+
+//-----------------------------------------------------------------------------
+
+void BCP_lp_send_global_var_bounds(BCP_lp_prob& p,
+				   const BCP_vec<int>& changed_pos)
+{
+  // Only the variables the TM knows about can be identified by the other
+  // LP processes
+  const BCP_var_set& vars = p.node->vars;
+  BCP_vec<int> pos;
+  pos.reserve(changed_pos.size());
+  BCP_vec<int>::const_iterator ind = changed_pos.begin();
+  for ( ; ind != changed_pos.end(); ++ind) {
+    if (vars[*ind]->bcpind() > 0)
+      pos.unchecked_push_back(*ind);
+  }
+  const int cnt = pos.size();
+  if (cnt == 0)
+    return;
+
+  BCP_buffer& buf = p.msg_buf;
+  buf.clear();
+  buf.pack(cnt);
+  for (int i = 0; i < cnt; ++i) {
+    const BCP_var* var = vars[pos[i]];
+    buf.pack(var->bcpind()).pack(var->lb()).pack(var->ub());
+  }
+  p.msg_env->send(p.get_parent(), BCP_Msg_GlobalVarBounds, buf);
+  if (p.param(BCP_lp_par::LpVerb_VarTightening)) {
+    printf("LP: Global bounds on %i vars sent to the TM\n", cnt);
+  }
+}
+
+//#############################################################################
+
+void BCP_lp_process_child_bound(BCP_lp_prob& p, BCP_buffer& buf)
+{
+  // The change is negative if the variable was branched down
+  int bcpind;
+  double change, objchange;
+  buf.unpack(bcpind).unpack(change).unpack(objchange);
+  p.pseudocosts.update(bcpind, change > 0, std::abs(change), objchange);
+}
+
+//#############################################################################
+
 void BCP_lp_send_cuts_to_cp(BCP_lp_prob& p, const int eff_cnt_limit)
 {
-  if (p.node->cp != -1) // go back if no cut pool exists
+  if (p.node->cp == -1) // go back if no cut pool exists
     return;
 
   BCP_cut_set& cuts = p.node->cuts;
@@ -337,6 +687,141 @@ void BCP_lp_send_cuts_to_cp(BCP_lp_prob& p, const int eff_cnt_limit)
 
 //#############################################################################
 
+void BCP_lp_send_vars_to_vp(BCP_lp_prob& p)
+{
+  if (p.node->vp == -1) // go back if no variable pool exists
+    return;
+
+  BCP_var_set& vars = p.node->vars;
+  BCP_var_set::iterator vari = vars.entry(p.core->varnum());
+  const BCP_var_set::const_iterator lastvari = vars.end();
+  BCP_var* var;
+  int cnt;
+
+  // First count how many to send
+  for (cnt = 0; vari != lastvari; ++vari) {
+    if (! (*vari)->dont_send_to_pool())
+      ++cnt;
+  }
+
+  if (cnt > 0){
+    BCP_buffer& buf = p.msg_buf;
+    buf.clear();
+    buf.pack(cnt);
+    // whatever is sent to the VP must have been generated at this level
+    buf.pack(p.node->level);
+    // pack the vars
+    vari = vars.entry(p.core->varnum());
+    for ( ; vari != lastvari; ++vari) {
+      var = *vari;
+      if (! var->dont_send_to_pool())
+	p.pack_var(*var);
+      var->dont_send_to_pool(true);
+    }
+
+    p.msg_env->send(p.node->vp, BCP_Msg_VarsToVarPool, buf);
+    if (p.param(BCP_lp_par::LpVerb_VarsToVarPoolCount))
+      printf("LP:   %i vars sent to varpool\n", cnt);
+  }
+}
+
+//#############################################################################
+// Sending LP solutions to the generators and pools
+
+void BCP_lp_send_solution(BCP_lp_prob& p, const int target,
+			  const BCP_message_tag msgtag)
+{
+  // do the bookkeeping first: in a serial environment the answer is
+  // processed before send() returns
+  ++p.unanswered_solutions[target];
+  p.last_solution_sent[target] =
+    std::make_pair(p.node->index, p.node->iteration_count);
+  p.msg_env->send(target, msgtag, p.msg_buf);
+}
+
+//-----------------------------------------------------------------------------
+
+bool BCP_lp_has_current_solution(const BCP_lp_prob& p, const int target)
+{
+  std::map<int, std::pair<int, int> >::const_iterator last =
+    p.last_solution_sent.find(target);
+  return (last != p.last_solution_sent.end() &&
+	  last->second.first == p.node->index &&
+	  last->second.second == p.node->iteration_count);
+}
+
+//-----------------------------------------------------------------------------
+
+bool BCP_lp_is_busy(const BCP_lp_prob& p, const int target)
+{
+  std::map<int, int>::const_iterator cnt =
+    p.unanswered_solutions.find(target);
+  return cnt != p.unanswered_solutions.end() && cnt->second > 0;
+}
+
+//-----------------------------------------------------------------------------
+
+void BCP_lp_send_for_cg(BCP_lp_prob& p, const bool check_pool,
+			const bool force)
+{
+  const bool async = p.param(BCP_lp_par::AsynchronousGeneration) &&
+    ! p.param(BCP_lp_par::MessagePassingIsSerial);
+  int target[2];
+  int num = 0;
+  if (p.node->cg != -1)
+    target[num++] = p.node->cg;
+  if (p.node->cp != -1 && check_pool)
+    target[num++] = p.node->cp;
+
+  bool packed = false;
+  BCP_message_tag msgtag = BCP_Msg_NoMessage;
+  for (int i = 0; i < num; ++i) {
+    if (async &&
+	(BCP_lp_has_current_solution(p, target[i]) ||
+	 (! force && BCP_lp_is_busy(p, target[i]))))
+      continue;
+    if (! packed) {
+      msgtag = BCP_lp_pack_for_cg(p);
+      packed = true;
+    }
+    ++p.no_more_cuts_cnt;
+    BCP_lp_send_solution(p, target[i], msgtag);
+  }
+}
+
+//-----------------------------------------------------------------------------
+
+void BCP_lp_send_for_vg(BCP_lp_prob& p, const bool force)
+{
+  const int vg = p.node->vg;
+  if (vg == -1)
+    return;
+  if (p.param(BCP_lp_par::AsynchronousGeneration) &&
+      ! p.param(BCP_lp_par::MessagePassingIsSerial) &&
+      (BCP_lp_has_current_solution(p, vg) ||
+       (! force && BCP_lp_is_busy(p, vg))))
+    return;
+  const BCP_message_tag msgtag = BCP_lp_pack_for_vg(p);
+  ++p.no_more_vars_cnt;
+  BCP_lp_send_solution(p, vg, msgtag);
+}
+
+//-----------------------------------------------------------------------------
+
+void BCP_lp_receive_pending(BCP_lp_prob& p)
+{
+  while (true) {
+    // call receive with 0 timeout => nonblocking
+    p.msg_buf.clear();
+    p.msg_env->receive(BCP_AnyProcess, BCP_Msg_AnyMessage, p.msg_buf, 0);
+    if (p.msg_buf.msgtag() == BCP_Msg_NoMessage)
+      break;
+    p.process_message();
+  }
+}
+
+//#############################################################################
+
 void BCP_lp_unpack_diving_info(BCP_lp_prob& p, BCP_buffer& buf)
 {
   buf.unpack(p.node->dive); // what's the new diving status?
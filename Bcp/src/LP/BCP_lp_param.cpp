@@ -16,6 +16,9 @@ void BCP_parameter_set<BCP_lp_par>::create_keyword_list() {
     // Create the list of keywords for parameter file reading
     //-------------------------------------------------------------------------
     // CharPar
+    keys.push_back(make_pair(BCP_string("BCP_AsynchronousGeneration"),
+			     BCP_parameter(BCP_CharPar, 
+					   AsynchronousGeneration)));
     keys.push_back(make_pair(BCP_string("BCP_BranchOnCuts"),
 			     BCP_parameter(BCP_CharPar, 
 					   BranchOnCuts)));
@@ -34,12 +37,33 @@ void BCP_parameter_set<BCP_lp_par>::create_keyword_list() {
     keys.push_back(make_pair(BCP_string("BCP_DoReducedCostFixing"),
 			     BCP_parameter(BCP_CharPar, 
 					   DoReducedCostFixingAtAnything)));
+    keys.push_back(make_pair(BCP_string("BCP_GlobalReducedCostFixing"),
+			     BCP_parameter(BCP_CharPar, 
+					   GlobalReducedCostFixing)));
+    keys.push_back(make_pair(BCP_string("BCP_FilterStaleGeneratorResults"),
+			     BCP_parameter(BCP_CharPar, 
+					   FilterStaleGeneratorResults)));
     keys.push_back(make_pair(BCP_string("BCP_ReportWhenDefaultIsExecuted"),
 			     BCP_parameter(BCP_CharPar,
 					   ReportWhenDefaultIsExecuted)));
     keys.push_back(make_pair(BCP_string("BCP_NoCompressionAtFathom"),
 			     BCP_parameter(BCP_CharPar, 
 					   NoCompressionAtFathom)));
+    keys.push_back(make_pair(BCP_string("BCP_KeepDeletedInLocalPool"),
+			     BCP_parameter(BCP_CharPar, 
+					   KeepDeletedInLocalPool)));
+    keys.push_back(make_pair(BCP_string("BCP_ReuseLpBetweenNodes"),
+			     BCP_parameter(BCP_CharPar, 
+					   ReuseLpBetweenNodes)));
+    keys.push_back(make_pair(BCP_string("BCP_BoundPropagation"),
+			     BCP_parameter(BCP_CharPar, 
+					   BoundPropagation)));
+    keys.push_back(make_pair(BCP_string("BCP_WarmstartSinglePrecision"),
+			     BCP_parameter(BCP_CharPar, 
+					   WarmstartSinglePrecision)));
+    keys.push_back(make_pair(BCP_string("BCP_HeuristicAdaptive"),
+			     BCP_parameter(BCP_CharPar, 
+					   HeuristicAdaptive)));
     keys.push_back(make_pair(BCP_string("BCP_SendFathomedNodeDesc"),
 			     BCP_parameter(BCP_CharPar, 
 					   SendFathomedNodeDesc)));
@@ -120,6 +144,9 @@ void BCP_parameter_set<BCP_lp_par>::create_keyword_list() {
     keys.push_back(make_pair(BCP_string("BCP_LpVerb_RowEffectivenessCount"),
 			     BCP_parameter(BCP_CharPar,
 					   LpVerb_RowEffectivenessCount)));
+    keys.push_back(make_pair(BCP_string("BCP_LpVerb_ColEffectivenessCount"),
+			     BCP_parameter(BCP_CharPar,
+					   LpVerb_ColEffectivenessCount)));
     keys.push_back(make_pair(BCP_string("BCP_LpVerb_VarTightening"),
 			     BCP_parameter(BCP_CharPar,
 					   LpVerb_VarTightening)));
@@ -152,6 +179,9 @@ void BCP_parameter_set<BCP_lp_par>::create_keyword_list() {
     keys.push_back(make_pair(BCP_string("BCP_SlackCutDiscardingStrategy"),
 			     BCP_parameter(BCP_IntPar, 
 					   SlackCutDiscardingStrategy)));
+    keys.push_back(make_pair(BCP_string("BCP_SlackPoolMaxSize"),
+			     BCP_parameter(BCP_IntPar, 
+					   SlackPoolMaxSize)));
     keys.push_back(make_pair(BCP_string("BCP_CutEffectiveCountBeforePool"),
 			     BCP_parameter(BCP_IntPar, 
 					   CutEffectiveCountBeforePool)));
@@ -167,6 +197,9 @@ void BCP_parameter_set<BCP_lp_par>::create_keyword_list() {
     keys.push_back(make_pair(BCP_string("BCP_IneffectiveBeforeDelete"),
 			     BCP_parameter(BCP_IntPar, 
 					   IneffectiveBeforeDelete)));
+    keys.push_back(make_pair(BCP_string("BCP_IneffectiveColsBeforeDelete"),
+			     BCP_parameter(BCP_IntPar, 
+					   IneffectiveColsBeforeDelete)));
 
     keys.push_back(make_pair(BCP_string("BCP_MaxNonDualFeasToAdd_Min"),
 			     BCP_parameter(BCP_IntPar, 
@@ -178,6 +211,15 @@ void BCP_parameter_set<BCP_lp_par>::create_keyword_list() {
     keys.push_back(make_pair(BCP_string("BCP_CutViolationNorm"),
 			     BCP_parameter(BCP_IntPar,
 					   CutViolationNorm)));
+    keys.push_back(make_pair(BCP_string("BCP_CutViolationThreadNum"),
+			     BCP_parameter(BCP_IntPar,
+					   CutViolationThreadNum)));
+    keys.push_back(make_pair(BCP_string("BCP_GeneratorThreadNum"),
+			     BCP_parameter(BCP_IntPar,
+					   GeneratorThreadNum)));
+    keys.push_back(make_pair(BCP_string("BCP_BoundPropagationMaxRowVisits"),
+			     BCP_parameter(BCP_IntPar,
+					   BoundPropagationMaxRowVisits)));
 
     keys.push_back(make_pair(BCP_string("BCP_MaxCutsAddedPerIteration"),
 			     BCP_parameter(BCP_IntPar, 
@@ -185,6 +227,9 @@ void BCP_parameter_set<BCP_lp_par>::create_keyword_list() {
     keys.push_back(make_pair(BCP_string("BCP_MaxVarsAddedPerIteration"),
 			     BCP_parameter(BCP_IntPar, 
 					   MaxVarsAddedPerIteration)));
+    keys.push_back(make_pair(BCP_string("BCP_VarPoolPartialPricingNum"),
+			     BCP_parameter(BCP_IntPar, 
+					   VarPoolPartialPricingNum)));
 
     keys.push_back(make_pair(BCP_string("BCP_MaxLeftoverCutNum"),
 			     BCP_parameter(BCP_IntPar, 
@@ -197,6 +242,12 @@ void BCP_parameter_set<BCP_lp_par>::create_keyword_list() {
 			     BCP_parameter(BCP_IntPar, 
 					   DeletedRowToCompress_Min)));
 
+    keys.push_back(make_pair(BCP_string("BCP_ResolveIterationChunk"),
+			     BCP_parameter(BCP_IntPar, 
+					   ResolveIterationChunk)));
+    keys.push_back(make_pair(BCP_string("BCP_LagrangianStallRounds"),
+			     BCP_parameter(BCP_IntPar, 
+					   LagrangianStallRounds)));
     keys.push_back(make_pair(BCP_string("BCP_MaxPresolveIter"),
 			     BCP_parameter(BCP_IntPar, 
 					   MaxPresolveIter)));
@@ -206,6 +257,18 @@ void BCP_parameter_set<BCP_lp_par>::create_keyword_list() {
     keys.push_back(make_pair(BCP_string("BCP_StrongBranch_CloseToHalfNum"),
 			     BCP_parameter(BCP_IntPar, 
 					   StrongBranchNum)));
+    keys.push_back(make_pair(BCP_string("BCP_StrongBranchThreadNum"),
+			     BCP_parameter(BCP_IntPar, 
+					   StrongBranchThreadNum)));
+    keys.push_back(make_pair(BCP_string("BCP_PseudoCostReliability"),
+			     BCP_parameter(BCP_IntPar, 
+					   PseudoCostReliability)));
+    keys.push_back(make_pair(BCP_string("BCP_StrongBranchCacheAge"),
+			     BCP_parameter(BCP_IntPar, 
+					   StrongBranchCacheAge)));
+    keys.push_back(make_pair(BCP_string("BCP_StrongBranchCacheLevelDiff"),
+			     BCP_parameter(BCP_IntPar, 
+					   StrongBranchCacheLevelDiff)));
     keys.push_back(make_pair(BCP_string("BCP_BranchingObjectComparison"),
 			     BCP_parameter(BCP_IntPar, 
 					   BranchingObjectComparison)));
@@ -225,6 +288,18 @@ void BCP_parameter_set<BCP_lp_par>::create_keyword_list() {
     keys.push_back(make_pair(BCP_string("BCP_InfoForVG"),
 			     BCP_parameter(BCP_IntPar, 
 					   InfoForVG)));
+    keys.push_back(make_pair(BCP_string("BCP_HeuristicFrequency"),
+			     BCP_parameter(BCP_IntPar, 
+					   HeuristicFrequency)));
+    keys.push_back(make_pair(BCP_string("BCP_HeuristicMaxDepth"),
+			     BCP_parameter(BCP_IntPar, 
+					   HeuristicMaxDepth)));
+    keys.push_back(make_pair(BCP_string("BCP_HeuristicAdaptiveMinCalls"),
+			     BCP_parameter(BCP_IntPar, 
+					   HeuristicAdaptiveMinCalls)));
+    keys.push_back(make_pair(BCP_string("BCP_HeuristicAdaptiveMaxInterval"),
+			     BCP_parameter(BCP_IntPar, 
+					   HeuristicAdaptiveMaxInterval)));
     //    keys.push_back(make_pair(BCP_string("BCP_"),
     // 			      BCP_parameter(BCP_IntPar, 
     // 					    )));
@@ -248,6 +323,18 @@ void BCP_parameter_set<BCP_lp_par>::create_keyword_list() {
     keys.push_back(make_pair(BCP_string("BCP_IntegerTolerance"),
 			     BCP_parameter(BCP_DoublePar, 
 					   IntegerTolerance)));
+    keys.push_back(make_pair(BCP_string("BCP_DualSmoothingFactor"),
+			     BCP_parameter(BCP_DoublePar, 
+					   DualSmoothingFactor)));
+    keys.push_back(make_pair(BCP_string("BCP_DualBoxStepSize"),
+			     BCP_parameter(BCP_DoublePar, 
+					   DualBoxStepSize)));
+    keys.push_back(make_pair(BCP_string("BCP_LagrangianGapTolerance"),
+			     BCP_parameter(BCP_DoublePar, 
+					   LagrangianGapTolerance)));
+    keys.push_back(make_pair(BCP_string("BCP_LagrangianStallImprovement"),
+			     BCP_parameter(BCP_DoublePar, 
+					   LagrangianStallImprovement)));
 
     keys.push_back(make_pair(BCP_string("BCP_FirstLP_FirstCutTimeout"),
 			     BCP_parameter(BCP_DoublePar, 
@@ -277,6 +364,15 @@ void BCP_parameter_set<BCP_lp_par>::create_keyword_list() {
     keys.push_back(make_pair(BCP_string("BCP_MaxRunTime"),
 			     BCP_parameter(BCP_DoublePar, 
 					   MaxRunTime)));
+    keys.push_back(make_pair(BCP_string("BCP_HeuristicMinGap"),
+			     BCP_parameter(BCP_DoublePar, 
+					   HeuristicMinGap)));
+    keys.push_back(make_pair(BCP_string("BCP_HeuristicAdaptiveMinSuccessRate"),
+			     BCP_parameter(BCP_DoublePar, 
+					   HeuristicAdaptiveMinSuccessRate)));
+    keys.push_back(make_pair(BCP_string("BCP_HeuristicMaxTimeFraction"),
+			     BCP_parameter(BCP_DoublePar, 
+					   HeuristicMaxTimeFraction)));
     /** Maximum allowed running time */
     //    keys.push_back(make_pair(BCP_string("BCP_"),
     // 			      BCP_parameter(BCP_DoublePar, 
@@ -298,14 +394,22 @@ template <>
 void BCP_parameter_set<BCP_lp_par>::set_default_entries() {
     //-------------------------------------------------------------------------
     // CharPar
+    set_entry(AsynchronousGeneration, false);
     set_entry(BranchOnCuts, false);
     set_entry(CompareNewCutsToOldOnes, true);
     set_entry(CompareNewVarsToOldOnes, true);
     set_entry(DoReducedCostFixingAtZero, true);
     set_entry(DoReducedCostFixingAtAnything, true);
+    set_entry(GlobalReducedCostFixing, false);
+    set_entry(FilterStaleGeneratorResults, true);
     set_entry(MessagePassingIsSerial, false);
     set_entry(ReportWhenDefaultIsExecuted, true);
     set_entry(NoCompressionAtFathom, false);
+    set_entry(KeepDeletedInLocalPool, false);
+    set_entry(ReuseLpBetweenNodes, false);
+    set_entry(BoundPropagation, false);
+    set_entry(WarmstartSinglePrecision, false);
+    set_entry(HeuristicAdaptive, false);
     set_entry(SendFathomedNodeDesc, true);
     set_entry(UseExplicitStorage, false);
     set_entry(Lp_DumpNodeDescCuts, false);
@@ -334,6 +438,7 @@ void BCP_parameter_set<BCP_lp_par>::set_default_entries() {
     set_entry(LpVerb_ReportLocalVarPoolSize, true);
     set_entry(LpVerb_RepricingResult, true);
     set_entry(LpVerb_RowEffectivenessCount, true);
+    set_entry(LpVerb_ColEffectivenessCount, true);
     set_entry(LpVerb_VarTightening, true);
     set_entry(LpVerb_StrongBranchPositions, true);
     set_entry(LpVerb_StrongBranchResult, true);
@@ -346,27 +451,39 @@ void BCP_parameter_set<BCP_lp_par>::set_default_entries() {
     set_entry(ScaleMatrix, 0);
 
     set_entry(SlackCutDiscardingStrategy, BCP_DiscardSlackCutsAtNewIteration);
+    set_entry(SlackPoolMaxSize, 1000);
     set_entry(CutEffectiveCountBeforePool, 1000);
     set_entry(CutPoolCheckFrequency, 10);
     set_entry(VarPoolCheckFrequency, 10);
     set_entry(IneffectiveConstraints, BCP_IneffConstr_ZeroDualValue);
     set_entry(IneffectiveBeforeDelete, 1);
+    set_entry(IneffectiveColsBeforeDelete, 0);
 
     set_entry(MaxNonDualFeasToAdd_Min, 5);
     set_entry(MaxNonDualFeasToAdd_Max, 200);
 
     set_entry(CutViolationNorm, BCP_CutViolationNorm_Plain);
+    set_entry(CutViolationThreadNum, 1);
+    set_entry(GeneratorThreadNum, 1);
+    set_entry(BoundPropagationMaxRowVisits, 100000);
 
     set_entry(MaxCutsAddedPerIteration, 100000);
     set_entry(MaxVarsAddedPerIteration, 100000);
+    set_entry(VarPoolPartialPricingNum, 0);
 
     set_entry(MaxLeftoverCutNum, 10000000); 
 
     set_entry(DeletedColToCompress_Min, 10);
     set_entry(DeletedRowToCompress_Min, 10);
 
+    set_entry(ResolveIterationChunk, 0);
+    set_entry(LagrangianStallRounds, 0);
     set_entry(MaxPresolveIter, 100000);
     set_entry(StrongBranchNum, 3);
+    set_entry(StrongBranchThreadNum, 1);
+    set_entry(PseudoCostReliability, 0);
+    set_entry(StrongBranchCacheAge, 0);
+    set_entry(StrongBranchCacheLevelDiff, 1);
     set_entry(BranchingObjectComparison, BCP_HighestLowObjval);
     set_entry(ChildPreference, BCP_PreferChild_LowBound);
 
@@ -374,6 +491,10 @@ void BCP_parameter_set<BCP_lp_par>::set_default_entries() {
     set_entry(WarmstartInfo, BCP_WarmstartParent);
     set_entry(InfoForCG, BCP_PrimalSolution_Nonzeros);
     set_entry(InfoForVG, BCP_DualSolution_Full);
+    set_entry(HeuristicFrequency, 1);
+    set_entry(HeuristicMaxDepth, -1);
+    set_entry(HeuristicAdaptiveMinCalls, 10);
+    set_entry(HeuristicAdaptiveMaxInterval, 32);
     //-------------------------------------------------------------------------
     // DoublePar
     set_entry(Granularity, 1e-8);
@@ -382,6 +503,10 @@ void BCP_parameter_set<BCP_lp_par>::set_default_entries() {
     set_entry(MaxNonDualFeasToAdd_Frac, 0.05);
     set_entry(MaxLeftoverCutFrac, 1.0);
     set_entry(IntegerTolerance, 1e-5);
+    set_entry(DualSmoothingFactor, 0.0);
+    set_entry(DualBoxStepSize, 0.0);
+    set_entry(LagrangianGapTolerance, 0.0);
+    set_entry(LagrangianStallImprovement, 1e-4);
 
     set_entry(FirstLP_FirstCutTimeout, -1.0);
     set_entry(LaterLP_FirstCutTimeout, -1.0);
@@ -394,6 +519,9 @@ void BCP_parameter_set<BCP_lp_par>::set_default_entries() {
     set_entry(LaterLP_AllVarsTimeout, -1.0);
 
     set_entry(MaxRunTime, 3600.0); // one hour
+    set_entry(HeuristicMinGap, 0.0);
+    set_entry(HeuristicAdaptiveMinSuccessRate, 0.05);
+    set_entry(HeuristicMaxTimeFraction, 1.0);
     //-------------------------------------------------------------------------
     // StringPar
     set_entry(LogFileName,"");
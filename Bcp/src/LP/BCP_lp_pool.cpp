@@ -1,5 +1,10 @@
 // Copyright (C) 2000, International Business Machines
 // Corporation and others.  All Rights Reserved.
+#include "BcpConfig.h"
+#ifdef HAVE_PTHREAD_H
+#include <pthread.h>
+#endif
+
 #include "BCP_lp_pool.hpp"
 
 void
@@ -10,6 +15,164 @@ BCP_lp_waiting_row::compute_violation(const BCP_lp_result& lpres){
 						   lhs-_row->UpperBound()));
 }
 
+//#############################################################################
+
+void
+BCP_lp_cut_pool::clear_csr()
+{
+   iterator waiting_row = begin();
+   for ( ; waiting_row != end(); ++waiting_row)
+      (*waiting_row)->set_csr_pos(-1);
+   _csr_start.clear();
+   _csr_start.push_back(0);
+   _csr_ind.clear();
+   _csr_val.clear();
+   _csr_lb.clear();
+   _csr_ub.clear();
+}
+
+//-----------------------------------------------------------------------------
+
+void
+BCP_lp_cut_pool::append_to_csr(BCP_lp_waiting_row* wrow)
+{
+   const BCP_row* row = wrow->row();
+   const int len = row->getNumElements();
+   wrow->set_csr_pos(_csr_lb.size());
+   _csr_ind.append(row->getIndices(), row->getIndices() + len);
+   _csr_val.append(row->getElements(), row->getElements() + len);
+   _csr_start.push_back(_csr_ind.size());
+   _csr_lb.push_back(row->LowerBound());
+   _csr_ub.push_back(row->UpperBound());
+}
+
+//-----------------------------------------------------------------------------
+
+/** Compute the violations of the waiting rows in <code>[first,last)</code>,
+    all of which are in the CSR block. */
+static void
+BCP_compute_csr_violations(const int* start, const int* ind,
+			   const double* val,
+			   const double* lb, const double* ub,
+			   const double* x,
+			   BCP_lp_waiting_row** first,
+			   BCP_lp_waiting_row** last)
+{
+   for ( ; first != last; ++first) {
+      const int k = (*first)->csr_pos();
+      const int j = start[k];
+      (*first)->set_violation(BCP_row_violation(ind + j, val + j,
+						start[k+1] - j,
+						lb[k], ub[k], x));
+   }
+}
+
+//-----------------------------------------------------------------------------
+
+#ifdef HAVE_PTHREAD_H
+
+/** The arguments of the violation kernel for one thread. */
+struct BCP_csr_violation_data {
+   const int* start;
+   const int* ind;
+   const double* val;
+   const double* lb;
+   const double* ub;
+   const double* x;
+   BCP_lp_waiting_row** first;
+   BCP_lp_waiting_row** last;
+};
+
+static void*
+BCP_csr_violation_thread(void* arg)
+{
+   BCP_csr_violation_data& d = *static_cast<BCP_csr_violation_data*>(arg);
+   BCP_compute_csr_violations(d.start, d.ind, d.val, d.lb, d.ub, d.x,
+			      d.first, d.last);
+   return 0;
+}
+
+#endif
+
+//-----------------------------------------------------------------------------
+
+void
+BCP_lp_cut_pool::compute_violations(const BCP_lp_result& lpres,
+				    BCP_lp_cut_pool::iterator first, 
+				    BCP_lp_cut_pool::iterator last,
+				    const int thread_num)
+{
+   if (! _rows_are_valid)
+      throw BCP_fatal_error("\
+BCP_lp_cut_pool::compute_violations() : rows are not valid\n");
+
+   // Rebuild the block if most of it is holes. Rebuilding in the order of
+   // the pool keeps the rows that are swept together close to each other.
+   if (_csr_lb.size() > 2 * size() + 1000) {
+      clear_csr();
+      for (iterator waiting_row = begin(); waiting_row != end();
+	   ++waiting_row) {
+	 // rows outside of [first,last) may not be expanded yet
+	 if ((*waiting_row)->row())
+	    append_to_csr(*waiting_row);
+      }
+   } else {
+      for (iterator waiting_row = first; waiting_row != last; ++waiting_row) {
+	 if ((*waiting_row)->csr_pos() < 0)
+	    append_to_csr(*waiting_row);
+      }
+   }
+
+   const int* start = _csr_start.begin();
+   const int* ind = _csr_ind.begin();
+   const double* val = _csr_val.begin();
+   const double* lb = _csr_lb.begin();
+   const double* ub = _csr_ub.begin();
+   const double* x = lpres.x();
+
+#ifdef HAVE_PTHREAD_H
+   // a thread should get at least this many rows to be worth starting
+   const int min_rows_per_thread = 10000;
+   const int rownum = last - first;
+   const int tnum = std::min<int>(thread_num, rownum / min_rows_per_thread);
+   if (tnum > 1) {
+      BCP_vec<BCP_csr_violation_data> data;
+      data.reserve(tnum);
+      BCP_vec<pthread_t> threads(tnum, pthread_t());
+      BCP_vec<bool> started(tnum, false);
+      int t;
+      for (t = 0; t < tnum; ++t) {
+	 BCP_csr_violation_data d;
+	 d.start = start;
+	 d.ind = ind;
+	 d.val = val;
+	 d.lb = lb;
+	 d.ub = ub;
+	 d.x = x;
+	 d.first = first + (rownum * t) / tnum;
+	 d.last = first + (rownum * (t + 1)) / tnum;
+	 data.unchecked_push_back(d);
+      }
+      for (t = 0; t < tnum; ++t) {
+	 started[t] = pthread_create(&threads[t], NULL,
+				     BCP_csr_violation_thread, &data[t]) == 0;
+      }
+      for (t = 0; t < tnum; ++t) {
+	 if (started[t]) {
+	    pthread_join(threads[t], NULL);
+	 } else {
+	    BCP_csr_violation_thread(&data[t]);
+	 }
+      }
+      return;
+   }
+#endif
+
+   BCP_compute_csr_violations(start, ind, val, lb, ub, x, first, last);
+}
+
+//-----------------------------------------------------------------------------
+
 int
 BCP_lp_cut_pool::remove_nonviolated(const double etol)
 {
@@ -34,9 +197,167 @@ BCP_lp_cut_pool::remove_nonviolated(const double etol)
 void
 BCP_lp_waiting_col::compute_red_cost(const BCP_lp_result& lpres)
 {
-   _red_cost = _col->Objective() - _col->dotProduct(lpres.pi());
+   set_red_cost(_col->Objective() - _col->dotProduct(lpres.pi()));
+}
+
+//#############################################################################
+
+void
+BCP_lp_var_pool::clear_csc()
+{
+   iterator waiting_col = begin();
+   for ( ; waiting_col != end(); ++waiting_col)
+      (*waiting_col)->set_csc_pos(-1);
+   _csc_start.clear();
+   _csc_start.push_back(0);
+   _csc_ind.clear();
+   _csc_val.clear();
+   _csc_obj.clear();
+}
+
+//-----------------------------------------------------------------------------
+
+void
+BCP_lp_var_pool::append_to_csc(BCP_lp_waiting_col* wcol)
+{
+   const BCP_col* col = wcol->col();
+   const int len = col->getNumElements();
+   wcol->set_csc_pos(_csc_obj.size());
+   _csc_ind.append(col->getIndices(), col->getIndices() + len);
+   _csc_val.append(col->getElements(), col->getElements() + len);
+   _csc_start.push_back(_csc_ind.size());
+   _csc_obj.push_back(col->Objective());
+}
+
+//-----------------------------------------------------------------------------
+
+void
+BCP_lp_var_pool::update_csc(BCP_lp_var_pool::iterator first,
+			    BCP_lp_var_pool::iterator last)
+{
+   if (! _cols_are_valid)
+      throw BCP_fatal_error("\
+BCP_lp_var_pool::compute_red_costs() : cols are not valid\n");
+
+   if (_csc_obj.size() > 2 * size() + 1000) {
+      clear_csc();
+      for (iterator waiting_col = begin(); waiting_col != end();
+	   ++waiting_col) {
+	 // cols outside of [first,last) may not be expanded yet
+	 if ((*waiting_col)->col())
+	    append_to_csc(*waiting_col);
+      }
+   } else {
+      for (iterator waiting_col = first; waiting_col != last; ++waiting_col) {
+	 if ((*waiting_col)->csc_pos() < 0)
+	    append_to_csc(*waiting_col);
+      }
+   }
+}
+
+//-----------------------------------------------------------------------------
+
+/** The pricing kernel: compute the reduced costs of the waiting columns in
+    <code>[first,last)</code>, all of which are in the CSC block. */
+static void
+BCP_compute_csc_red_costs(const int* start, const int* ind,
+			  const double* val, const double* obj,
+			  const double* pi,
+			  BCP_lp_waiting_col** first,
+			  BCP_lp_waiting_col** last)
+{
+   for ( ; first != last; ++first) {
+      const int k = (*first)->csc_pos();
+      const int end = start[k+1];
+      int j = start[k];
+      double dp0 = 0.0;
+      double dp1 = 0.0;
+      for ( ; j + 1 < end; j += 2) {
+	 dp0 += val[j] * pi[ind[j]];
+	 dp1 += val[j+1] * pi[ind[j+1]];
+      }
+      if (j < end)
+	 dp0 += val[j] * pi[ind[j]];
+      (*first)->set_red_cost(obj[k] - (dp0 + dp1));
+   }
 }
 
+//-----------------------------------------------------------------------------
+
+void
+BCP_lp_var_pool::compute_red_costs(const BCP_lp_result& lpres,
+				   BCP_lp_var_pool::iterator first, 
+				   BCP_lp_var_pool::iterator last)
+{
+   update_csc(first, last);
+   BCP_compute_csc_red_costs(_csc_start.begin(), _csc_ind.begin(),
+			     _csc_val.begin(), _csc_obj.begin(), lpres.pi(),
+			     first, last);
+}
+
+//-----------------------------------------------------------------------------
+
+int
+BCP_lp_var_pool::compute_red_costs_partially(const BCP_lp_result& lpres,
+					     const double detol,
+					     const int max_negative)
+{
+   const int colnum = size();
+   if (colnum == 0)
+      return 0;
+   update_csc(begin(), end());
+   if (_price_start >= colnum)
+      _price_start = 0;
+
+   // price in chunks so that the kernel still sweeps contiguous ranges
+   const int chunk = 1000;
+   int negative = 0;
+   int priced = 0;
+   int pos = _price_start;
+   while (priced < colnum && negative < max_negative) {
+      const int len = std::min<int>(chunk, std::min<int>(colnum - pos,
+							 colnum - priced));
+      iterator first = entry(pos);
+      iterator last = entry(pos + len);
+      BCP_compute_csc_red_costs(_csc_start.begin(), _csc_ind.begin(),
+				_csc_val.begin(), _csc_obj.begin(),
+				lpres.pi(), first, last);
+      for ( ; first != last; ++first) {
+	 if ((*first)->red_cost() < -detol)
+	    ++negative;
+      }
+      priced += len;
+      pos += len;
+      if (pos == colnum)
+	 pos = 0;
+   }
+   _price_start = pos;
+
+   // the rest of the pool is left for the next round
+   for ( ; priced < colnum; ++priced) {
+      (*this)[pos]->set_unpriced();
+      if (++pos == colnum)
+	 pos = 0;
+   }
+   return negative;
+}
+
+//-----------------------------------------------------------------------------
+
+int
+BCP_lp_var_pool::priced_num() const
+{
+   int cnt = 0;
+   for (const_iterator waiting_col = begin(); waiting_col != end();
+	++waiting_col) {
+      if ((*waiting_col)->is_priced())
+	 ++cnt;
+   }
+   return cnt;
+}
+
+//-----------------------------------------------------------------------------
+
 int
 BCP_lp_var_pool::remove_positives(const double etol)
 {
@@ -45,7 +366,7 @@ BCP_lp_var_pool::remove_positives(const double etol)
 
    while (waiting_col != end()) {
       const double rc = (*waiting_col)->red_cost();
-      if (rc >= -etol) {
+      if ((*waiting_col)->is_priced() && rc >= -etol) {
 	 // printf("LP:    removing col with rc: %e (etol: %e)\n", rc, etol);
 	 delete *waiting_col;
 	 *waiting_col = back();
@@ -0,0 +1,256 @@
+// Copyright (C) 2000, International Business Machines
+// Corporation and others.  All Rights Reserved.
+#include <cmath>
+
+#include "CoinPackedMatrix.hpp"
+#include "OsiSolverInterface.hpp"
+
+#include "BCP_var.hpp"
+#include "BCP_lp_propagator.hpp"
+
+//#############################################################################
+
+// Activities (and the bounds derived from them) beyond this value are not
+// trusted, the cancellation error would be too large.
+static const double BCP_propagator_huge = 1e10;
+
+//#############################################################################
+
+bool
+BCP_lp_propagator::propagate(const OsiSolverInterface& lp,
+			     const BCP_vec<BCP_var*>& vars,
+			     const int max_row_visits,
+			     BCP_vec<int>& changed_pos, BCP_vec<double>& new_bd)
+{
+    changed_pos.clear();
+    new_bd.clear();
+
+    const int colnum = lp.getNumCols();
+    const int rownum = lp.getNumRows();
+    const double inf = lp.getInfinity();
+    double tol;
+    lp.getDblParam(OsiPrimalTolerance, tol);
+    const double inttol = 1e-6;
+
+    const double* clb = lp.getColLower();
+    const double* cub = lp.getColUpper();
+    const double* rlb = lp.getRowLower();
+    const double* rub = lp.getRowUpper();
+
+    // the bounds we work with
+    BCP_vec<double> lb(clb, clb + colnum);
+    BCP_vec<double> ub(cub, cub + colnum);
+    BCP_vec<char> changed(colnum, 0);
+
+    const CoinPackedMatrix* byRow = lp.getMatrixByRow();
+    const CoinPackedMatrix* byCol = lp.getMatrixByCol();
+    const int* rowStarts = byRow->getVectorStarts();
+    const int* rowLengths = byRow->getVectorLengths();
+    const int* rowInd = byRow->getIndices();
+    const double* rowElem = byRow->getElements();
+    const int* colStarts = byCol->getVectorStarts();
+    const int* colLengths = byCol->getVectorLengths();
+    const int* colInd = byCol->getIndices();
+
+    int i, j, k;
+
+    // seed the queue
+    _queue.clear();
+    _in_queue.clear();
+    _in_queue.insert(_in_queue.end(), rownum, 0);
+    // A snapshot of a different size means that a change of the LP was not
+    // followed by reset(). Recover as if it had been.
+    if (_valid && (colnum != static_cast<int>(_col_lb.size()) ||
+		   rownum != static_cast<int>(_row_lb.size()))) {
+	_valid = false;
+    }
+    if (! _valid) {
+	for (i = 0; i < rownum; ++i)
+	    _enqueue(i);
+    } else {
+	for (i = 0; i < rownum; ++i) {
+	    if (rlb[i] != _row_lb[i] || rub[i] != _row_ub[i])
+		_enqueue(i);
+	}
+	for (j = 0; j < colnum; ++j) {
+	    if (clb[j] != _col_lb[j] || cub[j] != _col_ub[j]) {
+		const int* ind = colInd + colStarts[j];
+		const int* lastind = ind + colLengths[j];
+		for ( ; ind != lastind; ++ind)
+		    _enqueue(*ind);
+	    }
+	}
+    }
+
+    bool feasible = true;
+    int visits = 0;
+    for (int head = 0;
+	 feasible && head < static_cast<int>(_queue.size()) &&
+	     visits < max_row_visits;
+	 ++head, ++visits) {
+	const int row = _queue[head];
+	_in_queue[row] = 0;
+	const double rowlb = rlb[row];
+	const double rowub = rub[row];
+	const int* ind = rowInd + rowStarts[row];
+	const double* elem = rowElem + rowStarts[row];
+	const int len = rowLengths[row];
+
+	// The finite part of the min/max activity and the number of infinite
+	// contributions to them
+	double minact = 0.0;
+	double maxact = 0.0;
+	int mininf = 0;
+	int maxinf = 0;
+	for (k = 0; k < len; ++k) {
+	    const double a = elem[k];
+	    const double l = lb[ind[k]];
+	    const double u = ub[ind[k]];
+	    if (a > 0) {
+		if (l <= -inf) ++mininf; else minact += a * l;
+		if (u >= inf)  ++maxinf; else maxact += a * u;
+	    } else {
+		if (u >= inf)  ++mininf; else minact += a * u;
+		if (l <= -inf) ++maxinf; else maxact += a * l;
+	    }
+	}
+
+	if (mininf == 0 && minact > rowub + tol * (1 + std::abs(rowub))) {
+	    feasible = false;
+	    break;
+	}
+	if (maxinf == 0 && maxact < rowlb - tol * (1 + std::abs(rowlb))) {
+	    feasible = false;
+	    break;
+	}
+
+	// Nothing can be derived if neither side gives a finite residual
+	// activity for any of the columns
+	const bool use_ub = rowub < inf && mininf <= 1 &&
+	    std::abs(minact) < BCP_propagator_huge;
+	const bool use_lb = rowlb > -inf && maxinf <= 1 &&
+	    std::abs(maxact) < BCP_propagator_huge;
+	if (! use_ub && ! use_lb)
+	    continue;
+
+	for (k = 0; k < len; ++k) {
+	    const double a = elem[k];
+	    if (std::abs(a) < 1e-9)
+		continue;
+	    j = ind[k];
+	    const double l = lb[j];
+	    const double u = ub[j];
+	    // the min/max activity of the row without column j. The activities
+	    // above may use a looser bound of j than the current one (if j was
+	    // tightened while processing this row) which only makes the
+	    // derived bounds weaker, but still valid.
+	    const double minpart = a > 0 ? l : u;
+	    const double maxpart = a > 0 ? u : l;
+	    const bool mininfpart = a > 0 ? (l <= -inf) : (u >= inf);
+	    const bool maxinfpart = a > 0 ? (u >= inf) : (l <= -inf);
+	    double newlb = l;
+	    double newub = u;
+	    if (use_ub && mininf == (mininfpart ? 1 : 0)) {
+		const double resmin =
+		    mininfpart ? minact : minact - a * minpart;
+		const double bd = (rowub - resmin) / a;
+		if (a > 0) {
+		    if (bd < newub) newub = bd;
+		} else {
+		    if (bd > newlb) newlb = bd;
+		}
+	    }
+	    if (use_lb && maxinf == (maxinfpart ? 1 : 0)) {
+		const double resmax =
+		    maxinfpart ? maxact : maxact - a * maxpart;
+		const double bd = (rowlb - resmax) / a;
+		if (a > 0) {
+		    if (bd > newlb) newlb = bd;
+		} else {
+		    if (bd < newub) newub = bd;
+		}
+	    }
+
+	    bool tightened = false;
+	    if (vars[j]->var_type() != BCP_ContinuousVar) {
+		newlb = ceil(newlb - inttol);
+		newub = floor(newub + inttol);
+		if (newlb > l + 0.5 && newlb > -BCP_propagator_huge) {
+		    lb[j] = newlb;
+		    tightened = true;
+		}
+		if (newub < u - 0.5 && newub < BCP_propagator_huge) {
+		    ub[j] = newub;
+		    tightened = true;
+		}
+	    } else {
+		// For continuous columns insist on a significant improvement,
+		// otherwise tiny changes could go on forever. Also relax the
+		// new bounds a bit for numerical safety.
+		const double lbslack = tol * (1 + std::abs(newlb));
+		const double ubslack = tol * (1 + std::abs(newub));
+		const double lbmin =
+		    l <= -inf ? -BCP_propagator_huge : l + 1e-3 * (1 + std::abs(l));
+		const double ubmax =
+		    u >= inf ? BCP_propagator_huge : u - 1e-3 * (1 + std::abs(u));
+		if (newlb > lbmin) {
+		    lb[j] = newlb - lbslack;
+		    tightened = true;
+		}
+		if (newub < ubmax) {
+		    ub[j] = newub + ubslack;
+		    tightened = true;
+		}
+	    }
+	    if (! tightened)
+		continue;
+
+	    if (lb[j] > ub[j] + tol * (1 + std::abs(ub[j]))) {
+		feasible = false;
+		break;
+	    }
+	    if (lb[j] > ub[j]) {
+		// within tolerance; fix the column
+		lb[j] = ub[j];
+	    }
+	    changed[j] = 1;
+	    const int* cind = colInd + colStarts[j];
+	    const int* lastcind = cind + colLengths[j];
+	    for ( ; cind != lastcind; ++cind)
+		_enqueue(*cind);
+	}
+    }
+
+    if (! feasible) {
+	_valid = false;
+	return false;
+    }
+
+    for (j = 0; j < colnum; ++j) {
+	if (changed[j]) {
+	    changed_pos.push_back(j);
+	    new_bd.push_back(lb[j]);
+	    new_bd.push_back(ub[j]);
+	}
+    }
+
+    // Record what the LP will look like once the changes are applied. The
+    // rows still in the queue (the work limit was hit) are not finished, so
+    // record impossible bounds for them to have them processed next time.
+    _col_lb.swap(lb);
+    _col_ub.swap(ub);
+    _row_lb.clear();
+    _row_lb.insert(_row_lb.end(), rlb, rlb + rownum);
+    _row_ub.clear();
+    _row_ub.insert(_row_ub.end(), rub, rub + rownum);
+    const int queuelen = _queue.size();
+    for (i = 0; i < queuelen; ++i) {
+	if (_in_queue[_queue[i]]) {
+	    _row_lb[_queue[i]] = inf;
+	    _row_ub[_queue[i]] = -inf;
+	}
+    }
+    _valid = true;
+
+    return true;
+}
@@ -0,0 +1,71 @@
+// Copyright (C) 2000, International Business Machines
+// Corporation and others.  All Rights Reserved.
+#include "CoinHelperFunctions.hpp"
+#include "BCP_lp_pseudocost.hpp"
+
+//#############################################################################
+
+double
+BCP_lp_pseudocosts::down(const int bcpind) const
+{
+    std::map<int, BCP_pseudocost_entry>::const_iterator c = _costs.find(bcpind);
+    if (c != _costs.end() && c->second.down_num > 0)
+	return c->second.down_sum / c->second.down_num;
+    return _down_num > 0 ? _down_sum / _down_num : 1.0;
+}
+
+//-----------------------------------------------------------------------------
+
+double
+BCP_lp_pseudocosts::up(const int bcpind) const
+{
+    std::map<int, BCP_pseudocost_entry>::const_iterator c = _costs.find(bcpind);
+    if (c != _costs.end() && c->second.up_num > 0)
+	return c->second.up_sum / c->second.up_num;
+    return _up_num > 0 ? _up_sum / _up_num : 1.0;
+}
+
+//-----------------------------------------------------------------------------
+
+int
+BCP_lp_pseudocosts::reliability(const int bcpind) const
+{
+    std::map<int, BCP_pseudocost_entry>::const_iterator c = _costs.find(bcpind);
+    if (c == _costs.end())
+	return 0;
+    return CoinMin(c->second.down_num, c->second.up_num);
+}
+
+//-----------------------------------------------------------------------------
+
+double
+BCP_lp_pseudocosts::score(const int bcpind, const double frac) const
+{
+    const double eps = 1e-6;
+    return (CoinMax(down(bcpind) * frac, eps) *
+	    CoinMax(up(bcpind) * (1.0 - frac), eps));
+}
+
+//#############################################################################
+
+void
+BCP_lp_pseudocosts::update(const int bcpind, const bool up,
+			   const double change, const double objchange)
+{
+    if (change <= 1e-9)
+	return;
+    // the objective can't really decrease in a child, it's just numerics
+    const double unit_change = CoinMax(objchange, 0.0) / change;
+    BCP_pseudocost_entry& entry = _costs[bcpind];
+    if (up) {
+	entry.up_sum += unit_change;
+	++entry.up_num;
+	_up_sum += unit_change;
+	++_up_num;
+    } else {
+	entry.down_sum += unit_change;
+	++entry.down_num;
+	_down_sum += unit_change;
+	++_down_num;
+    }
+}
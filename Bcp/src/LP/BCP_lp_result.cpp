@@ -2,6 +2,7 @@
 // Corporation and others.  All Rights Reserved.
 
 #include "CoinHelperFunctions.hpp"
+#include "CoinPackedMatrix.hpp"
 #include "OsiSolverInterface.hpp"
 #include "BCP_lp_result.hpp"
 
@@ -53,3 +54,49 @@ BCP_lp_result::get_results(OsiSolverInterface& lp)
     CoinDisjointCopyN(lp.getRowActivity(), rownum, _lhs);
   }
 }
+
+//#############################################################################
+
+void
+BCP_lp_result::set_duals(const OsiSolverInterface& lp,
+			 const BCP_lp_result& res, const double* pi)
+{
+  _solvername = res._solvername;
+  _lower_bound = res._lower_bound;
+  _primal_tolerance = res._primal_tolerance;
+  _dual_tolerance = res._dual_tolerance;
+  _termcode = res._termcode;
+  _iternum = res._iternum;
+  _objval = res._objval;
+
+  delete[] _x;
+  delete[] _pi;
+  delete[] _dj;
+  delete[] _lhs;
+  _x = 0;
+  _pi = 0;
+  _dj = 0;
+  _lhs = 0;
+
+  const int colnum = lp.getNumCols();
+  const int rownum = lp.getNumRows();
+  if (res._x) {
+    _x = new double[colnum];
+    CoinDisjointCopyN(res._x, colnum, _x);
+  }
+  if (res._lhs) {
+    _lhs = new double[rownum];
+    CoinDisjointCopyN(res._lhs, rownum, _lhs);
+  }
+  _pi = new double[rownum];
+  CoinDisjointCopyN(pi, rownum, _pi);
+  if (res._dj) {
+    // dj = c - A^T pi
+    _dj = new double[colnum];
+    lp.getMatrixByCol()->transposeTimes(_pi, _dj);
+    const double* obj = lp.getObjCoefficients();
+    for (int i = 0; i < colnum; ++i) {
+      _dj[i] = obj[i] - _dj[i];
+    }
+  }
+}
@@ -0,0 +1,49 @@
+// Copyright (C) 2000, International Business Machines
+// Corporation and others.  All Rights Reserved.
+#include <cstdlib>
+#include "BCP_lp_sb_cache.hpp"
+
+//#############################################################################
+
+const BCP_sb_cache_entry*
+BCP_lp_sb_cache::find(const int bcpind, const double lb, const double ub,
+		      const int level, const int max_level_diff) const
+{
+    std::map<BCP_sb_cache_key, BCP_sb_cache_entry>::const_iterator e =
+	_entries.find(BCP_sb_cache_key(bcpind, lb, ub));
+    if (e == _entries.end() || abs(e->second.level - level) > max_level_diff)
+	return 0;
+    return &e->second;
+}
+
+//#############################################################################
+
+void
+BCP_lp_sb_cache::new_round(const int max_age)
+{
+    ++_round;
+    std::map<BCP_sb_cache_key, BCP_sb_cache_entry>::iterator e =
+	_entries.begin();
+    while (e != _entries.end()) {
+	if (_round - e->second.round > max_age) {
+	    _entries.erase(e++);
+	} else {
+	    ++e;
+	}
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void
+BCP_lp_sb_cache::insert(const int bcpind, const double lb, const double ub,
+			const int level, const int termcode, const int iternum,
+			const double objchange)
+{
+    BCP_sb_cache_entry& entry = _entries[BCP_sb_cache_key(bcpind, lb, ub)];
+    entry.objchange = objchange;
+    entry.termcode = termcode;
+    entry.iternum = iternum;
+    entry.level = level;
+    entry.round = _round;
+}
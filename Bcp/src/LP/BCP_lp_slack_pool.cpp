@@ -0,0 +1,140 @@
+// Copyright (C) 2000, International Business Machines
+// Corporation and others.  All Rights Reserved.
+#include <algorithm>
+#include <functional>
+
+#include "BCP_cut.hpp"
+#include "BCP_matrix.hpp"
+#include "BCP_lp_slack_pool.hpp"
+
+//#############################################################################
+
+void
+BCP_lp_slack_pool::_remove(const int i, const bool destroy)
+{
+    if (destroy) {
+	delete _cuts[i];
+	delete _rows[i];
+    }
+    const int last = _cuts.size() - 1;
+    if (i != last) {
+	_cuts[i] = _cuts[last];
+	_rows[i] = _rows[last];
+	_violation[i] = _violation[last];
+	_age[i] = _age[last];
+	_node[i] = _node[last];
+	_last_used[i] = _last_used[last];
+    }
+    _cuts.pop_back();
+    _rows.pop_back();
+    _violation.pop_back();
+    _age.pop_back();
+    _node.pop_back();
+    _last_used.pop_back();
+}
+
+//-----------------------------------------------------------------------------
+
+bool
+BCP_lp_slack_pool::is_on_path(const int i) const
+{
+    return std::find(_path.begin(), _path.end(), _node[i]) != _path.end();
+}
+
+//-----------------------------------------------------------------------------
+
+void
+BCP_lp_slack_pool::new_node(const int index, const bool dived)
+{
+    if (! dived)
+	_path.clear();
+    _path.push_back(index);
+}
+
+//-----------------------------------------------------------------------------
+
+void
+BCP_lp_slack_pool::add(BCP_cut* cut, const int node, const int max_size)
+{
+    if (max_size > 0 && size() >= max_size) {
+	// discard the least recently used cut (the oldest one among those)
+	const int lru = std::min_element(_last_used.begin(), _last_used.end())
+	    - _last_used.begin();
+	_remove(lru, true);
+    }
+    _cuts.push_back(cut);
+    _rows.push_back(0);
+    _violation.push_back(0.0);
+    _age.push_back(0);
+    _node.push_back(node);
+    _last_used.push_back(_clock);
+}
+
+//-----------------------------------------------------------------------------
+
+void
+BCP_lp_slack_pool::set_row(const int i, BCP_row*& row)
+{
+    delete _rows[i];
+    _rows[i] = row;
+    row = 0;
+}
+
+//-----------------------------------------------------------------------------
+
+void
+BCP_lp_slack_pool::delete_rows()
+{
+    const int num = size();
+    for (int i = 0; i < num; ++i) {
+	delete _rows[i];
+	_rows[i] = 0;
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void
+BCP_lp_slack_pool::set_violation(const int i, const double viol,
+				 const double tol)
+{
+    _violation[i] = viol;
+    if (viol > tol) {
+	_last_used[i] = _clock;
+    } else {
+	++_age[i];
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void
+BCP_lp_slack_pool::take(const int i, BCP_cut*& cut, BCP_row*& row)
+{
+    cut = _cuts[i];
+    row = _rows[i];
+    _remove(i, false);
+}
+
+//-----------------------------------------------------------------------------
+
+void
+BCP_lp_slack_pool::purge(const BCP_vec<int>& pos)
+{
+    BCP_vec<int> sorted(pos);
+    // remove from the back so that the positions stay valid
+    std::sort(sorted.begin(), sorted.end(), std::greater<int>());
+    sorted.erase(std::unique(sorted.begin(), sorted.end()), sorted.end());
+    const int num = sorted.size();
+    for (int i = 0; i < num; ++i)
+	_remove(sorted[i], true);
+}
+
+//-----------------------------------------------------------------------------
+
+void
+BCP_lp_slack_pool::clear()
+{
+    for (int i = size() - 1; i >= 0; --i)
+	_remove(i, true);
+}
@@ -0,0 +1,104 @@
+// Copyright (C) 2000, International Business Machines
+// Corporation and others.  All Rights Reserved.
+#include <algorithm>
+
+#include "OsiSolverInterface.hpp"
+
+#include "BCP_lp_stabilizer.hpp"
+
+//#############################################################################
+
+// The box is dropped after this many mispricings
+static const int BCP_stabilizer_max_box_misprices = 3;
+
+//#############################################################################
+
+double
+BCP_lp_dual_stabilizer::alpha() const
+{
+    if (_alpha <= 0.0)
+	return 0.0;
+    return std::max(0.0, 1.0 - (_misprices + 1) * (1.0 - _alpha));
+}
+
+//-----------------------------------------------------------------------------
+
+void
+BCP_lp_dual_stabilizer::_stabilize(const OsiSolverInterface& lp,
+				   const BCP_lp_result& lpres)
+{
+    const double alpha = this->alpha();
+    const double box =
+	_box > 0.0 && _misprices < BCP_stabilizer_max_box_misprices ?
+	_box * (1 << _misprices) : 0.0;
+    if (alpha <= 0.0 && box <= 0.0) {
+	_active = false;
+	return;
+    }
+
+    const int rownum = _center.size();
+    const double* pi = lpres.pi();
+    BCP_vec<double> stab(rownum, 0.0);
+    for (int i = 0; i < rownum; ++i) {
+	double d = alpha * _center[i] + (1.0 - alpha) * pi[i];
+	if (box > 0.0) {
+	    // Both the center and pi have the right sign, and so has the
+	    // projection of their convex combination to the box
+	    d = std::min(std::max(d, _center[i] - box), _center[i] + box);
+	}
+	stab[i] = d;
+    }
+    _result.set_duals(lp, lpres, stab.begin());
+    _active = true;
+}
+
+//-----------------------------------------------------------------------------
+
+void
+BCP_lp_dual_stabilizer::start_round(const OsiSolverInterface& lp,
+				    const BCP_lp_result& lpres,
+				    const double alpha, const double box)
+{
+    _alpha = alpha;
+    _box = box;
+    _misprices = 0;
+    _active = false;
+
+    const int rownum = lp.getNumRows();
+    const double* pi = lpres.pi();
+    if (pi == 0)
+	return;
+    if (static_cast<int>(_center.size()) != rownum) {
+	_center.clear();
+	_center.insert(_center.end(), pi, pi + rownum);
+	return;
+    }
+    _stabilize(lp, lpres);
+}
+
+//-----------------------------------------------------------------------------
+
+bool
+BCP_lp_dual_stabilizer::misprice(const OsiSolverInterface& lp,
+				 const BCP_lp_result& lpres)
+{
+    if (! _active)
+	return false;
+    ++_misprices;
+    _stabilize(lp, lpres);
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+
+void
+BCP_lp_dual_stabilizer::end_round(const BCP_lp_result& lpres,
+				  const bool success)
+{
+    if (success) {
+	const double* pi = pricing_result(lpres).pi();
+	if (pi)
+	    std::copy(pi, pi + _center.size(), _center.begin());
+    }
+    _active = false;
+}
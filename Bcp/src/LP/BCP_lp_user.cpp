@@ -2,6 +2,7 @@
 // Corporation and others.  All Rights Reserved.
 #include <cmath>
 #include <cstdarg>
+#include <algorithm>
 #include <cstdio>
 
 #include "CoinHelperFunctions.hpp"
@@ -92,6 +93,16 @@ BCP_lp_user::send_feasible_solution(const BCP_solution* sol)
     }
 }
 
+//-----------------------------------------------------------------------------
+
+void
+BCP_lp_user::report_pricing_bound(const int subproblem, const double min_rc,
+				  const double multiplicity,
+				  const double min_rc_ratio)
+{
+    p->lagrangian.report(subproblem, min_rc, multiplicity, min_rc_ratio);
+}
+
 //#############################################################################
 
 // These functions are member functions of the VIRTUAL class BCP_lp_user.
@@ -859,6 +870,43 @@ BCP_lp_user::generate_vars_in_lp(const BCP_lp_result& lpres,
 	  "LP: Default generate_vars_in_lp() executed.\n");
 }
 //-----------------------------------------------------------------------------
+int
+BCP_lp_user::separator_num()
+{
+    return 0;
+}
+//-----------------------------------------------------------------------------
+void
+BCP_lp_user::run_separator(const int sep,
+			   const BCP_lp_result& lpres,
+			   const BCP_vec<BCP_var*>& vars,
+			   const BCP_vec<BCP_cut*>& cuts,
+			   BCP_vec<BCP_cut*>& new_cuts,
+			   BCP_vec<BCP_row*>& new_rows)
+{
+    throw BCP_fatal_error("\
+LP: separator_num() is overridden but run_separator() is not.\n");
+}
+//-----------------------------------------------------------------------------
+int
+BCP_lp_user::pricer_num()
+{
+    return 0;
+}
+//-----------------------------------------------------------------------------
+void
+BCP_lp_user::run_pricer(const int pricer,
+			const BCP_lp_result& lpres,
+			const BCP_vec<BCP_var*>& vars,
+			const BCP_vec<BCP_cut*>& cuts,
+			const bool before_fathom,
+			BCP_vec<BCP_var*>& new_vars,
+			BCP_vec<BCP_col*>& new_cols)
+{
+    throw BCP_fatal_error("\
+LP: pricer_num() is overridden but run_pricer() is not.\n");
+}
+//-----------------------------------------------------------------------------
 BCP_object_compare_result
 BCP_lp_user::compare_cuts(const BCP_cut* c0, const BCP_cut* c1)
 {
@@ -887,11 +935,18 @@ BCP_lp_user::select_vars_to_delete(const BCP_lp_result& lpres,
     if (before_fathom && p->param(BCP_lp_par::NoCompressionAtFathom))
 	return;
     const int varnum = vars.size();
+    // ineffective vars are deleted only if pricing can bring them back
+    const int ineff_to_delete =
+	p->node->colgen == BCP_GenerateColumns ?
+	p->param(BCP_lp_par::IneffectiveColsBeforeDelete) : 0;
     deletable.reserve(varnum);
     for (int i = p->core->varnum(); i < varnum; ++i) {
 	BCP_var *var = vars[i];
 	if (var->is_to_be_removed() ||
-	    (! var->is_non_removable() && var->lb() == 0 && var->ub() == 0)) {
+	    (! var->is_non_removable() &&
+	     ((var->lb() == 0 && var->ub() == 0) ||
+	      (ineff_to_delete > 0 &&
+	       var->effective_count() <= -ineff_to_delete)))) {
 	    deletable.unchecked_push_back(i);
 	}
     }
@@ -1120,6 +1175,13 @@ LP: ############ LP solver abandoned. Branching through...\n");
 	(local_var_pool.size() > 0 || local_cut_pool.size() > 0))
 	return BCP_DoNotBranch;
 
+    if (p->param(BCP_lp_par::PseudoCostReliability) > 0) {
+	if (select_branching_candidates_by_pseudocost(lpres, vars, cands))
+	    return BCP_DoBranch;
+	// no fractional integer variable, maybe an SOS is violated. Let
+	// OsiChooseStrong figure it out.
+    }
+
     OsiSolverInterface* lp = p->lp_solver;
 
     /* The last true: make a copy in brInfo of the sol of solver
@@ -1244,6 +1306,71 @@ BCP: BCP_lp_user::try_to_branch returned with unknown return code.\n");
     return BCP_DoBranch;
 }
 
+//-----------------------------------------------------------------------------
+// Entries are (score, position) pairs and sorted in decreasing order of the
+// score.
+static inline bool
+BCP_higher_score(const std::pair<double,int>& a,
+		 const std::pair<double,int>& b)
+{
+    return a.first > b.first;
+}
+
+bool
+BCP_lp_user::select_branching_candidates_by_pseudocost(
+			      const BCP_lp_result& lpres,
+			      const BCP_vec<BCP_var*>& vars,
+			      BCP_vec<BCP_lp_branching_object*>& cands)
+{
+    const double etol = p->param(BCP_lp_par::IntegerTolerance);
+    const int reliable = p->param(BCP_lp_par::PseudoCostReliability);
+    const int strong_num = p->param(BCP_lp_par::StrongBranchNum);
+    const BCP_lp_pseudocosts& pc = p->pseudocosts;
+    const double* x = lpres.x();
+
+    std::vector< std::pair<double,int> > fracs;
+    const int varnum = vars.size();
+    for (int i = 0; i < varnum; ++i) {
+	if (vars[i]->var_type() == BCP_ContinuousVar)
+	    continue;
+	const double frac = x[i] - floor(x[i]);
+	if (frac > etol && frac < 1 - etol) {
+	    fracs.push_back(std::make_pair(pc.score(vars[i]->bcpind(), frac),
+					   i));
+	}
+    }
+    if (fracs.empty())
+	return false;
+    std::sort(fracs.begin(), fracs.end(), BCP_higher_score);
+
+    // Go down in the order of the scores. The unreliable ones will be
+    // presolved (at most strong_num of them). Once we see a reliable
+    // variable we can stop: its estimate is trusted and the rest of the
+    // variables have worse scores.
+    BCP_vec<int> select_pos;
+    bool best_is_reliable = false;
+    const int fracnum = fracs.size();
+    for (int i = 0; i < fracnum; ++i) {
+	const int pos = fracs[i].second;
+	if (pc.reliability(vars[pos]->bcpind()) >= reliable) {
+	    best_is_reliable = select_pos.empty();
+	    select_pos.push_back(pos);
+	    break;
+	}
+	if (static_cast<int>(select_pos.size()) < strong_num) {
+	    select_pos.push_back(pos);
+	}
+    }
+    const int first = cands.size();
+    append_branching_vars(x, vars, select_pos, cands);
+    if (best_is_reliable) {
+	// the best ranked variable is reliable, branch on it without
+	// presolving
+	cands[first]->reliable_ = true;
+    }
+    return true;
+}
+
 //-----------------------------------------------------------------------------
 void
 BCP_lp_user::append_branching_vars(const double* x,
@@ -1395,6 +1522,21 @@ compare_branching_candidates(BCP_presolved_lp_brobj* new_presolved,
 	    }
 	    return old_first == old_last ?
 		BCP_OldPresolvedIsBetter : BCP_NewPresolvedIsBetter;
+
+	case BCP_HighestProductObjval:
+	    {
+		// the children that are not fathomed are in the front
+		const double z = p->lp_result->objval();
+		const double eps = 1e-6;
+		double newprod = 1.0;
+		for (int i = 0; i < new_not_fathomed; ++i)
+		    newprod *= CoinMax(new_obj[i] - z, eps);
+		double oldprod = 1.0;
+		for (int i = 0; i < old_not_fathomed; ++i)
+		    oldprod *= CoinMax(old_obj[i] - z, eps);
+		return newprod > oldprod ?
+		    BCP_NewPresolvedIsBetter : BCP_OldPresolvedIsBetter;
+	    }
 	default:
 	    throw BCP_fatal_error("\
 Unknown branching object comparison rule.\n");
@@ -1512,6 +1654,9 @@ BCP_lp_user::purge_slack_pool(const BCP_vec<BCP_cut*>& slack_pool,
 	    }
 	}
 	break;
+    case BCP_DiscardSlackCutsLeastRecentlyUsed:
+	// the pool itself discards the least recently used cuts when full
+	break;
     }
 }
 
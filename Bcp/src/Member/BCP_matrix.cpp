@@ -1,8 +1,11 @@
 // Copyright (C) 2000, International Business Machines
 // Corporation and others.  All Rights Reserved.
+#include <cmath>
+#include <cstring>
 #include <numeric>
 #include <algorithm>
 #include <functional>
+#include <utility>
 
 using std::sort;
 using std::copy;
@@ -15,6 +18,180 @@ using std::fill;
 #include "BCP_error.hpp"
 #include "BCP_matrix.hpp"
 
+//#############################################################################
+// Hashing and comparing rows/columns up to positive scaling
+
+/** Mix the bits of <code>h</code>. */
+static inline size_t
+BCP_hash_mix(size_t h)
+{
+   h ^= h >> 15;
+   h *= 2246822519U;
+   h ^= h >> 13;
+   h *= 3266489917U;
+   h ^= h >> 16;
+   return h;
+}
+
+/** Return whether the value is considered infinite. */
+static inline bool
+BCP_is_infinite(const double val)
+{
+   return std::fabs(val) >= BCP_DBL_MAX / 10;
+}
+
+/** Divide a (finite) value by <code>scale</code>. */
+static inline double
+BCP_scaled(const double val, const double scale)
+{
+   return BCP_is_infinite(val) ? val : val / scale;
+}
+
+/** Hash a double rounded on the scale of the tolerance of
+    <code>BCP_same_double()</code>: to 1e-9 if its absolute value is at most
+    1, otherwise to 1e-9 times the smallest power of 2 not less than its
+    absolute value. Thus values that are the same (up to the tolerance)
+    have the same hash, unless they straddle a rounding boundary or a power
+    of 2; such near-duplicates are missed. */
+static inline size_t
+BCP_hash_double(const double val)
+{
+   if (BCP_is_infinite(val))
+      return val > 0 ? 1 : 2;
+   double step = 1e-9;
+   if (std::fabs(val) > 1.0) {
+      int e;
+      std::frexp(val, &e);
+      step = std::ldexp(1e-9, e);
+   }
+   const double q = std::floor(val / step + 0.5);
+   unsigned int w[sizeof(double) / sizeof(unsigned int)];
+   memcpy(w, &q, sizeof(double));
+   size_t h = 0;
+   for (size_t i = 0; i < sizeof(double) / sizeof(unsigned int); ++i)
+      h = BCP_hash_mix(h ^ w[i]);
+   return h;
+}
+
+/** Whether two (already scaled) values are the same. */
+static inline bool
+BCP_same_double(const double a, const double b)
+{
+   if (BCP_is_infinite(a) || BCP_is_infinite(b))
+      return BCP_is_infinite(a) && BCP_is_infinite(b) && (a > 0) == (b > 0);
+   return std::fabs(a - b) <= 1e-9 * std::max<double>(1.0, std::fabs(a));
+}
+
+/** The largest absolute value in the packed vector. */
+static inline double
+BCP_max_abs(const CoinPackedVectorBase& vec)
+{
+   const int size = vec.getNumElements();
+   const double* val = vec.getElements();
+   double m = 0.0;
+   for (int i = 0; i < size; ++i)
+      m = std::max<double>(m, std::fabs(val[i]));
+   return m;
+}
+
+/** Hash the entries of the packed vector divided by <code>scale</code>. The
+    hashes of the entries are added up, thus the order does not matter. */
+static size_t
+BCP_hash_packed(const CoinPackedVectorBase& vec, const double scale)
+{
+   const int size = vec.getNumElements();
+   const int* ind = vec.getIndices();
+   const double* val = vec.getElements();
+   size_t h = BCP_hash_mix(size);
+   for (int i = 0; i < size; ++i)
+      h += BCP_hash_mix(ind[i] * 2654435761U ^ BCP_hash_double(val[i]/scale));
+   return h;
+}
+
+/** Compare the entries of two packed vectors divided by their scales. */
+static bool
+BCP_same_packed(const CoinPackedVectorBase& vec0, const double scale0,
+		const CoinPackedVectorBase& vec1, const double scale1)
+{
+   const int size = vec0.getNumElements();
+   if (size != vec1.getNumElements())
+      return false;
+   BCP_vec< std::pair<int, double> > e0;
+   BCP_vec< std::pair<int, double> > e1;
+   e0.reserve(size);
+   e1.reserve(size);
+   for (int i = 0; i < size; ++i) {
+      e0.unchecked_push_back(std::make_pair(vec0.getIndices()[i],
+					    vec0.getElements()[i] / scale0));
+      e1.unchecked_push_back(std::make_pair(vec1.getIndices()[i],
+					    vec1.getElements()[i] / scale1));
+   }
+   std::sort(e0.begin(), e0.end());
+   std::sort(e1.begin(), e1.end());
+   for (int i = 0; i < size; ++i) {
+      if (e0[i].first != e1[i].first ||
+	  ! BCP_same_double(e0[i].second, e1[i].second))
+	 return false;
+   }
+   return true;
+}
+
+//-----------------------------------------------------------------------------
+
+// Columns are not scaled: a positive multiple of an integer column is a
+// different variable.
+
+size_t
+BCP_col::hash_value() const
+{
+   size_t h = BCP_hash_packed(*this, 1.0);
+   h = BCP_hash_mix(h ^ BCP_hash_double(_Objective));
+   h = BCP_hash_mix(h ^ BCP_hash_double(_LowerBound));
+   h = BCP_hash_mix(h ^ BCP_hash_double(_UpperBound));
+   return h;
+}
+
+bool
+BCP_col::is_same(const BCP_col& x) const
+{
+   return (BCP_same_double(_LowerBound, x.LowerBound()) &&
+	   BCP_same_double(_UpperBound, x.UpperBound()) &&
+	   BCP_same_double(_Objective, x.Objective()) &&
+	   BCP_same_packed(*this, 1.0, x, 1.0));
+}
+
+//-----------------------------------------------------------------------------
+
+/** The scale of a row: the largest absolute coefficient. */
+static inline double
+BCP_row_scale(const BCP_row& row)
+{
+   const double scale = BCP_max_abs(row);
+   return scale > 0 ? scale : 1.0;
+}
+
+size_t
+BCP_row::hash_value() const
+{
+   const double scale = BCP_row_scale(*this);
+   size_t h = BCP_hash_packed(*this, scale);
+   h = BCP_hash_mix(h ^ BCP_hash_double(BCP_scaled(_LowerBound, scale)));
+   h = BCP_hash_mix(h ^ BCP_hash_double(BCP_scaled(_UpperBound, scale)));
+   return h;
+}
+
+bool
+BCP_row::is_same_up_to_scaling(const BCP_row& x) const
+{
+   const double scale = BCP_row_scale(*this);
+   const double xscale = BCP_row_scale(x);
+   return (BCP_same_double(BCP_scaled(_LowerBound, scale),
+			   BCP_scaled(x.LowerBound(), xscale)) &&
+	   BCP_same_double(BCP_scaled(_UpperBound, scale),
+			   BCP_scaled(x.UpperBound(), xscale)) &&
+	   BCP_same_packed(*this, scale, x, xscale));
+}
+
 //#############################################################################
 
 BCP_lp_relax::BCP_lp_relax(const BCP_lp_relax& mat) :
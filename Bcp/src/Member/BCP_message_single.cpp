@@ -29,6 +29,12 @@
 #include "BCP_vg_user.hpp"
 #include "BCP_vg.hpp"
 
+#include "BCP_cp_user.hpp"
+#include "BCP_cp.hpp"
+
+#include "BCP_vp_user.hpp"
+#include "BCP_vp.hpp"
+
 #include "BCP_tm.hpp"
 
 std::map<int, BCP_process*> BCP_single_environment::processes;
@@ -75,8 +81,8 @@ BCP_single_environment::register_process(USER_initialize* user_init)
     int _cg_id(2);
     int _vg_id(3);
 #endif
-    //     int _cp_id(4);
-    //     int _vp_id(5);
+    int _cp_id(4);
+    int _vp_id(5);
     BCP_tm_prob* _tm_prob = new BCP_tm_prob();
     processes[0] = _tm_prob;
 
@@ -84,10 +90,8 @@ BCP_single_environment::register_process(USER_initialize* user_init)
     _tm_prob->slave_pars.lp.set_entry(BCP_lp_par::MessagePassingIsSerial,true);
     _tm_prob->slave_pars.cg.set_entry(BCP_cg_par::MessagePassingIsSerial,true);
     _tm_prob->slave_pars.vg.set_entry(BCP_vg_par::MessagePassingIsSerial,true);
-    /*
-      _tm_prob->slave_pars.cp.set_entry(BCP_cp_par::MessagePassingIsSerial,true);
-      _tm_prob->slave_pars.vp.set_entry(BCP_vp_par::MessagePassingIsSerial,true);
-    */
+    _tm_prob->slave_pars.cp.set_entry(BCP_cp_par::MessagePassingIsSerial,true);
+    _tm_prob->slave_pars.vp.set_entry(BCP_vp_par::MessagePassingIsSerial,true);
     BCP_tm_parse_command_line(*_tm_prob, _argnum, _arglist);
     
     _tm_prob->msg_env = this;
@@ -106,20 +110,14 @@ BCP_single_environment::register_process(USER_initialize* user_init)
     _tm_prob->packer->user_class = _tm_prob->user;
 
     // Initialize the number of leaves assigned to CP's and VP's as 0
-#if ! defined(BCP_ONLY_LP_PROCESS_HANDLING_WORKS)
+    // (In the single environment there is at most one CP and one VP, see
+    // below.)
     if (_tm_prob->param(BCP_tm_par::CpProcessNum) > 0) {
-       _tm_prob->leaves_per_cp.reserve(_tm_prob->slaves.cp->procs().size());
-       for (int i = _tm_prob->slaves.cp->procs().size() - 1; i >= 0; --i)
-	    _tm_prob->leaves_per_cp.unchecked_push_back
-		(std::make_pair(_tm_prob->slaves.cp->procs()[i], 0));
+	_tm_prob->leaves_per_cp.push_back(std::make_pair(_cp_id, 0));
     }
     if (_tm_prob->param(BCP_tm_par::VpProcessNum) > 0) {
-        _tm_prob->leaves_per_vp.reserve(_tm_prob->slaves.vp->procs().size());
-	for (int i = _tm_prob->slaves.vp->procs().size() - 1; i >= 0; --i)
-	    _tm_prob->leaves_per_vp.unchecked_push_back
-		(std::make_pair(_tm_prob->slaves.vp->procs()[i], 0));
+	_tm_prob->leaves_per_vp.push_back(std::make_pair(_vp_id, 0));
     }
-#endif
 
     // Set the core (variables & cuts)
     _tm_prob->core = BCP_tm_create_core(*_tm_prob);
@@ -163,8 +161,24 @@ BCP_single_environment::register_process(USER_initialize* user_init)
     //-------------------------------------------------------------------------
     BCP_cg_prob* _cg_prob = 0;
     BCP_vg_prob* _vg_prob = 0;
-//     BCP_cp_prob* _cp_prob = 0;
-//     BCP_vp_prob* _vp_prob = 0;
+    BCP_cp_prob* _cp_prob = 0;
+    BCP_vp_prob* _vp_prob = 0;
+    //-------------------------------------------------------------------------
+    // CP
+    if (_tm_prob->param(BCP_tm_par::CpProcessNum) > 0) {
+	_cp_prob = new BCP_cp_prob(_cp_id, _tm_id);
+	processes[_cp_id] = _cp_prob;
+	_cp_prob->msg_env = new BCP_single_environment(_cp_id);
+	_tm_prob->cp_procs.push_back(_cp_id);
+    }
+    //-------------------------------------------------------------------------
+    // VP
+    if (_tm_prob->param(BCP_tm_par::VpProcessNum) > 0) {
+	_vp_prob = new BCP_vp_prob(_vp_id, _tm_id);
+	processes[_vp_id] = _vp_prob;
+	_vp_prob->msg_env = new BCP_single_environment(_vp_id);
+	_tm_prob->vp_procs.push_back(_vp_id);
+    }
     //-------------------------------------------------------------------------
     // CG
 #if ! defined(BCP_ONLY_LP_PROCESS_HANDLING_WORKS)
@@ -186,26 +200,6 @@ BCP_single_environment::register_process(USER_initialize* user_init)
 	_tm_prob->slaves.vg->add_proc(_vg_id);
 	_tm_prob->slaves.all->add_proc(_vg_id);
     }
-    //-------------------------------------------------------------------------
-    // CP
-    if (_tm_prob->param(BCP_tm_par::CpProcessNum) > 0) {
-	_cp_prob = new BCP_cp_prob(_cp_id, _tm_id);
-	processes[_cp_id] = _cp_prob;
-	_cp_prob->msg_env = new BCP_single_environment(_cp_id);
-	_tm_prob->slaves.cp = new BCP_proc_array;
-	_tm_prob->slaves.cp->add_proc(_cp_id);
-	_tm_prob->slaves.all->add_proc(_cp_id);
-    }
-    //-------------------------------------------------------------------------
-    // VP
-    if (_tm_prob->param(BCP_tm_par::VpProcessNum) > 0) {
-	_vp_prob = new BCP_vp_prob(_vp_id, _tm_id);
-	processes[_vp_id] = _vp_prob;
-	_vp_prob->msg_env = new BCP_single_environment(_vp_id);
-	_tm_prob->slaves.vp = new BCP_proc_array;
-	_tm_prob->slaves.vp->add_proc(_vp_id);
-	_tm_prob->slaves.all->add_proc(_vp_id);
-    }
 #endif
 
     //=========================================================================
@@ -228,7 +222,17 @@ BCP_single_environment::register_process(USER_initialize* user_init)
 	_vg_prob->core->unpack(_tm_prob->msg_buf);
     }
     // CP
+    if (_cp_prob) {
+	_tm_prob->msg_buf.clear();
+	_tm_prob->core->pack(_tm_prob->msg_buf);
+	_cp_prob->core->unpack(_tm_prob->msg_buf);
+    }
     // VP
+    if (_vp_prob) {
+	_tm_prob->msg_buf.clear();
+	_tm_prob->core->pack(_tm_prob->msg_buf);
+	_vp_prob->core->unpack(_tm_prob->msg_buf);
+    }
 
     //=========================================================================
     // Initialize the slave "processes"
@@ -286,7 +290,42 @@ BCP_single_environment::register_process(USER_initialize* user_init)
     }
     //-------------------------------------------------------------------------
     // CP
+    if (_cp_prob) {
+	// CP (it already has the core)
+	// copy over the parameter structure
+	_cp_prob->par = _tm_prob->slave_pars.cp;
+	// create the user universe
+	_cp_prob->user = user_init->cp_init(*_cp_prob);
+	_cp_prob->user->setCpProblemPointer(_cp_prob);
+	_cp_prob->packer = user_init->packer_init(_cp_prob->user);
+	_cp_prob->packer->user_class = _cp_prob->user;
+	// copy over the user info
+	_tm_prob->msg_buf.clear();
+	_tm_prob->user->pack_module_data(_tm_prob->msg_buf,
+					 BCP_ProcessType_CP);
+	if (_cp_prob->user)
+	    _cp_prob->user->unpack_module_data(_tm_prob->msg_buf);
+	_cp_prob->upper_bound = std::min<double>(_tm_prob->ub(), BCP_DBL_MAX);
+    }
+    //-------------------------------------------------------------------------
     // VP
+    if (_vp_prob) {
+	// VP (it already has the core)
+	// copy over the parameter structure
+	_vp_prob->par = _tm_prob->slave_pars.vp;
+	// create the user universe
+	_vp_prob->user = user_init->vp_init(*_vp_prob);
+	_vp_prob->user->setVpProblemPointer(_vp_prob);
+	_vp_prob->packer = user_init->packer_init(_vp_prob->user);
+	_vp_prob->packer->user_class = _vp_prob->user;
+	// copy over the user info
+	_tm_prob->msg_buf.clear();
+	_tm_prob->user->pack_module_data(_tm_prob->msg_buf,
+					 BCP_ProcessType_VP);
+	if (_vp_prob->user)
+	    _vp_prob->user->unpack_module_data(_tm_prob->msg_buf);
+	_vp_prob->upper_bound = std::min<double>(_tm_prob->ub(), BCP_DBL_MAX);
+    }
 
     //=========================================================================
     // Back to TM
@@ -335,10 +374,12 @@ BCP_single_environment::register_process(USER_initialize* user_init)
 	delete _vg_prob;
     }
       
-    //    if (_cp_prob)
-    //       delete _cp_prob;
-    //    if (_vp_prob)
-    //       delete _vp_prob;
+    if (_cp_prob) {
+	delete _cp_prob;
+    }
+    if (_vp_prob) {
+	delete _vp_prob;
+    }
       
     delete _tm_prob;
 
@@ -23,6 +23,23 @@ BCP_node_change::~BCP_node_change() {
 
 //#############################################################################
 
+size_t
+BCP_node_change::size_in_bytes() const
+{
+    // the object itself is counted in the sizes of its members
+    size_t siz = sizeof(BCP_node_change) - sizeof(BCP_problem_core_change) -
+	2 * sizeof(BCP_obj_set_change);
+    siz += core_change.size_in_bytes();
+    siz += var_change.size_in_bytes();
+    siz += cut_change.size_in_bytes();
+    if (warmstart) {
+	siz += warmstart->size_in_bytes();
+    }
+    return siz;
+}
+
+//#############################################################################
+
 void
 BCP_node_change::pack(BCP_user_pack* packer, const bool report_default,
 		      BCP_buffer& buf) const
@@ -53,6 +53,63 @@ BCP_obj_set_change::update(const BCP_obj_set_change& objs_change)
 
 //=============================================================================
 
+void
+BCP_obj_set_change::set_wrt_parent(const BCP_obj_set_change& old,
+				   const BCP_obj_set_change& cur)
+{
+   _storage = BCP_Storage_WrtParent;
+   _del_change_pos.clear();
+   _change.clear();
+   _new_objs.clear();
+
+   const BCP_vec<int>& old_objs = old._new_objs;
+   const BCP_vec<int>& cur_objs = cur._new_objs;
+   const int old_num = old_objs.size();
+   const int cur_num = cur_objs.size();
+   _del_change_pos.reserve(old_num);
+
+   BCP_vec<int> chpos;
+   chpos.reserve(cur_num);
+
+   int i, j;
+
+   // first check which entries have been deleted from old
+   for (i = 0, j = 0; i < cur_num && j < old_num; ++j) {
+      if (cur_objs[i] == old_objs[j]) {
+	 if (cur._change[i] != old._change[j])
+	    chpos.unchecked_push_back(i);
+	 ++i;
+      } else {
+	 _del_change_pos.unchecked_push_back(j);
+      }
+   }
+   // append the remains of old to _del_change_pos
+   for ( ; j < old_num; ++j) {
+      _del_change_pos.unchecked_push_back(j);
+   }
+   // _deleted_num is the current length of _del_change_pos
+   _deleted_num = _del_change_pos.size();
+
+   // the rest are the really new objects, and also the position of those
+   // objects must be appended to chpos.
+   _new_objs.reserve(cur_num - i);
+   for ( ; i < cur_num; ++i) {
+      _new_objs.unchecked_push_back(cur_objs[i]);
+      chpos.unchecked_push_back(i);
+   }
+   // append chpos to _del_change_pos to get the final list
+   _del_change_pos.append(chpos);
+
+   // finally, create _change: just pick up things based on chpos
+   const int chnum = chpos.size();
+   _change.reserve(chnum);
+   for (i = 0; i < chnum; ++i) {
+      _change.unchecked_push_back(cur._change[chpos[i]]);
+   }
+}
+
+//=============================================================================
+
 void
 BCP_obj_set_change::swap(BCP_obj_set_change& x)
 {
@@ -75,6 +132,17 @@ BCP_obj_set_change::pack_size() const
 
 //-----------------------------------------------------------------------------
 
+size_t
+BCP_obj_set_change::size_in_bytes() const
+{
+   return ( sizeof(BCP_obj_set_change) +
+	    _del_change_pos.capacity() * sizeof(int) +
+	    _change.capacity() * sizeof(BCP_obj_change) +
+	    _new_objs.capacity() * sizeof(int) );
+}
+
+//-----------------------------------------------------------------------------
+
 void
 BCP_obj_set_change::pack(BCP_buffer& buf) const
 {
@@ -352,6 +352,14 @@ int BCP_problem_core_change::pack_size() const {
 
 //-----------------------------------------------------------------------------
 
+size_t BCP_problem_core_change::size_in_bytes() const {
+   return ( sizeof(BCP_problem_core_change) +
+	    sizeof(int) * (var_pos.capacity() + cut_pos.capacity()) +
+	    sizeof(BCP_obj_change) * (var_ch.capacity() + cut_ch.capacity()) );
+}
+
+//-----------------------------------------------------------------------------
+
 void BCP_problem_core_change::pack(BCP_buffer& buf) const {
    buf.pack(_storage);
    if (_storage != BCP_Storage_NoData)
@@ -0,0 +1,175 @@
+// Copyright (C) 2000, International Business Machines
+// Corporation and others.  All Rights Reserved.
+#include "BCP_error.hpp"
+#include "BCP_buffer.hpp"
+#include "BCP_status_change.hpp"
+
+//#############################################################################
+
+// Add pos to the runs. Positions must be added in increasing order.
+static inline void
+BCP_add_to_runs(BCP_vec<int>& runs, const int pos)
+{
+    const int num = runs.size();
+    if (num > 0 && runs[num - 2] + runs[num - 1] == pos) {
+	++runs[num - 1];
+    } else {
+	runs.push_back(pos);
+	runs.push_back(1);
+    }
+}
+
+//#############################################################################
+
+void
+BCP_status_change::_assign(const char* first, const char* last)
+{
+    _size = 0;
+    _bits.clear();
+    _bits.reserve(((last - first) + 3) >> 2);
+    for ( ; first != last; ++first)
+	_push_back(*first);
+}
+
+//#############################################################################
+
+BCP_status_change::BCP_status_change(const BCP_status_change& old_vec,
+				     const BCP_status_change& new_vec,
+				     const BCP_vec<int>& del_pos) :
+    _storage(BCP_Storage_WrtParent), _size(0)
+{
+    if (old_vec.storage() != BCP_Storage_Explicit ||
+	new_vec.storage() != BCP_Storage_Explicit)
+	throw BCP_fatal_error("\
+BCP_status_change::BCP_status_change() : non-explicit storage!\n");
+
+    const int new_size = new_vec.size();
+    const int old_size = old_vec.size();
+    const int del_size = del_pos.size();
+    BCP_vec<int> change_pos;
+    int i, j, k; // runs on old_vec/new_vec/del_pos
+    for (i = 0, j = 0, k = 0; i < old_size && k < del_size; ++i) {
+	if (del_pos[k] == i) {
+	    BCP_add_to_runs(_del_runs, i);
+	    ++k;
+	    continue;
+	}
+	if (old_vec.status(i) != new_vec.status(j)) {
+	    BCP_add_to_runs(_change_runs, j);
+	    change_pos.push_back(j);
+	}
+	++j;
+    }
+    if (old_size - i > new_size - j)
+	throw BCP_fatal_error("BCP_status_change::BCP_status_change() : \n  \
+old_vec has entries not in new_vec but not listed in del_pos.\n");
+    for ( ; i < old_size; ++i, ++j) {
+	if (old_vec.status(i) != new_vec.status(j)) {
+	    BCP_add_to_runs(_change_runs, j);
+	    change_pos.push_back(j);
+	}
+    }
+    const int change_size = change_pos.size();
+    _bits.reserve((change_size + new_size - j + 3) >> 2);
+    for (i = 0; i < change_size; ++i)
+	_push_back(new_vec.status(change_pos[i]));
+    for ( ; j < new_size; ++j)
+	_push_back(new_vec.status(j));
+}
+
+//#############################################################################
+
+void
+BCP_status_change::explicit_vector(BCP_vec<char>& stat) const
+{
+    if (_storage != BCP_Storage_Explicit)
+	throw BCP_fatal_error("\
+BCP_status_change::explicit_vector() : non-explicit storage!\n");
+    stat.clear();
+    stat.reserve(_size);
+    for (int i = 0; i < _size; ++i)
+	stat.unchecked_push_back(static_cast<char>(status(i)));
+}
+
+//#############################################################################
+
+void
+BCP_status_change::update(const BCP_status_change& change)
+{
+    switch (change.storage()) {
+    case BCP_Storage_Explicit:
+	_storage = BCP_Storage_Explicit;
+	_size = change._size;
+	_del_runs.clear();
+	_change_runs.clear();
+	_bits = change._bits;
+	return;
+
+    case BCP_Storage_NoData:
+	_storage = BCP_Storage_NoData;
+	_size = 0;
+	_del_runs.clear();
+	_change_runs.clear();
+	_bits.clear();
+	return;
+
+    default: // must be BCP_Storage_WrtParent:
+	break;
+    }
+
+    if (_storage != BCP_Storage_Explicit)
+	throw BCP_fatal_error("\
+trying to update a non-explicit storage with another non-explicit!\n");
+
+    BCP_vec<char> stat;
+    explicit_vector(stat);
+
+    int i, j;
+    const int del_num = change._del_runs.size();
+    if (del_num > 0) {
+	BCP_vec<int> del_pos;
+	for (i = 0; i < del_num; i += 2) {
+	    const int last = change._del_runs[i] + change._del_runs[i + 1];
+	    for (j = change._del_runs[i]; j < last; ++j)
+		del_pos.push_back(j);
+	}
+	stat.erase_by_index(del_pos);
+    }
+
+    int k = 0; // runs on the values in change
+    const int change_num = change._change_runs.size();
+    for (i = 0; i < change_num; i += 2) {
+	const int last = change._change_runs[i] + change._change_runs[i + 1];
+	for (j = change._change_runs[i]; j < last; ++j)
+	    stat[j] = static_cast<char>(change.status(k++));
+    }
+    const int new_size = stat.size() + change._size - k;
+    stat.reserve(new_size);
+    for ( ; k < change._size; ++k)
+	stat.unchecked_push_back(static_cast<char>(change.status(k)));
+
+    _assign(stat.begin(), stat.end());
+}
+
+//#############################################################################
+
+void
+BCP_status_change::pack(BCP_buffer& buf) const
+{
+    const int st = _storage;
+    buf.pack(st).pack(_size).pack(_del_runs).pack(_change_runs).pack(_bits);
+}
+
+//-----------------------------------------------------------------------------
+
+void
+BCP_status_change::unpack(BCP_buffer& buf)
+{
+    _del_runs.clear();
+    _change_runs.clear();
+    _bits.clear();
+    int st;
+    buf.unpack(st).unpack(_size).unpack(_del_runs).unpack(_change_runs)
+	.unpack(_bits);
+    _storage = static_cast<BCP_storage_t>(st);
+}
@@ -11,10 +11,20 @@ BCP_warmstart_basis::convert_to_CoinWarmStart() const
   if (storage() != BCP_Storage_Explicit)
     return NULL;
 
-  const BCP_vec<char>& vst = _var_stat.explicit_vector();
-  const BCP_vec<char>& cst = _cut_stat.explicit_vector();
-  return
-    new CoinWarmStartBasis(vst.size(), cst.size(), vst.begin(), cst.begin());
+  const int vnum = _var_stat.size();
+  const int cnum = _cut_stat.size();
+  CoinWarmStartBasis* ws = new CoinWarmStartBasis();
+  ws->setSize(vnum, cnum);
+  int i;
+  for (i = 0; i < vnum; ++i) {
+    ws->setStructStatus(i, static_cast<CoinWarmStartBasis::Status>
+			(_var_stat.status(i)));
+  }
+  for (i = 0; i < cnum; ++i) {
+    ws->setArtifStatus(i, static_cast<CoinWarmStartBasis::Status>
+		       (_cut_stat.status(i)));
+  }
+  return ws;
 }
 
 //#############################################################################
@@ -78,15 +88,13 @@ BCP_warmstart_dual::as_change : old_ws is WrtParent!\n");
   // Both are explicit
   BCP_warmstart_basis* ws = new BCP_warmstart_basis();
 
-  new (&ws->_var_stat) BCP_vec_change<char>(ows->_var_stat, _var_stat,
-					    del_vars);
-  if (ws->_var_stat.storage_size() > ows->_var_stat.storage_size())
-    ws->_var_stat = ows->_var_stat;
+  new (&ws->_var_stat) BCP_status_change(ows->_var_stat, _var_stat, del_vars);
+  if (ws->_var_stat.storage_size() >= _var_stat.storage_size())
+    ws->_var_stat = _var_stat;
 
-  new (&ws->_cut_stat) BCP_vec_change<char>(ows->_cut_stat, _cut_stat,
-					    del_cuts);
-  if (ws->_cut_stat.storage_size() > ows->_cut_stat.storage_size())
-    ws->_cut_stat = ows->_cut_stat;
+  new (&ws->_cut_stat) BCP_status_change(ows->_cut_stat, _cut_stat, del_cuts);
+  if (ws->_cut_stat.storage_size() >= _cut_stat.storage_size())
+    ws->_cut_stat = _cut_stat;
 
   return ws;
 }
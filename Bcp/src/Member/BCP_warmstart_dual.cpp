@@ -57,7 +57,7 @@ BCP_warmstart_dual::as_change : old_ws is WrtParent!\n");
     return new BCP_warmstart_dual(*this);
 
   // Both are explicit
-  BCP_warmstart_dual* ws = new BCP_warmstart_dual();
+  BCP_warmstart_dual* ws = new BCP_warmstart_dual(_single_precision);
   new (&ws->_dual) BCP_vec_change<double>(ows->_dual, _dual, del_cuts, 1e-4);
   if (ws->_dual.storage_size() >= _dual.storage_size())
     ws->_dual = _dual;
@@ -60,7 +60,7 @@ BCP_warmstart_primaldual::as_change : old_ws is WrtParent!\n");
     return new BCP_warmstart_primaldual(*this);
 
   // Both are explicit
-  BCP_warmstart_primaldual* ws = new BCP_warmstart_primaldual();
+  BCP_warmstart_primaldual* ws = new BCP_warmstart_primaldual(_single_precision);
   new (&ws->_primal) BCP_vec_change<double>(ows->_primal, _primal,
 					    del_vars, petol);
   if (ws->_primal.storage_size() >= _primal.storage_size())
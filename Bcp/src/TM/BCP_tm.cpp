@@ -4,6 +4,7 @@
 #include <map>
 
 #include "BCP_math.hpp"
+#include "BCP_os.hpp"
 #include "BCP_process.hpp"
 #include "BCP_lp.hpp"
 #include "BCP_tm.hpp"
@@ -158,6 +159,7 @@ BCP_tm_prob::unpack_var(): received a var with positive bcpind, \n\
 	} else {
 	    var->set_bcpind(-bcpind);
 	    vars_local[-bcpind] = var;
+	    BCP_account_heap(var->size_in_bytes());
 	}
     }
     return bcpind;
@@ -238,6 +240,7 @@ BCP_tm_prob::unpack_cut(): received a cut with positive bcpind, \n\
 	} else {
 	    cut->set_bcpind(-bcpind);
 	    cuts_local[-bcpind] = cut;
+	    BCP_account_heap(cut->size_in_bytes());
 	}
     }
     return bcpind;
@@ -20,6 +20,8 @@ BCP_tm_parse_command_line(BCP_tm_prob& p,
      p.slave_pars.ts.read_from_file(arglist[1]);
      p.slave_pars.cg.read_from_file(arglist[1]);
      p.slave_pars.vg.read_from_file(arglist[1]);
+     p.slave_pars.cp.read_from_file(arglist[1]);
+     p.slave_pars.vp.read_from_file(arglist[1]);
   } else if (argnum == 1) {
      // work with default parameters
   } else {
@@ -28,6 +30,8 @@ BCP_tm_parse_command_line(BCP_tm_prob& p,
      p.slave_pars.ts.read_from_arglist(argnum, arglist);
      p.slave_pars.cg.read_from_arglist(argnum, arglist);
      p.slave_pars.vg.read_from_arglist(argnum, arglist);
+     p.slave_pars.cp.read_from_arglist(argnum, arglist);
+     p.slave_pars.vp.read_from_arglist(argnum, arglist);
   }
   // check the consistency of the parameters
   BCP_check_parameters(p);
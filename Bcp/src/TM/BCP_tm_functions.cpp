@@ -27,6 +27,41 @@ BCP_tm_identify_process(BCP_vec< std::pair<int,int> >& proclist, int proc)
 
 //#############################################################################
 
+/** Select the pool (CP or VP) for a node that is about to be processed and
+    update the leaf counters of the pools. The nodes of a subtree share the
+    pool of the root of the subtree. A node without a pool (e.g., the root)
+    gets the pool with the fewest leaves assigned to it, and a node whose
+    pool serves other leaves, too, is moved to an idle pool if there is one.
+    (The new pool starts empty for this subtree but fills up quickly.)
+    Return the new pool or -1 if the node keeps <code>current</code>. */
+static int
+BCP_tm_assign_pool(BCP_vec< std::pair<int, int> >& leaves_per_pool,
+		   const int current)
+{
+    BCP_vec< std::pair<int, int> >::iterator proc =
+	BCP_tm_identify_process(leaves_per_pool, current);
+    BCP_vec< std::pair<int, int> >::iterator best = leaves_per_pool.begin();
+    BCP_vec< std::pair<int, int> >::iterator proci = best;
+    const BCP_vec< std::pair<int, int> >::iterator lastproci =
+	leaves_per_pool.end();
+    for ( ; proci != lastproci; ++proci) {
+	if (proci->second < best->second)
+	    best = proci;
+    }
+    if (proc == lastproci) {
+	++best->second;
+	return best->first;
+    }
+    if (best->second == 0 && proc->second > 1) {
+	--proc->second;
+	++best->second;
+	return best->first;
+    }
+    return -1;
+}
+
+//-----------------------------------------------------------------------------
+
 bool
 BCP_tm_assign_processes(BCP_tm_prob& p, BCP_tm_node* node)
 {
@@ -68,54 +103,23 @@ BCP_tm_assign_processes(BCP_tm_prob& p, BCP_tm_node* node)
 	}
     }
 
-    if (so_far_so_good && p.slaves.cp) {
-	while (true) {
-	    cp = p.slaves.cp->get_free_proc();
-	    if (cp == -1)
-		break;
-	    if (p.msg_env->alive(cp))
-		break;
+#endif
+
+    if (so_far_so_good && p.leaves_per_cp.size() > 0) {
+	cp = BCP_tm_assign_pool(p.leaves_per_cp, node->cp);
+	if (! p.msg_env->alive(cp == -1 ? node->cp : cp)) {
 	    // *FIXME*
 	    throw BCP_fatal_error("TM: A CP has died. Aborting...\n");
 	}
-	if (cp == -1) {
-	    // if there is no free CP, just keep the old one
-	    if (node->cp != -1 && ! p.msg_env->alive(node->cp)) {
-		// *FIXME*
-		throw BCP_fatal_error("TM: A CP has died. Aborting...\n");
-	    }
-	} else {
-	    if (node->cp != -1 && ! p.msg_env->alive(node->cp)) {
-		// *FIXME*
-		throw BCP_fatal_error("TM: A CP has died. Aborting...\n");
-	    }
-	} 
     }
 
-    if (so_far_so_good && p.slaves.vp) {
-	while (true) {
-	    vp = p.slaves.vp->get_free_proc();
-	    if (vp == -1)
-		break;
-	    if (p.msg_env->alive(vp))
-		break;
+    if (so_far_so_good && p.leaves_per_vp.size() > 0) {
+	vp = BCP_tm_assign_pool(p.leaves_per_vp, node->vp);
+	if (! p.msg_env->alive(vp == -1 ? node->vp : vp)) {
 	    // *FIXME*
 	    throw BCP_fatal_error("TM: A VP has died. Aborting...\n");
 	}
-	if (vp == -1) {
-	    // if there is no free VP, just keep the old one
-	    if (node->vp != -1 && ! p.msg_env->alive(node->vp)) {
-		// *FIXME*
-		throw BCP_fatal_error("TM: A VP has died. Aborting...\n");
-	    }
-	} else {
-	    if (node->vp != -1 && ! p.msg_env->alive(node->vp)) {
-		// *FIXME*
-		throw BCP_fatal_error("TM: A VP has died. Aborting...\n");
-	    }
-	} 
     }
-#endif
 
     if (! so_far_so_good)
 	return BCP_tm_assign_processes(p, node);
@@ -124,13 +128,9 @@ BCP_tm_assign_processes(BCP_tm_prob& p, BCP_tm_node* node)
     node->cg = cg;
     node->vg = vg;
     if (cp != -1) {
-	// *LATER* : copy the old CP over to the free one and let node have
-	// this new CP.
 	node->cp = cp;
     }
     if (vp != -1) {
-	// *LATER* : copy the old VP over to the free one and let node have
-	// this new VP.
 	node->vp = vp;
     }
 
@@ -312,6 +312,8 @@ void BCP_check_parameters(BCP_tm_prob& p)
 	BCP_parameter_set<BCP_lp_par>& lppar = p.slave_pars.lp;
 	BCP_parameter_set<BCP_cg_par>& cgpar = p.slave_pars.cg;
 	BCP_parameter_set<BCP_vg_par>& vgpar = p.slave_pars.vg;
+	BCP_parameter_set<BCP_cp_par>& cppar = p.slave_pars.cp;
+	BCP_parameter_set<BCP_vp_par>& vppar = p.slave_pars.vp;
 	char treestat = tmpar.entry(BCP_tm_par::TmVerb_FinalStatistics);
 	char bestsol  = tmpar.entry(BCP_tm_par::TmVerb_BestFeasibleSolution);
 	for (i = BCP_tm_par::TmVerb_First+1; i < BCP_tm_par::TmVerb_Last; ++i){
@@ -335,6 +337,20 @@ void BCP_check_parameters(BCP_tm_prob& p)
 		cgpar.set_entry(static_cast<BCP_cg_par::chr_params>(i), false);
 	    }
 	}
+	for (i = BCP_cp_par::CpVerb_First+1; i < BCP_cp_par::CpVerb_Last; ++i){
+	    if (cppar.entry(static_cast<BCP_cp_par::chr_params>(i)) == 2) {
+		cppar.set_entry(static_cast<BCP_cp_par::chr_params>(i), true);
+	    } else {
+		cppar.set_entry(static_cast<BCP_cp_par::chr_params>(i), false);
+	    }
+	}
+	for (i = BCP_vp_par::VpVerb_First+1; i < BCP_vp_par::VpVerb_Last; ++i){
+	    if (vppar.entry(static_cast<BCP_vp_par::chr_params>(i)) == 2) {
+		vppar.set_entry(static_cast<BCP_vp_par::chr_params>(i), true);
+	    } else {
+		vppar.set_entry(static_cast<BCP_vp_par::chr_params>(i), false);
+	    }
+	}
 	/*
 	  for (i = BCP_vg_par::VgVerb_First+1; i < BCP_vg_par::VgVerb_Last; ++i){
 	  vgpar.set_entry(static_cast<BCP_vg_par::chr_params>(i), false);
@@ -362,12 +378,24 @@ void BCP_check_parameters(BCP_tm_prob& p)
 	} else {
 	    vgpar.set_entry(BCP_vg_par::ReportWhenDefaultIsExecuted, false);
 	}
+	if (cppar.entry(BCP_cp_par::ReportWhenDefaultIsExecuted) == 2) {
+	    cppar.set_entry(BCP_cp_par::ReportWhenDefaultIsExecuted, true);
+	} else {
+	    cppar.set_entry(BCP_cp_par::ReportWhenDefaultIsExecuted, false);
+	}
+	if (vppar.entry(BCP_vp_par::ReportWhenDefaultIsExecuted) == 2) {
+	    vppar.set_entry(BCP_vp_par::ReportWhenDefaultIsExecuted, true);
+	} else {
+	    vppar.set_entry(BCP_vp_par::ReportWhenDefaultIsExecuted, false);
+	}
     }
     if (p.param(BCP_tm_par::MaxHeapSize) == 0) {
+	// MaxHeapSize is in megabytes, convert before storing it into an int
         long fm = BCP_free_mem();
-	fm = fm == -1 ? 192 * (1<<20) /* 192M */ : fm;
-	p.par.set_entry(BCP_tm_par::MaxHeapSize, fm);
-	p.slave_pars.ts.set_entry(BCP_ts_par::MaxHeapSize, fm);
+	fm = fm == -1 ? 192 /* 192M */ : (fm >> 20);
+	p.par.set_entry(BCP_tm_par::MaxHeapSize, static_cast<int>(fm));
+	p.slave_pars.ts.set_entry(BCP_ts_par::MaxHeapSize,
+				  static_cast<int>(fm));
     }
 }
 
@@ -98,10 +98,10 @@ int bcp_main(int argc, char* argv[], USER_initialize* user_init)
 	      }
 	      break;
 	    case BCP_ProcessType_CP:
-	      // BCP_cp_main(msg_env, user_init, my_id, parent, ub);
+	      ptype = BCP_cp_main(msg_env, user_init, my_id, parent, ub);
 	      break;
 	    case BCP_ProcessType_VP:
-	      // BCP_vp_main(msg_env, user_init, my_id, parent, ub);
+	      ptype = BCP_vp_main(msg_env, user_init, my_id, parent, ub);
 	      break;
 	    case BCP_ProcessType_CG:
 	      ptype = BCP_cg_main(msg_env, user_init, my_id, parent, ub);
@@ -151,10 +151,8 @@ BCP_tm_main(BCP_message_environment* msg_env,
     p.slave_pars.lp.set_entry(BCP_lp_par::MessagePassingIsSerial,false);
     p.slave_pars.cg.set_entry(BCP_cg_par::MessagePassingIsSerial,false);
     p.slave_pars.vg.set_entry(BCP_vg_par::MessagePassingIsSerial,false);
-    /*
-      p.slave_pars.cp.set_entry(BCP_cp_par::MessagePassingIsSerial,false);
-      p.slave_pars.vp.set_entry(BCP_vp_par::MessagePassingIsSerial,false);
-    */
+    p.slave_pars.cp.set_entry(BCP_cp_par::MessagePassingIsSerial,false);
+    p.slave_pars.vp.set_entry(BCP_vp_par::MessagePassingIsSerial,false);
 
     // this also reads in the parameters from a file
     BCP_tm_parse_command_line(p, argnum, arglist);
@@ -242,17 +240,11 @@ Number of process in parameter file %d > n_proc in mpirun -np %d!\n",
     // their parameters, core and user info.
     BCP_tm_notify_processes(p);
 
-#if ! defined(BCP_ONLY_LP_PROCESS_HANDLING_WORKS)
     // Initialize the number of leaves assigned to CP's and VP's as 0
-    if (p.param(BCP_tm_par::CpProcessNum) > 0) {
-      for (int i = p.slaves.cp->procs().size() - 1; i >= 0; --i)
-	p.leaves_per_cp.push_back(std::make_pair(p.slaves.cp->procs()[i], 0));
-    }
-    if (p.param(BCP_tm_par::VpProcessNum) > 0) {
-      for (int i = p.slaves.vp->procs().size() - 1; i >= 0; --i)
-	p.leaves_per_vp.push_back(std::make_pair(p.slaves.vp->procs()[i], 0));
-    }
-#endif
+    for (int i = p.cp_procs.size() - 1; i >= 0; --i)
+      p.leaves_per_cp.push_back(std::make_pair(p.cp_procs[i], 0));
+    for (int i = p.vp_procs.size() - 1; i >= 0; --i)
+      p.leaves_per_vp.push_back(std::make_pair(p.vp_procs[i], 0));
 
     // Initialize the root of the search tree (can't invoke directly
     // p.user->create_root(), b/c the root might contain extra vars/cuts and
@@ -364,6 +356,7 @@ BCP_problem_core* BCP_tm_create_core(BCP_tm_prob& p)
 	    }
 	    var->set_bcpind(i);
 	    p.vars_local[i] = new BCP_var_core(*var);
+	    BCP_account_heap(var->size_in_bytes());
 	}
 	p.next_var_index_set_start = i;
     }
@@ -375,6 +368,7 @@ BCP_problem_core* BCP_tm_create_core(BCP_tm_prob& p)
 	    BCP_cut_core* cut = bcuts[i];
 	    cut->set_bcpind(i);
 	    p.cuts_local[i] = new BCP_cut_core(*cut);
+	    BCP_account_heap(cut->size_in_bytes());
 	}
 	p.next_cut_index_set_start = i;
     }
@@ -460,6 +454,7 @@ BCP_tm_node* BCP_tm_create_root(BCP_tm_prob& p)
 	    BCP_var* var = added_vars[i];
 	    vc._new_objs.unchecked_push_back(ind);
 	    p.vars_local[ind] = var;
+	    BCP_account_heap(var->size_in_bytes());
 	    var->set_bcpind(ind++);
 	    vc._change.unchecked_push_back(BCP_obj_change(var->lb(), var->ub(),
 							  var->status()));
@@ -477,6 +472,7 @@ BCP_tm_node* BCP_tm_create_root(BCP_tm_prob& p)
 	    BCP_cut* cut = added_cuts[i];
 	    cc._new_objs.unchecked_push_back(ind);
 	    p.cuts_local[ind] = cut;
+	    BCP_account_heap(cut->size_in_bytes());
 	    cut->set_bcpind(ind++);
 	    cc._change.unchecked_push_back(BCP_obj_change(cut->lb(), cut->ub(),
 							  cut->status()));
@@ -487,6 +483,7 @@ BCP_tm_node* BCP_tm_create_root(BCP_tm_prob& p)
     BCP_tm_node* root = new BCP_tm_node(0, root_changes);
 
     root->_data._user = user_data;
+    root->update_accounted_size();
 
     root->_core_storage = root->_data._desc->core_change.storage();
     root->_var_storage = BCP_Storage_Explicit;
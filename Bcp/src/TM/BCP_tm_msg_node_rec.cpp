@@ -140,6 +140,7 @@ TMDBG;
     if (node->_locally_stored) {
 	node->_data._desc = NULL;
 	node->_data._user = NULL;
+	node->update_accounted_size();
     } else {
 	BCP_buffer b;
 TMDBG;
@@ -211,6 +212,7 @@ TMDBG;
 
 	node->_data._desc = desc;
 	node->_data._user = udata;
+	node->update_accounted_size();
 	node->_core_storage = desc->core_change.storage();
 	node->_var_storage = desc->var_change.storage();
 	node->_cut_storage = desc->cut_change.storage();
@@ -232,6 +234,32 @@ TMDBG;
 
 //#############################################################################
 
+/** If the node is created by branching on a single variable then forward to
+    every LP process how much the objective changed between the node's parent
+    and the (final) lower bound of the node, so that they can update their
+    pseudo-costs. */
+static void
+BCP_tm_send_child_bound(BCP_tm_prob& p, BCP_tm_node* node)
+{
+    if (node->_pc_bcpind < 0)
+	return;
+    // The node will not be observed again (e.g., in the next phase)
+    const int bcpind = node->_pc_bcpind;
+    node->_pc_bcpind = -1;
+    // The bound of a node pruned over the UB can be anything above the UB
+    // (e.g., when the LP solver hits the cutoff), all we can use is the UB.
+    const double bound = std::min(node->getTrueLB(), p.ub());
+    if (bound >= BCP_DBL_MAX / 10)
+	return;
+    // p.msg_buf is still being unpacked, use a separate buffer
+    BCP_buffer b;
+    b.pack(bcpind).pack(node->_pc_change).pack(bound - node->_pc_objval);
+    p.msg_env->multicast(p.lp_procs.size(), &p.lp_procs[0],
+			 BCP_Msg_ChildBound, b);
+}
+
+//#############################################################################
+
 static inline BCP_diving_status
 BCP_tm_shall_we_dive(BCP_tm_prob& p, const double quality)
 {
@@ -445,7 +473,10 @@ BCP_tm_create_child(BCP_tm_prob& p, const int child_ind,
 		    const BCP_vec<BCP_child_action>& action,
 		    const BCP_vec<BCP_user_data*>& user_data,
 		    const BCP_vec<double>& true_lb,
-		    const BCP_vec<double>& qualities)
+		    const BCP_vec<double>& qualities,
+		    const BCP_vec<int>& pc_bcpind,
+		    const BCP_vec<double>& pc_change,
+		    const double pc_objval)
 {
     // generate the children
     const int bvarnum = p.core->varnum();
@@ -474,12 +505,16 @@ BCP_tm_create_child(BCP_tm_prob& p, const int child_ind,
 
     p.search_tree.insert(child); // this sets _index
     child->_data._user = user_data[child_ind];
+    child->update_accounted_size();
     child->_parent = node;
     child->_birth_index = node->child_num();
     /* Fill out the fields in CoinTreeNode */
     child->setDepth(depth);
     child->setQuality(qualities[child_ind]);
     child->setTrueLB(true_lb[child_ind]);
+    child->_pc_bcpind = pc_bcpind[child_ind];
+    child->_pc_change = pc_change[child_ind];
+    child->_pc_objval = pc_objval;
     if (child_ind > 0 && depth <= 127) {
       BitVector128 pref = nodePref;
       pref.setBit(127-depth);
@@ -489,7 +524,7 @@ BCP_tm_create_child(BCP_tm_prob& p, const int child_ind,
     }
     /* Add the child to the list of children in the parent */
     node->new_child(child);
-    // _children  initialized to be empty -- OK
+    // the child has no children of its own yet -- OK
     switch (action[child_ind]){
     case BCP_ReturnChild:
       child->status = BCP_CandidateNode;
@@ -551,7 +586,12 @@ TMDBG;
     BCP_internal_brobj* brobj = new BCP_internal_brobj;
     brobj->unpack(buf);
 
-    node->reserve_child_num(brobj->child_num());
+    // the pseudo-cost information of the children
+    double pc_objval;
+    BCP_vec<int> pc_bcpind;
+    BCP_vec<double> pc_change;
+    buf.unpack(pc_objval).unpack(pc_bcpind).unpack(pc_change);
+
     int keep = -1;
     BCP_tm_node* child = 0;
     int i;
@@ -563,7 +603,7 @@ TMDBG;
 	if (proc == p.leaves_per_cp.end()) {
 	    node->cp = -1; 
 	} else {
-	    proc->second += node->child_num() - 1;
+	    proc->second += brobj->child_num() - 1;
 	}
     }
     if (node->vp != -1) {
@@ -572,7 +612,7 @@ TMDBG;
 	if (proc == p.leaves_per_vp.end()) {
 	    node->vp = -1; 
 	} else {
-	    proc->second += node->child_num() - 1;
+	    proc->second += brobj->child_num() - 1;
 	}
     }
 
@@ -599,13 +639,17 @@ TMDBG;
     if (keep >= 0) {
       children[numChildrenAdded++] = BCP_tm_create_child(p, keep, node, brobj,
 							 action, user_data,
-							 true_lb, qualities);
+							 true_lb, qualities,
+							 pc_bcpind, pc_change,
+							 pc_objval);
     }
     for (i = 0; i < child_num; ++i) {
       if (i != keep) {
 	children[numChildrenAdded++] = BCP_tm_create_child(p, i, node, brobj,
 							   action, user_data,
-							   true_lb, qualities);
+							   true_lb, qualities,
+							   pc_bcpind, pc_change,
+							   pc_objval);
       }
     }
 
@@ -707,6 +751,7 @@ BCP_tm_unpack_branching_info: the (old) node has no LP associated with!\n");
 void BCP_tm_unpack_node_with_branching_info(BCP_tm_prob& p, BCP_buffer& buf)
 {
     const int index = BCP_tm_unpack_node_description(p, buf);
+    BCP_tm_send_child_bound(p, p.search_tree[index]);
     /* In the middle of BCP_tm_unpack_branching_info we check for data
        balancing just before we (may) allow diving.*/
     BCP_tm_unpack_branching_info(p, buf, p.search_tree[index]);
@@ -722,6 +767,11 @@ BCP_tm_node* BCP_tm_unpack_node_no_branching_info(BCP_tm_prob& p,
 						  BCP_buffer& buf)
 {
     const int index = BCP_tm_unpack_node_description(p, buf);
+    // Infeasible and discarded nodes do not have a meaningful bound
+    if (buf.msgtag() == BCP_Msg_NodeDescription_OverUB ||
+	buf.msgtag() == BCP_Msg_NodeDescription_OverUB_Pruned) {
+	BCP_tm_send_child_bound(p, p.search_tree[index]);
+    }
 
     BCP_print_memusage(p);
     p.need_a_TS = ! BCP_tm_is_data_balanced(p);
@@ -1,5 +1,7 @@
 // Copyright (C) 2000, International Business Machines
 // Corporation and others.  All Rights Reserved.
+#include <algorithm>
+
 #include "CoinTime.hpp"
 
 #include "BCP_math.hpp"
@@ -20,6 +22,12 @@ void BCP_tm_idle_processes(BCP_tm_prob& p)
 {
     p.msg_env->multicast(p.lp_procs.size(), &p.lp_procs[0],
 			 BCP_Msg_FinishedBCP);
+    if (p.cp_procs.size() > 0)
+	p.msg_env->multicast(p.cp_procs.size(), &p.cp_procs[0],
+			     BCP_Msg_FinishedBCP);
+    if (p.vp_procs.size() > 0)
+	p.msg_env->multicast(p.vp_procs.size(), &p.vp_procs[0],
+			     BCP_Msg_FinishedBCP);
 }
 
 //#############################################################################
@@ -28,6 +36,12 @@ void BCP_tm_stop_processes(BCP_tm_prob& p)
 {
     p.msg_env->multicast(p.lp_procs.size(), &p.lp_procs[0],
 			 BCP_Msg_FinishedBCP);
+    if (p.cp_procs.size() > 0)
+	p.msg_env->multicast(p.cp_procs.size(), &p.cp_procs[0],
+			     BCP_Msg_FinishedBCP);
+    if (p.vp_procs.size() > 0)
+	p.msg_env->multicast(p.vp_procs.size(), &p.vp_procs[0],
+			     BCP_Msg_FinishedBCP);
 }
 
 //#############################################################################
@@ -50,6 +64,32 @@ void BCP_tm_start_processes(BCP_tm_prob& p)
 	p.lp_scheduler.add_free_ids(p.lp_procs.size(), &p.lp_procs[0]);
     }
 
+    if (p.param(BCP_tm_par::CpProcessNum) > 0) {
+	const bool debug = p.param(BCP_tm_par::DebugCpProcesses) != 0;
+	const int  num = p.param(BCP_tm_par::CpProcessNum);
+	const BCP_vec<BCP_string>& machines = p.param(BCP_tm_par::CpMachines);
+	p.cp_procs.insert(p.cp_procs.end(), num, -1);
+	bool success = machines.size() == 0 ?
+	  p.msg_env->start_processes(exe, num, debug, &p.cp_procs[0]) :
+	  p.msg_env->start_processes(exe, num, machines, debug, &p.cp_procs[0]);
+	if (! success) {
+	  throw BCP_fatal_error("Failed to start up the CP processes\n");
+	}
+    }
+
+    if (p.param(BCP_tm_par::VpProcessNum) > 0) {
+	const bool debug = p.param(BCP_tm_par::DebugVpProcesses) != 0;
+	const int  num = p.param(BCP_tm_par::VpProcessNum);
+	const BCP_vec<BCP_string>& machines = p.param(BCP_tm_par::VpMachines);
+	p.vp_procs.insert(p.vp_procs.end(), num, -1);
+	bool success = machines.size() == 0 ?
+	  p.msg_env->start_processes(exe, num, debug, &p.vp_procs[0]) :
+	  p.msg_env->start_processes(exe, num, machines, debug, &p.vp_procs[0]);
+	if (! success) {
+	  throw BCP_fatal_error("Failed to start up the VP processes\n");
+	}
+    }
+
 #if ! defined(BCP_ONLY_LP_PROCESS_HANDLING_WORKS)
     if (p.param(BCP_tm_par::CgProcessNum) > 0) {
 	const bool debug = p.param(BCP_tm_par::DebugCgProcesses) != 0;
@@ -76,32 +116,6 @@ void BCP_tm_start_processes(BCP_tm_prob& p)
 	p.slaves.all->add_procs(p.slaves.vg->procs().begin(),
 				p.slaves.vg->procs().end());
     }
-
-    if (p.param(BCP_tm_par::CpProcessNum) > 0) {
-	const bool debug = p.param(BCP_tm_par::DebugCpProcesses) != 0;
-	const int  num = p.param(BCP_tm_par::CpProcessNum);
-	const BCP_vec<BCP_string>& machines = p.param(BCP_tm_par::CpMachines);
-	if (machines.size() == 0) {
-	    p.slaves.cp= p.msg_env->start_processes(exe, num, debug);
-	} else {
-	    p.slaves.cp= p.msg_env->start_processes(exe, num, machines, debug);
-	}
-	p.slaves.all->add_procs(p.slaves.cp->procs().begin(),
-				p.slaves.cp->procs().end());
-    }
-
-    if (p.param(BCP_tm_par::VpProcessNum) > 0) {
-	const bool debug = p.param(BCP_tm_par::DebugVpProcesses) != 0;
-	const int  num = p.param(BCP_tm_par::VpProcessNum);
-	const BCP_vec<BCP_string>& machines = p.param(BCP_tm_par::VpMachines);
-	if (machines.size() == 0) {
-	    p.slaves.vp= p.msg_env->start_processes(exe, num, debug);
-	} else {
-	    p.slaves.vp= p.msg_env->start_processes(exe, num, machines, debug);
-	}
-	p.slaves.all->add_procs(p.slaves.vp->procs().begin(),
-				p.slaves.vp->procs().end());
-    }
 #endif
 }
 
@@ -172,15 +186,15 @@ BCP_tm_notify_process_type(BCP_tm_prob& p, BCP_process_t ptype,
 	BCP_tm_initialize_process_type(p, BCP_ProcessType_TS, p.slave_pars.ts,
 				       num, pids);
 	break;
-#if ! defined(BCP_ONLY_LP_PROCESS_HANDLING_WORKS)
     case BCP_ProcessType_CP:
-// 	BCP_tm_initialize_process_type(p, BCP_ProcessType_CP, p.slave_pars.cp,
-// 				       procs ? *procs : p.slaves.cp->procs());
+	BCP_tm_initialize_process_type(p, BCP_ProcessType_CP, p.slave_pars.cp,
+				       num, pids);
 	break;
     case BCP_ProcessType_VP:
-// 	BCP_tm_initialize_process_type(p, BCP_ProcessType_VP, p.slave_pars.vp,
-// 				       procs ? *procs : p.slaves.vp->procs());
+	BCP_tm_initialize_process_type(p, BCP_ProcessType_VP, p.slave_pars.vp,
+				       num, pids);
 	break;
+#if ! defined(BCP_ONLY_LP_PROCESS_HANDLING_WORKS)
     case BCP_ProcessType_CG:
 	BCP_tm_initialize_process_type(p, BCP_ProcessType_CG, p.slave_pars.cg,
 				       procs ? *procs : p.slaves.cg->procs());
@@ -210,11 +224,13 @@ void
 BCP_tm_notify_processes(BCP_tm_prob& p)
 {
     BCP_tm_notify_process_type(p, BCP_ProcessType_LP, p.lp_procs);
+    if (p.cp_procs.size() > 0)
+	BCP_tm_notify_process_type(p, BCP_ProcessType_CP, p.cp_procs);
+    if (p.vp_procs.size() > 0)
+	BCP_tm_notify_process_type(p, BCP_ProcessType_VP, p.vp_procs);
 #if ! defined(BCP_ONLY_LP_PROCESS_HANDLING_WORKS)
     BCP_tm_notify_process_type(p, BCP_ProcessType_CG, &p.slaves.cg->procs());
     BCP_tm_notify_process_type(p, BCP_ProcessType_VG, &p.slaves.vg->procs());
-    BCP_tm_notify_process_type(p, BCP_ProcessType_CP, &p.slaves.cp->procs());
-    BCP_tm_notify_process_type(p, BCP_ProcessType_VP, &p.slaves.vp->procs());
 #endif
 }
 
@@ -227,12 +243,63 @@ BCP_tm_broadcast_ub(BCP_tm_prob& p)
   p.msg_buf.pack(p.ub());
   p.msg_env->multicast(p.lp_procs.size(), &p.lp_procs[0],
 		       BCP_Msg_UpperBound, p.msg_buf);
+  if (p.cp_procs.size() > 0)
+    p.msg_env->multicast(p.cp_procs.size(), &p.cp_procs[0],
+			 BCP_Msg_UpperBound, p.msg_buf);
+  if (p.vp_procs.size() > 0)
+    p.msg_env->multicast(p.vp_procs.size(), &p.vp_procs[0],
+			 BCP_Msg_UpperBound, p.msg_buf);
 #if ! defined(BCP_ONLY_LP_PROCESS_HANDLING_WORKS)
 #endif
 }
 
 //#############################################################################
 
+void
+BCP_tm_process_global_var_bounds(BCP_tm_prob& p)
+{
+  // Merge the bounds into the ones we know about and forward only those
+  // that are actually tighter.
+  int cnt;
+  p.msg_buf.unpack(cnt);
+  BCP_vec<int> ind;
+  BCP_vec<double> bd;
+  ind.reserve(cnt);
+  bd.reserve(2 * cnt);
+  while (--cnt >= 0) {
+    int bcpind;
+    double lb, ub;
+    p.msg_buf.unpack(bcpind).unpack(lb).unpack(ub);
+    std::map<int, std::pair<double, double> >::iterator gb =
+      p.global_var_bounds.find(bcpind);
+    if (gb == p.global_var_bounds.end()) {
+      p.global_var_bounds[bcpind] = std::make_pair(lb, ub);
+    } else {
+      if (lb <= gb->second.first && ub >= gb->second.second)
+	continue;
+      lb = std::max(lb, gb->second.first);
+      ub = std::min(ub, gb->second.second);
+      gb->second = std::make_pair(lb, ub);
+    }
+    ind.unchecked_push_back(bcpind);
+    bd.unchecked_push_back(lb);
+    bd.unchecked_push_back(ub);
+  }
+
+  cnt = ind.size();
+  if (cnt == 0)
+    return;
+  p.msg_buf.clear();
+  p.msg_buf.pack(cnt);
+  for (int i = 0; i < cnt; ++i) {
+    p.msg_buf.pack(ind[i]).pack(bd[2*i]).pack(bd[2*i+1]);
+  }
+  p.msg_env->multicast(p.lp_procs.size(), &p.lp_procs[0],
+		       BCP_Msg_GlobalVarBounds, p.msg_buf);
+}
+
+//#############################################################################
+
 void
 BCP_tm_rebroadcast_root_warmstart(BCP_tm_prob& p)
 {
@@ -402,6 +469,10 @@ BCP_tm_prob::process_message()
         BCP_tm_rebroadcast_root_warmstart(*this);
 	break;
 
+    case BCP_Msg_GlobalVarBounds:
+        BCP_tm_process_global_var_bounds(*this);
+	break;
+
     case BCP_Msg_RequestCutIndexSet:
 	sender = msg_buf.sender();
 	msg_buf.clear();
@@ -568,8 +639,6 @@ BCP_tm_test_machine(BCP_tm_prob& p)
 
 void BCP_tm_modify_pool_counters(BCP_tm_prob& p, BCP_tm_node* node)
 {
-/* FIXME: we don't have pools anyway... */
-#if ! defined(BCP_ONLY_LP_PROCESS_HANDLING_WORKS)
     if (node->cp != -1) {
 	BCP_vec< std::pair<int, int> >::iterator proc =
 	    BCP_tm_identify_process(p.leaves_per_cp, node->cp);
@@ -578,8 +647,8 @@ void BCP_tm_modify_pool_counters(BCP_tm_prob& p, BCP_tm_node* node)
 	    throw BCP_fatal_error("\
 TM: non-existing CP was assigned to a just pruned node.\n");
 #endif
-	if (--proc->second == 0)
-	    p.slaves.cp->set_proc_free(proc->first);
+	if (proc != p.leaves_per_cp.end())
+	    --proc->second;
     }
     if (node->vp != -1) {
 	BCP_vec< std::pair<int, int> >::iterator proc =
@@ -589,10 +658,9 @@ TM: non-existing CP was assigned to a just pruned node.\n");
 	    throw BCP_fatal_error("\
 TM: non-existing VP was assigned to a just pruned node.\n");
 #endif
-	if (--proc->second == 0)
-	    p.slaves.vp->set_proc_free(proc->first);
+	if (proc != p.leaves_per_vp.end())
+	    --proc->second;
     }
-#endif
 }
 
 //#############################################################################
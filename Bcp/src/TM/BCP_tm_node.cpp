@@ -1,6 +1,7 @@
 // Copyright (C) 2000, International Business Machines
 // Corporation and others.  All Rights Reserved.
 #include "BCP_math.hpp"
+#include "BCP_os.hpp"
 #include "BCP_USER.hpp"
 #include "BCP_tm.hpp"
 #include "BCP_tm_user.hpp"
@@ -11,15 +12,19 @@
 int BCP_tm_node::num_local_nodes = 0;
 int BCP_tm_node::num_remote_nodes = 0;
 
+BCP_MemPool BCP_tm_node::memPool(sizeof(BCP_tm_node));
+
 //#############################################################################
 
 BCP_tm_node::BCP_tm_node(int level, BCP_node_change* desc) :
   CoinTreeNode(level),
+  _parent(0),
+  _first_child(0),
+  _next_sibling(0),
   status(BCP_DefaultNode),
   _index(0),
-  _parent(0),
   _birth_index(-1),
-  _children(),
+  _child_num(0),
   lp(-1), cg(-1), cp(-1), vg(-1), vp(-1),
   _processed_leaf_num(0),
   _pruned_leaf_num(0),
@@ -31,9 +36,26 @@ BCP_tm_node::BCP_tm_node(int level, BCP_node_change* desc) :
   _ws_storage(-1),
   _locally_stored(true),
   _data_location(-1),
-  _data(desc)
+  _data(desc),
+  _accounted_size(0),
+  _pc_bcpind(-1),
+  _pc_change(0.0),
+  _pc_objval(0.0)
 {
   ++num_local_nodes;
+  update_accounted_size();
+}
+
+//#############################################################################
+
+BCP_tm_node::~BCP_tm_node()
+{
+  if (_locally_stored) {
+    --num_local_nodes;
+  } else {
+    --num_remote_nodes;
+  }
+  BCP_account_heap(-static_cast<double>(_accounted_size));
 }
 
 //#############################################################################
@@ -57,18 +79,46 @@ BCP_tm_node::BCP_tm_node(int level, BCP_node_change* desc) :
 
 //#############################################################################
 
+size_t
+BCP_tm_node::size_in_bytes() const
+{
+    size_t siz = sizeof(BCP_tm_node);
+    if (_data._desc.IsValid()) {
+	siz += _data._desc->size_in_bytes();
+    }
+    if (_data._user.IsValid()) {
+	siz += _data._user->size_in_bytes();
+    }
+    return siz;
+}
+
+//-----------------------------------------------------------------------------
+
+void
+BCP_tm_node::update_accounted_size()
+{
+    const size_t siz = size_in_bytes();
+    BCP_account_heap(static_cast<double>(siz) -
+		     static_cast<double>(_accounted_size));
+    _accounted_size = siz;
+}
+
+//#############################################################################
+
 int
 BCP_tm_node::mark_descendants_for_deletion() {
     int del_num = child_num();
     if (del_num > 0) {
-	BCP_vec<BCP_tm_node*>::iterator child = _children.begin();
-	BCP_vec<BCP_tm_node*>::const_iterator lastchild = _children.end();
-	while (child != lastchild) {
-	    del_num += (*child)->mark_descendants_for_deletion();
-	    (*child)->_index = -1;
-	    ++child;
+	BCP_tm_node* child = _first_child;
+	while (child) {
+	    BCP_tm_node* next = child->_next_sibling;
+	    del_num += child->mark_descendants_for_deletion();
+	    child->_index = -1;
+	    child->_next_sibling = 0;
+	    child = next;
 	}
-	_children.clear();
+	_first_child = 0;
+	_child_num = 0;
     }
     return del_num;
 }
@@ -76,20 +126,35 @@ BCP_tm_node::mark_descendants_for_deletion() {
 //#############################################################################
 
 void
-BCP_tm_node::remove_child(BCP_tm_node* node)
+BCP_tm_node::new_child(BCP_tm_node* node)
 {
-    const int num_children = child_num();
-    int i;
-    for (i = num_children - 1; i >= 0; --i) {
-	if (_children[i] == node)
-	    break;
+    node->_next_sibling = 0;
+    if (_first_child == 0) {
+	_first_child = node;
+    } else {
+	BCP_tm_node* last = _first_child;
+	while (last->_next_sibling)
+	    last = last->_next_sibling;
+	last->_next_sibling = node;
     }
-    if (i < 0) {
+    ++_child_num;
+}
+
+//#############################################################################
+
+void
+BCP_tm_node::remove_child(BCP_tm_node* node)
+{
+    BCP_tm_node** link = &_first_child;
+    while (*link && *link != node)
+	link = &(*link)->_next_sibling;
+    if (*link == 0) {
 	throw BCP_fatal_error("BCP_tm_node::remove_child : \
 Trying to remove nonexistent child.\n");
     }
-    _children[i] = _children[num_children-1];
-    _children.pop_back();
+    *link = node->_next_sibling;
+    node->_next_sibling = 0;
+    --_child_num;
 }
 
 //#############################################################################
@@ -119,15 +184,13 @@ BCP_tree::enumerate_leaves(BCP_tm_node* node, const double obj_limit)
 	node->_processed_leaf_num = 0;
 	node->_pruned_leaf_num = 0;
 	node->_tobepriced_leaf_num = 0;
-	BCP_vec<BCP_tm_node*>::iterator child;
-	BCP_vec<BCP_tm_node*>::const_iterator lastchild =
-	    node->_children.end();
-	for (child = node->_children.begin(); child != lastchild; ++child) {
-	    this->enumerate_leaves(*child, obj_limit);
-	    node->_processed_leaf_num += (*child)->_processed_leaf_num;
-	    node->_pruned_leaf_num += (*child)->_pruned_leaf_num;
-	    node->_tobepriced_leaf_num += (*child)->_tobepriced_leaf_num;
-	    node->_leaf_num += (*child)->_leaf_num;
+	BCP_tm_node* child;
+	for (child = node->first_child(); child; child = child->next_sibling()){
+	    this->enumerate_leaves(child, obj_limit);
+	    node->_processed_leaf_num += child->_processed_leaf_num;
+	    node->_pruned_leaf_num += child->_pruned_leaf_num;
+	    node->_tobepriced_leaf_num += child->_tobepriced_leaf_num;
+	    node->_leaf_num += child->_leaf_num;
 	}
     }
 }
@@ -143,10 +206,9 @@ BCP_tree::true_lower_bound(const BCP_tm_node* node) const
 	if (st == BCP_ActiveNode || st == BCP_CandidateNode)
 	    worstlb = node->getTrueLB();
     } else {
-	BCP_vec<BCP_tm_node*>::const_iterator child;
-	BCP_vec<BCP_tm_node*>::const_iterator lastchild = node->_children.end();
-	for (child = node->_children.begin(); child != lastchild; ++child) {
-	    const double childlb = true_lower_bound(*child);
+	const BCP_tm_node* child;
+	for (child = node->first_child(); child; child = child->next_sibling()){
+	    const double childlb = true_lower_bound(child);
 	    if (childlb < worstlb)
 		worstlb = childlb;
 	}
@@ -18,11 +18,7 @@ static bool BCP_tm_scan_children(BCP_tm_prob& p, BCP_tm_node* node,
 #ifndef NUMNODES_BASED_ON_BUFSIZE
   const size_t send_size = 100;
 #endif
-  BCP_vec<BCP_tm_node*>& children = node->_children;
-  for (int i = children.size() - 1; i >= 0; --i) {
-    BCP_tm_node* s = children[i];
-    if (s == NULL)
-      continue;
+  for (BCP_tm_node* s = node->_first_child; s; s = s->_next_sibling) {
     if (BCP_tm_scan_children(p, s, nodes_to_send, bufsize))
       return true;
   }
@@ -75,10 +71,8 @@ static bool BCP_tm_scan_siblings(BCP_tm_prob& p, BCP_tm_node* node,
   BCP_tm_node* parent = node->_parent;
   if (parent == NULL)
     return false;
-  BCP_vec<BCP_tm_node*>& siblings = parent->_children;
-  for (int i = siblings.size() - 1; i >= 0; --i) {
-    BCP_tm_node* s = siblings[i];
-    if (s == node || s == NULL)
+  for (BCP_tm_node* s = parent->_first_child; s; s = s->_next_sibling) {
+    if (s == node)
       continue;
     if (BCP_tm_scan_children(p, s, nodes_to_send, bufsize))
       return true;
@@ -88,6 +82,16 @@ static bool BCP_tm_scan_siblings(BCP_tm_prob& p, BCP_tm_node* node,
 
 //#############################################################################
 
+/** The maximum heap size (in bytes) the TM may use. The MaxHeapSize parameter
+    is given in megabytes; the computation is done in double precision so
+    that heaps larger than 2GB are handled correctly. */
+static inline double BCP_tm_max_heap(const BCP_tm_prob& p)
+{
+  return p.param(BCP_tm_par::MaxHeapSize) * 1048576.0;
+}
+
+//#############################################################################
+
 /** This function is invoked from exactly one place, the beginning of
     BCP_tm_unpack_node_description(). So any time when data is received we
     call this function to decide if data balancing is needed or not. There may
@@ -97,8 +101,7 @@ static bool BCP_tm_scan_siblings(BCP_tm_prob& p, BCP_tm_node* node,
 
 bool BCP_tm_is_data_balanced(BCP_tm_prob& p)
 {
-  const int maxheap = p.param(BCP_tm_par::MaxHeapSize);
-  if (maxheap == -1) {
+  if (p.param(BCP_tm_par::MaxHeapSize) == -1) {
     return true;
   }
 #if 0
@@ -108,9 +111,8 @@ bool BCP_tm_is_data_balanced(BCP_tm_prob& p)
 #endif
 //   return (BCP_tm_node::num_local_nodes < 10);
 
-  const double usedheap = BCP_used_heap();
-  if (usedheap == -1)
-    return true;
+  const double maxheap = BCP_tm_max_heap(p);
+  const double usedheap = BCP_accounted_heap();
   const double freeheap = maxheap - usedheap;
   printf("free: %f   used: %f   free/max: %f\n",
 	 freeheap, usedheap, freeheap/maxheap);
@@ -195,15 +197,15 @@ Trying to convert an LP into TS, but its pid is not in lp_procs!\n");
   /* 'node' is a leaf. Starting from it traverse the tree until there is
      enough data to be sent off. The "enough" means that the message buffer
      takes up 25% of the free space. */
-  int usedheap = BCP_used_heap();
-  assert(usedheap > 0);
-  const int maxheap = p.param(BCP_tm_par::MaxHeapSize);
+  double usedheap = BCP_accounted_heap();
+  const double maxheap = BCP_tm_max_heap(p);
   assert(maxheap > 0);
-  int freeheap = maxheap - usedheap;
-  printf("Before sending off: freeheap: %i   usedheap: %i\n",
+  double freeheap = maxheap - usedheap;
+  printf("Before sending off: freeheap: %.0f   usedheap: %.0f\n",
 	 freeheap, usedheap);
   buf.clear();
-  BCP_tm_scan_siblings(p, node, nodes_to_send, freeheap >> 2);
+  BCP_tm_scan_siblings(p, node, nodes_to_send,
+		       static_cast<long>(CoinMax(freeheap, 0.0) / 4));
   int num = nodes_to_send.size();
   if (num == 0) {
     // Everything is already sent out, but we are still having memory problems
@@ -224,12 +226,13 @@ Trying to convert an LP into TS, but its pid is not in lp_procs!\n");
     node->_data._desc = NULL;
     node->_data._user = NULL;
     node->_data_location = pid;
+    node->update_accounted_size();
   }
   nodes_to_send.clear();
 
-  usedheap = BCP_used_heap();
+  usedheap = BCP_accounted_heap();
   freeheap = maxheap - usedheap;
-  printf("After sending off: freeheap: %i   usedheap: %i\n",
+  printf("After sending off: freeheap: %.0f   usedheap: %.0f\n",
 	 freeheap, usedheap);
 
   if (saved == 0) {
@@ -164,11 +164,9 @@ TM: An internal node is assigned to a non-existing VP.\n");
 	}
     } else {
 	// try to trim at the children
-	BCP_vec<BCP_tm_node*>::iterator child;
-	BCP_vec<BCP_tm_node*>::const_iterator lastchild =
-	    node->_children.end();
-	for (child = node->_children.begin(); child != lastchild; ++child)
-	    trimmed += BCP_tm_trim_tree(p, *child, between_phases);
+	BCP_tm_node* child;
+	for (child = node->first_child(); child; child = child->next_sibling())
+	    trimmed += BCP_tm_trim_tree(p, child, between_phases);
     }
 
     return trimmed;
@@ -185,10 +183,13 @@ void BCP_tm_remove_explored(BCP_tm_prob& p, BCP_tm_node* node)
     if (node->child_num() == 0) {
 	BCP_tm_node* parent = node->parent();
 	p.search_tree.remove(node->index());
+	// unlink the node before deleting it, its memory goes back to the pool
+	if (parent) {
+	    parent->remove_child(node);
+	}
 	delete node;
 
 	if (parent) {
-	    parent->remove_child(node);
 	    BCP_tm_remove_explored(p, parent);
 	}
     }
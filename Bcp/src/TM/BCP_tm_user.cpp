@@ -1,5 +1,7 @@
 // Copyright (C) 2000, International Business Machines
 // Corporation and others.  All Rights Reserved.
+#include <algorithm>
+
 #include "CoinTime.hpp"
 
 #include "BCP_vector.hpp"
@@ -243,6 +245,16 @@ BCP_tm_user::display_final_information(const BCP_lp_statistics& lp_stat)
 	} else {
 	    printf("TM: The best solution found has value %f\n",
 		   p->feas_sol->objective_value());
+	    // If the search was not completed then report the gap, too
+	    const double lb = p->search_tree.size() == 0 ? BCP_DBL_MAX :
+		p->search_tree.true_lower_bound(p->search_tree.root());
+	    if (lb < BCP_DBL_MAX) {
+		const double ub = p->feas_sol->objective_value();
+		const double gap =
+		    std::max(0.0, ub - lb) / std::max(1.0, CoinAbs(ub));
+		printf("TM: Best lower bound: %f   gap: %.4f%%\n",
+		       lb, 100 * gap);
+	    }
 	    if (p->param(BCP_tm_par::TmVerb_BestFeasibleSolution)) {
 		p->user->display_feasible_solution(p->feas_sol);
 	    }
@@ -2,6 +2,7 @@
 // Corporation and others.  All Rights Reserved.
 
 #include <cerrno>
+#include <climits>
 
 #include "BcpConfig.h"
 #include "BCP_os.hpp"
@@ -16,7 +17,27 @@
 
 using std::make_pair;
 
-#define TS_MAX_HEAP_SIZE p.par.entry(BCP_ts_par::MaxHeapSize)
+//#############################################################################
+
+/** Return the free memory (in bytes, capped at INT_MAX since it is reported
+    to the TM as an int) based on the MaxHeapSize parameter (in megabytes)
+    and the memory accounted for the stored nodes, cuts and variables. */
+static int BCP_ts_free_heap(const BCP_ts_prob& p)
+{
+    const int maxheap = p.par.entry(BCP_ts_par::MaxHeapSize);
+    if (maxheap < 0) {
+	return INT_MAX;
+    }
+    const double fm = maxheap * 1048576.0 - BCP_accounted_heap();
+    return fm > INT_MAX ? INT_MAX : static_cast<int>(fm);
+}
+
+static inline size_t BCP_ts_node_data_size(const BCP_ts_node_data* data)
+{
+    return sizeof(BCP_ts_node_data) +
+	(data->_desc ? data->_desc->size_in_bytes() : 0) +
+	(data->_user ? data->_user->size_in_bytes() : 0);
+}
 
 //#############################################################################
 
@@ -65,6 +86,13 @@ BCP_process_t BCP_tmstorage_main(BCP_message_environment* msg_env,
 		     BCP_Msg_ProcessParameters, p.msg_buf, -1);
     p.par.unpack(p.msg_buf);
 
+    if (p.par.entry(BCP_ts_par::MaxHeapSize) == 0) {
+	// MaxHeapSize is in megabytes
+	const long fm = BCP_free_mem();
+	p.par.set_entry(BCP_ts_par::MaxHeapSize,
+			fm == -1 ? 192 /* 192M */ : static_cast<int>(fm >> 20));
+    }
+
     // Let us be nice
     setpriority(PRIO_PROCESS, 0, p.par.entry(BCP_ts_par::NiceLevel));
 
@@ -179,8 +207,7 @@ static void process_Msg_NodeList(BCP_ts_prob& p, BCP_buffer& buf)
 
     while (true) {
       if (num % 10 == 0) {
-	fm = TS_MAX_HEAP_SIZE;
-	fm -= BCP_used_heap();
+	fm = BCP_ts_free_heap(p);
 	if (fm < 1<<23 /* 8M */ ) {
 	  break;
 	}
@@ -196,9 +223,10 @@ static void process_Msg_NodeList(BCP_ts_prob& p, BCP_buffer& buf)
       buf.unpack(has_user_data);
       data->_user = has_user_data ? p.packer->unpack_user_data(buf) : 0;
       p.nodes[index] = data;
+      BCP_account_heap(BCP_ts_node_data_size(data));
       ++num;
     }
-    fm = TS_MAX_HEAP_SIZE - BCP_used_heap();
+    fm = BCP_ts_free_heap(p);
     buf.clear();
     buf.pack(num);
     buf.pack(fm);
@@ -252,13 +280,14 @@ static void process_Msg_NodeListDelete(BCP_ts_prob& p, BCP_buffer& buf)
 	    throw BCP_fatal_error("TS: Node to be deleted (%i) is not here\n",
 				  inds[i]);
 	}
+	BCP_account_heap(-static_cast<double>(BCP_ts_node_data_size(n->second)));
 	delete n->second->_desc;
 	delete n->second->_user;
 	delete n->second;
 	p.nodes.erase(n);
     }
     buf.clear();
-    int fm = TS_MAX_HEAP_SIZE - BCP_used_heap();
+    int fm = BCP_ts_free_heap(p);
     buf.pack(fm);
     p.msg_env->send(p.get_parent(), BCP_Msg_NodeListDeleteReply, buf);
 }
@@ -273,7 +302,7 @@ static void process_Msg_CutList(BCP_ts_prob& p, BCP_buffer& buf)
     int fm = 0;
     while (true) {
       if (num % 10 == 0) {
-	fm = TS_MAX_HEAP_SIZE - BCP_used_heap();
+	fm = BCP_ts_free_heap(p);
 	if (fm < 1<<23 /* 8M */ ) {
 	  break;
 	}
@@ -282,10 +311,12 @@ static void process_Msg_CutList(BCP_ts_prob& p, BCP_buffer& buf)
       if (index == -1) {
 	break;
       }
-      p.cuts[index] = p.packer->unpack_cut_algo(buf);
+      BCP_cut_algo* cut = p.packer->unpack_cut_algo(buf);
+      BCP_account_heap(cut->size_in_bytes());
+      p.cuts[index] = cut;
       ++num;
     }
-    fm = TS_MAX_HEAP_SIZE - BCP_used_heap();
+    fm = BCP_ts_free_heap(p);
     buf.clear();
     buf.pack(num);
     buf.pack(fm);
@@ -333,11 +364,12 @@ static void process_Msg_CutListDelete(BCP_ts_prob& p, BCP_buffer& buf)
 	    throw BCP_fatal_error("TS: cut to be deleted (%i) is not here\n",
 				  inds[i]);
 	}
+	BCP_account_heap(-static_cast<double>(c->second->size_in_bytes()));
 	delete c->second;
 	p.cuts.erase(c);
     }
     buf.clear();
-    int fm = TS_MAX_HEAP_SIZE - BCP_used_heap();
+    int fm = BCP_ts_free_heap(p);
     buf.pack(fm);
     p.msg_env->send(p.get_parent(), BCP_Msg_CutListDeleteReply, buf);
 }
@@ -352,7 +384,7 @@ static void process_Msg_VarList(BCP_ts_prob& p, BCP_buffer& buf)
     int fm = 0;
     while (true) {
       if (num % 10 == 0) {
-	fm = TS_MAX_HEAP_SIZE - BCP_used_heap();
+	fm = BCP_ts_free_heap(p);
 	if (fm < 1<<23 /* 8M */ ) {
 	  break;
 	}
@@ -361,10 +393,12 @@ static void process_Msg_VarList(BCP_ts_prob& p, BCP_buffer& buf)
       if (index == -1) {
 	break;
       }
-      p.vars[index] = p.packer->unpack_var_algo(buf);
+      BCP_var_algo* var = p.packer->unpack_var_algo(buf);
+      BCP_account_heap(var->size_in_bytes());
+      p.vars[index] = var;
       ++num;
     }
-    fm = TS_MAX_HEAP_SIZE - BCP_used_heap();
+    fm = BCP_ts_free_heap(p);
     buf.clear();
     buf.pack(num);
     buf.pack(fm);
@@ -412,11 +446,12 @@ static void process_Msg_VarListDelete(BCP_ts_prob& p, BCP_buffer& buf)
 	    throw BCP_fatal_error("TS: var to be deleted (%i) is not here\n",
 				  inds[i]);
 	}
+	BCP_account_heap(-static_cast<double>(v->second->size_in_bytes()));
 	delete v->second;
 	p.vars.erase(v);
     }
     buf.clear();
-    int fm = TS_MAX_HEAP_SIZE - BCP_used_heap();
+    int fm = BCP_ts_free_heap(p);
     buf.pack(fm);
     p.msg_env->send(p.get_parent(), BCP_Msg_VarListDeleteReply, buf);
 }
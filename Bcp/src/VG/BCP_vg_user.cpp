@@ -52,6 +52,8 @@ BCP_vg_user::send_var(const BCP_var& var)
 {
   BCP_buffer& buf = p->msg_buf;
   buf.clear();
+  // tell the LP which solution the var was generated for
+  buf.pack(p->node_index).pack(p->node_iteration);
   const int bcpind = var.bcpind();
   const BCP_object_t obj_t = var.obj_type();
   const BCP_obj_status stat = var.status();
@@ -0,0 +1,410 @@
+// Copyright (C) 2000, International Business Machines
+// Corporation and others.  All Rights Reserved.
+
+#include <cstdlib>
+#include <algorithm>
+#include <utility>
+
+#include "BCP_math.hpp"
+#include "BCP_error.hpp"
+#include "BCP_message.hpp"
+#include "BCP_vector.hpp"
+#include "BCP_problem_core.hpp"
+#include "BCP_var.hpp"
+#include "BCP_cut.hpp"
+#include "BCP_USER.hpp"
+#include "BCP_vp.hpp"
+#include "BCP_vp_user.hpp"
+
+//#############################################################################
+
+BCP_vp_prob::BCP_vp_prob(int my_id, int parent) :
+    BCP_process(my_id, parent),
+    user(0), packer(0), msg_env(0), core(new BCP_problem_core),
+    upper_bound(BCP_DBL_MAX), price_round(0), price_start(0),
+    csc_start(1, 0), sender(-1), phase(0),
+    node_level(0), node_index(0), node_iteration(0) {}
+
+
+BCP_vp_prob::~BCP_vp_prob()
+{
+   delete user;   user = 0;
+   delete packer; packer = 0;
+   delete core;   core = 0;
+   purge_ptr_vector(cuts);
+   for (int i = vars.size() - 1; i >= 0; --i) {
+      delete vars[i]->var;
+      delete vars[i];
+   }
+   vars.clear();
+}
+
+//#############################################################################
+
+BCP_var*
+BCP_vp_prob::unpack_var()
+{
+  BCP_object_t obj_t;
+  int bcpind;
+  BCP_var_t var_t;
+  double obj, lb, ub;
+  BCP_obj_status stat;
+  msg_buf.unpack(bcpind)
+         .unpack(obj_t).unpack(stat)
+         .unpack(var_t).unpack(obj).unpack(lb).unpack(ub);
+
+  BCP_var* var = 0;
+  switch (obj_t) {
+  case BCP_CoreObj:
+    var = new BCP_var_core(var_t, obj, lb, ub);
+    break;
+  case BCP_AlgoObj:
+    var = packer->unpack_var_algo(msg_buf);
+    var->set_var_type(var_t);
+    var->change_bounds(lb, ub);
+    var->set_obj(obj);
+    break;
+  default:
+    throw BCP_fatal_error("BCP_vp_prob::unpack_var(): unexpected obj_t.\n");
+  }
+  var->set_bcpind(bcpind);
+  var->set_status(stat);
+
+  return var;
+}
+
+//-----------------------------------------------------------------------------
+
+BCP_cut*
+BCP_vp_prob::unpack_cut()
+{
+  BCP_object_t obj_t;
+  int bcpind;
+  double lb, ub;
+  BCP_obj_status cutstat;
+  msg_buf.unpack(bcpind).unpack(obj_t).unpack(cutstat).unpack(lb).unpack(ub);
+
+  BCP_cut* cut = 0;
+  switch (obj_t) {
+  case BCP_CoreObj:
+    cut = new BCP_cut_core(lb, ub);
+    break;
+  case BCP_AlgoObj:
+    cut = packer->unpack_cut_algo(msg_buf);
+    cut->change_bounds(lb, ub);
+    break;
+  default:
+    throw BCP_fatal_error("BCP_vp_prob::unpack_cut(): unexpected obj_t.\n");
+  }
+  cut->set_bcpind(bcpind);
+  cut->set_status(cutstat);
+
+  return cut;
+}
+
+//-----------------------------------------------------------------------------
+
+void
+BCP_vp_prob::pack_var(const BCP_var& var)
+{
+  const int bcpind = var.bcpind();
+  const BCP_object_t obj_t = var.obj_type();
+  const BCP_obj_status stat = var.status();
+  const BCP_var_t var_t = var.var_type();
+  const double obj = var.obj();
+  const double lb = var.lb();
+  const double ub = var.ub();
+  msg_buf.pack(bcpind)
+         .pack(obj_t).pack(stat).pack(var_t).pack(obj).pack(lb).pack(ub);
+  switch (obj_t) {
+  case BCP_CoreObj:
+    break;
+  case BCP_AlgoObj:
+    packer->pack_var_algo(&dynamic_cast<const BCP_var_algo&>(var), msg_buf);
+    break;
+  default:
+    throw BCP_fatal_error("BCP_vp_prob::pack_var(): unexpected obj_t.\n");
+  }
+}
+
+//#############################################################################
+
+void
+BCP_vp_prob::append_to_csc(const BCP_var& var)
+{
+   BCP_vec<int> ind;
+   BCP_vec<double> val;
+   user->expand_var_on_core(var, ind, val);
+   if (ind.size() != val.size())
+      throw BCP_fatal_error("\
+VP: expand_var_on_core() returned vectors of different sizes.\n");
+   const int cutnum = core->cutnum();
+   for (int i = ind.size() - 1; i >= 0; --i) {
+      if (ind[i] < 0 || ind[i] >= cutnum)
+	 throw BCP_fatal_error("\
+VP: expand_var_on_core() returned an index that is not a core cut.\n");
+   }
+   csc_ind.append(ind);
+   csc_val.append(val);
+   csc_start.push_back(csc_ind.size());
+   csc_obj.push_back(var.obj());
+}
+
+//-----------------------------------------------------------------------------
+
+void
+BCP_vp_prob::rebuild_csc(const BCP_vec<int>& kept)
+{
+   BCP_vec<int> start;
+   BCP_vec<int> ind;
+   BCP_vec<double> val;
+   BCP_vec<double> obj;
+   const int keptnum = kept.size();
+   start.reserve(keptnum + 1);
+   obj.reserve(keptnum);
+   start.unchecked_push_back(0);
+   for (int i = 0; i < keptnum; ++i) {
+      const int k = kept[i];
+      ind.append(csc_ind.entry(csc_start[k]), csc_ind.entry(csc_start[k+1]));
+      val.append(csc_val.entry(csc_start[k]), csc_val.entry(csc_start[k+1]));
+      start.unchecked_push_back(ind.size());
+      obj.unchecked_push_back(csc_obj[k]);
+   }
+   csc_start.swap(start);
+   csc_ind.swap(ind);
+   csc_val.swap(val);
+   csc_obj.swap(obj);
+}
+
+//#############################################################################
+
+int
+BCP_vp_prob::unpack_vars_to_pool()
+{
+   int cnt;
+   int level;
+   msg_buf.unpack(cnt).unpack(level);
+
+   int newcnt = 0;
+   vars.reserve(vars.size() + cnt);
+   while (--cnt >= 0) {
+      BCP_var* var = unpack_var();
+      // A var not yet known to the TM has a negative index in the LP, but
+      // its absolute value is already unique.
+      const int key = abs(var->bcpind());
+      std::map<int, int>::iterator pos = var_position.find(key);
+      if (pos == var_position.end()) {
+	 append_to_csc(*var);
+	 var_position[key] = vars.size();
+	 vars.unchecked_push_back(new BCP_vp_var(var, level, price_round));
+	 ++newcnt;
+      } else {
+	 // Already in the pool. Keep the smaller level and switch to the
+	 // (positive) index the TM knows about if that's available now.
+	 BCP_vp_var* vpvar = vars[pos->second];
+	 if (level < vpvar->level)
+	    vpvar->level = level;
+	 if (var->bcpind() > 0)
+	    vpvar->var->set_bcpind(var->bcpind());
+	 delete var;
+      }
+   }
+   return newcnt;
+}
+
+//#############################################################################
+
+/** The pricing kernel: compute the reduced costs of the columns listed in
+    <code>pos</code> with respect to the core cuts. */
+static void
+BCP_vp_compute_csc_red_costs(const int* start, const int* ind,
+			     const double* val, const double* obj,
+			     const double* pi, const BCP_vec<int>& pos,
+			     BCP_vec<double>& red_costs)
+{
+   const int num = pos.size();
+   for (int i = 0; i < num; ++i) {
+      const int k = pos[i];
+      const int end = start[k+1];
+      int j = start[k];
+      double dp0 = 0.0;
+      double dp1 = 0.0;
+      for ( ; j + 1 < end; j += 2) {
+	 dp0 += val[j] * pi[ind[j]];
+	 dp1 += val[j+1] * pi[ind[j+1]];
+      }
+      if (j < end)
+	 dp0 += val[j] * pi[ind[j]];
+      red_costs.unchecked_push_back(obj[k] - (dp0 + dp1));
+   }
+}
+
+//-----------------------------------------------------------------------------
+
+int
+BCP_vp_prob::price_vars()
+{
+   ++price_round;
+   const int varnum = vars.size();
+   if (varnum == 0)
+      return 0;
+
+   // Split the dual solution: the duals of the core cuts are scattered into a
+   // dense vector the kernel can use, the algorithmic cuts with nonzero dual
+   // values are left for the user.
+   const int core_cutnum = core->cutnum();
+   BCP_vec<double> core_pi(core_cutnum, 0.0);
+   BCP_vec<BCP_cut*> algo_cuts;
+   BCP_vec<double> algo_pi;
+   int i;
+   for (i = cuts.size() - 1; i >= 0; --i) {
+      const BCP_cut* cut = cuts[i];
+      if (cut->obj_type() == BCP_CoreObj) {
+	 const int ind = cut->bcpind();
+	 if (ind < 0 || ind >= core_cutnum)
+	    throw BCP_fatal_error("VP: core cut with a bad index arrived.\n");
+	 core_pi[ind] = pi[i];
+      } else if (pi[i] != 0.0) {
+	 algo_cuts.push_back(cuts[i]);
+	 algo_pi.push_back(pi[i]);
+      }
+   }
+
+   if (price_start >= varnum)
+      price_start = 0;
+
+   // Price in chunks of contiguous columns, starting where the previous
+   // round has stopped (partial pricing).
+   const bool shallower_only =
+      par.entry(BCP_vp_par::VarPoolCheckOnlyShallowerVars);
+   const double tol = par.entry(BCP_vp_par::VarPoolRedCostTolerance);
+   const int partial = par.entry(BCP_vp_par::VpPartialPricingNum);
+   const int chunk = 1000;
+   BCP_vec<int> pos;
+   BCP_vec<double> red_costs;
+   BCP_vec<BCP_var*> to_adjust;
+   pos.reserve(std::min<int>(chunk, varnum));
+   red_costs.reserve(std::min<int>(chunk, varnum));
+   std::vector< std::pair<double, int> > priced_out;
+   int priced = 0;
+   int first = price_start;
+   while (priced < varnum) {
+      if (partial > 0 && static_cast<int>(priced_out.size()) >= partial)
+	 break;
+      const int len = std::min<int>(chunk, std::min<int>(varnum - first,
+							 varnum - priced));
+      pos.clear();
+      for (i = first; i < first + len; ++i) {
+	 if (shallower_only && vars[i]->level > node_level)
+	    continue;
+	 pos.unchecked_push_back(i);
+      }
+      red_costs.clear();
+      BCP_vp_compute_csc_red_costs(csc_start.begin(), csc_ind.begin(),
+				   csc_val.begin(), csc_obj.begin(),
+				   core_pi.begin(), pos, red_costs);
+      if (algo_cuts.size() > 0 && pos.size() > 0) {
+	 to_adjust.clear();
+	 for (i = 0; i < static_cast<int>(pos.size()); ++i)
+	    to_adjust.push_back(vars[pos[i]]->var);
+	 user->adjust_red_costs(to_adjust, algo_cuts, algo_pi, red_costs);
+      }
+      for (i = pos.size() - 1; i >= 0; --i) {
+	 if (red_costs[i] < -tol) {
+	    BCP_vp_var* vpvar = vars[pos[i]];
+	    ++vpvar->priced_out_count;
+	    vpvar->last_priced_out = price_round;
+	    priced_out.push_back(std::make_pair(red_costs[i], pos[i]));
+	 }
+      }
+      priced += len;
+      first += len;
+      if (first == varnum)
+	 first = 0;
+   }
+   price_start = first;
+
+   // send back the ones with the most negative reduced cost
+   std::sort(priced_out.begin(), priced_out.end());
+   int sendnum = priced_out.size();
+   const int maxsend = par.entry(BCP_vp_par::VarPoolMaxVarsToSend);
+   if (maxsend > 0 && sendnum > maxsend)
+      sendnum = maxsend;
+   for (i = 0; i < sendnum; ++i) {
+      msg_buf.clear();
+      msg_buf.pack(node_index).pack(node_iteration);
+      pack_var(*vars[priced_out[i].second]->var);
+      msg_env->send(sender, BCP_Msg_VarDescription, msg_buf);
+   }
+   return sendnum;
+}
+
+//#############################################################################
+
+/** Order positions of the pool by decreasing recency of pricing out. */
+class BCP_vp_var_is_more_recent {
+   const BCP_vec<BCP_vp_var*>& vars;
+public:
+   BCP_vp_var_is_more_recent(const BCP_vec<BCP_vp_var*>& v) : vars(v) {}
+   bool operator()(const int i0, const int i1) const {
+      const BCP_vp_var* v0 = vars[i0];
+      const BCP_vp_var* v1 = vars[i1];
+      if (v0->last_priced_out != v1->last_priced_out)
+	 return v0->last_priced_out > v1->last_priced_out;
+      return v0->priced_out_count > v1->priced_out_count;
+   }
+};
+
+void
+BCP_vp_prob::purge_pool()
+{
+   const int oldsize = vars.size();
+   const int max_age = par.entry(BCP_vp_par::VarPoolMaxAge);
+   const int max_size = par.entry(BCP_vp_par::VarPoolMaxSize);
+
+   // first select the vars that have priced out recently enough
+   int i;
+   BCP_vec<int> kept;
+   kept.reserve(oldsize);
+   for (i = 0; i < oldsize; ++i) {
+      if (price_round - vars[i]->last_priced_out <= max_age)
+	 kept.unchecked_push_back(i);
+   }
+
+   // then, if the pool is still too big, keep the ones that priced out most
+   // recently (in their original order, so the CSC block is swept in order)
+   if (static_cast<int>(kept.size()) > max_size) {
+      std::sort(kept.begin(), kept.end(), BCP_vp_var_is_more_recent(vars));
+      kept.erase(kept.entry(max_size), kept.end());
+      std::sort(kept.begin(), kept.end());
+   }
+
+   const int newsize = kept.size();
+   if (newsize == oldsize)
+      return;
+
+   BCP_vec<char> keep(oldsize, false);
+   for (i = 0; i < newsize; ++i)
+      keep[kept[i]] = true;
+   for (i = 0; i < oldsize; ++i) {
+      if (! keep[i]) {
+	 delete vars[i]->var;
+	 delete vars[i];
+      }
+   }
+   BCP_vec<BCP_vp_var*> newvars;
+   newvars.reserve(newsize);
+   for (i = 0; i < newsize; ++i)
+      newvars.unchecked_push_back(vars[kept[i]]);
+   vars.swap(newvars);
+   rebuild_csc(kept);
+   price_start = 0;
+
+   var_position.clear();
+   for (i = 0; i < newsize; ++i)
+      var_position[abs(vars[i]->var->bcpind())] = i;
+
+   if (par.entry(BCP_vp_par::VpVerb_PoolPurge))
+      printf("VP:   %i vars purged from the pool. Pool size: %i\n",
+	     oldsize - newsize, newsize);
+}
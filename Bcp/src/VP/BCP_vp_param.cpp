@@ -0,0 +1,102 @@
+// Copyright (C) 2000, International Business Machines
+// Corporation and others.  All Rights Reserved.
+#include "BCP_vp_param.hpp"
+#include "BCP_parameters.hpp"
+
+using std::make_pair;
+
+template <>
+void BCP_parameter_set<BCP_vp_par>::create_keyword_list() {
+   // Create the list of keywords for parameter file reading
+   //--------------------------------------------------------------------------
+   // CharPar
+   keys.push_back(make_pair(BCP_string("BCP_ReportWhenDefaultIsExecuted"),
+			    BCP_parameter(BCP_CharPar,
+					  ReportWhenDefaultIsExecuted)));
+   keys.push_back(make_pair(BCP_string("BCP_VarPoolCheckOnlyShallowerVars"),
+			    BCP_parameter(BCP_CharPar,
+					  VarPoolCheckOnlyShallowerVars)));
+   keys.push_back(make_pair(BCP_string("BCP_VpVerb_VarsReceivedAndSent"),
+			    BCP_parameter(BCP_CharPar,
+					  VpVerb_VarsReceivedAndSent)));
+   keys.push_back(make_pair(BCP_string("BCP_VpVerb_PoolPurge"),
+			    BCP_parameter(BCP_CharPar,
+					  VpVerb_PoolPurge)));
+//    keys.push_back(make_pair(BCP_string("BCP_"),
+// 			    BCP_parameter(BCP_CharPar,
+// 					  )));
+
+   //--------------------------------------------------------------------------
+   // IntPar
+   keys.push_back(make_pair(BCP_string("BCP_NiceLevel"),
+			    BCP_parameter(BCP_IntPar,
+					  NiceLevel)));
+   keys.push_back(make_pair(BCP_string("BCP_VarPoolMaxSize"),
+			    BCP_parameter(BCP_IntPar,
+					  VarPoolMaxSize)));
+   keys.push_back(make_pair(BCP_string("BCP_VarPoolMaxAge"),
+			    BCP_parameter(BCP_IntPar,
+					  VarPoolMaxAge)));
+   keys.push_back(make_pair(BCP_string("BCP_VarPoolMaxVarsToSend"),
+			    BCP_parameter(BCP_IntPar,
+					  VarPoolMaxVarsToSend)));
+   keys.push_back(make_pair(BCP_string("BCP_VpPartialPricingNum"),
+			    BCP_parameter(BCP_IntPar,
+					  VpPartialPricingNum)));
+//    keys.push_back(make_pair(BCP_string("BCP_"),
+// 			    BCP_parameter(BCP_IntPar,
+// 					  )));
+
+   //--------------------------------------------------------------------------
+   // DoublePar
+   keys.push_back(make_pair(BCP_string("BCP_VarPoolRedCostTolerance"),
+			    BCP_parameter(BCP_DoublePar,
+					  VarPoolRedCostTolerance)));
+//    keys.push_back(make_pair(BCP_string("BCP_"),
+// 			    BCP_parameter(BCP_DoublePar,
+// 					  )));
+
+   //--------------------------------------------------------------------------
+   // StringPar
+   keys.push_back(make_pair(BCP_string("BCP_LogFileName"),
+			    BCP_parameter(BCP_StringPar,
+					  LogFileName)));
+//    keys.push_back(make_pair(BCP_string("BCP_"),
+// 			    BCP_parameter(BCP_StringPar,
+// 					  )));
+
+   //--------------------------------------------------------------------------
+   // BoolArrayPar
+//    keys.push_back(make_pair(BCP_string("BCP_"),
+// 			    BCP_parameter(BCP_BoolArrayPar,
+// 					  Verbosity,
+// 					  )));
+}
+
+//#############################################################################
+
+template <>
+void BCP_parameter_set<BCP_vp_par>::set_default_entries(){
+   //--------------------------------------------------------------------------
+   // CharPar
+   set_entry(ReportWhenDefaultIsExecuted, true);
+   set_entry(MessagePassingIsSerial, false);
+   set_entry(VarPoolCheckOnlyShallowerVars, false);
+   set_entry(VpVerb_VarsReceivedAndSent, false);
+   set_entry(VpVerb_PoolPurge, false);
+   //--------------------------------------------------------------------------
+   // IntPar
+   set_entry(NiceLevel, 0);
+   set_entry(VarPoolMaxSize, 10000);
+   set_entry(VarPoolMaxAge, 1000);
+   set_entry(VarPoolMaxVarsToSend, 0);
+   set_entry(VpPartialPricingNum, 0);
+   //--------------------------------------------------------------------------
+   // DoublePar
+   set_entry(VarPoolRedCostTolerance, 1e-6);
+   //--------------------------------------------------------------------------
+   // StringPar
+   set_entry(LogFileName,"");
+   //--------------------------------------------------------------------------
+   // BoolArrayPar
+}
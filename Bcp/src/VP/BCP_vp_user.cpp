@@ -0,0 +1,111 @@
+// Copyright (C) 2000, International Business Machines
+// Corporation and others.  All Rights Reserved.
+
+#include "BCP_message_tag.hpp"
+#include "BCP_buffer.hpp"
+#include "BCP_error.hpp"
+#include "BCP_var.hpp"
+#include "BCP_cut.hpp"
+
+#include "BCP_vp.hpp"
+#include "BCP_vp_user.hpp"
+
+//#############################################################################
+// Informational methods for the user
+double BCP_vp_user::upper_bound() const    { return p->ub(); }
+int BCP_vp_user::current_phase() const     { return p->phase; }
+int BCP_vp_user::current_level() const     { return p->node_level; }
+int BCP_vp_user::current_index() const     { return p->node_index; }
+int BCP_vp_user::current_iteration() const { return p->node_iteration; }
+
+//#############################################################################
+// Informational methods for the user
+/* Methods to get/set BCP parameters on the fly */
+char
+BCP_vp_user::get_param(const BCP_vp_par::chr_params key) const
+{ return p->par.entry(key); }
+int
+BCP_vp_user::get_param(const BCP_vp_par::int_params key) const
+{ return p->par.entry(key); }
+double
+BCP_vp_user::get_param(const BCP_vp_par::dbl_params key) const
+{ return p->par.entry(key); }
+const BCP_string&
+BCP_vp_user::get_param(const BCP_vp_par::str_params key) const
+{ return p->par.entry(key); }
+
+void BCP_vp_user::set_param(const BCP_vp_par::chr_params key, const bool val)
+{ p->par.set_entry(key, val); }
+void BCP_vp_user::set_param(const BCP_vp_par::chr_params key, const char val)
+{ p->par.set_entry(key, val); }
+void BCP_vp_user::set_param(const BCP_vp_par::int_params key, const int val)
+{ p->par.set_entry(key, val); }
+void BCP_vp_user::set_param(const BCP_vp_par::dbl_params key, const double val)
+{ p->par.set_entry(key, val); }
+void BCP_vp_user::set_param(const BCP_vp_par::str_params key, const char * val)
+{ p->par.set_entry(key, val); }
+
+//#############################################################################
+
+void
+BCP_vp_user::unpack_module_data(BCP_buffer& buf)
+{
+  if (p->par.entry(BCP_vp_par::ReportWhenDefaultIsExecuted)) {
+    printf(" CP: Default unpack_module_data() executed.\n");
+  }
+}
+
+//#############################################################################
+
+void
+BCP_vp_user::unpack_dual_solution(BCP_buffer& buf)
+{
+  if (p->par.entry(BCP_vp_par::ReportWhenDefaultIsExecuted)) {
+    printf(" VP: Default unpack_dual_solution() executed.\n");
+  }
+
+   if (buf.msgtag() == BCP_Msg_ForVG_User) {
+      throw BCP_fatal_error("\
+VP: BCP_Msg_LpSolution_User message arrived but the unpack_dual_solution() \n\
+    function is not overridden.\n");
+   } else {
+      purge_ptr_vector(p->cuts);
+      p->pi.clear();
+      int cutnum;
+      buf.unpack(cutnum);
+      if (cutnum > 0) {
+	 p->cuts.reserve(cutnum);
+	 p->pi.reserve(cutnum);
+	 double val;
+	 while (--cutnum >= 0) {
+	    buf.unpack(val);
+	    p->pi.unchecked_push_back(val);
+	    p->cuts.unchecked_push_back(p->unpack_cut());
+	 }
+      }
+   }
+}
+
+//#############################################################################
+
+void
+BCP_vp_user::expand_var_on_core(const BCP_var& var,
+				BCP_vec<int>& ind, BCP_vec<double>& val)
+{
+  throw BCP_fatal_error("\
+VP: A Variable Pool process is used but BCP_vp_user::expand_var_on_core()\n\
+    is not overridden.\n");
+}
+
+//#############################################################################
+
+void
+BCP_vp_user::adjust_red_costs(const BCP_vec<BCP_var*>& vars,
+			      const BCP_vec<BCP_cut*>& cuts,
+			      const BCP_vec<double>& pi,
+			      BCP_vec<double>& red_costs)
+{
+  throw BCP_fatal_error("\
+VP: Algorithmic cuts have nonzero dual values but\n\
+    BCP_vp_user::adjust_red_costs() is not overridden.\n");
+}
@@ -19,6 +19,9 @@ class BCP_warmstart;
 class BCP_user_data : public Coin::ReferencedObject {
 public:
     virtual ~BCP_user_data() {}
+    /** Return the number of bytes the user data occupies in memory. Used for
+	the memory accounting of the TM and TS processes. */
+    virtual size_t size_in_bytes() const { return sizeof(BCP_user_data); }
 };
 
 //#############################################################################
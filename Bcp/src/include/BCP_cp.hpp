@@ -0,0 +1,199 @@
+// Copyright (C) 2000, International Business Machines
+// Corporation and others.  All Rights Reserved.
+#ifndef _BCP_CP_H
+#define _BCP_CP_H
+
+// This file is fully docified.
+
+#include <map>
+
+#include "BCP_math.hpp"
+#include "BCP_message_tag.hpp"
+#include "BCP_vector.hpp"
+#include "BCP_buffer.hpp"
+#include "BCP_cp_param.hpp"
+#include "BCP_parameters.hpp"
+#include "BCP_process.hpp"
+
+class BCP_cp_user;
+class BCP_user_pack;
+class BCP_message_environment;
+class BCP_problem_core;
+class BCP_var;
+class BCP_cut;
+
+//#############################################################################
+
+/** A cut stored in the Cut Pool together with the statistics used for
+    deciding which cuts to keep. Ages are measured in the number of LP
+    solutions the pool has checked (see BCP_cp_prob::check_round). */
+
+struct BCP_cp_cut {
+   /** The cut itself */
+   BCP_cut* cut;
+   /** The smallest depth of the search tree nodes the cut was sent from */
+   int level;
+   /** How many times the cut was violated by an LP solution checked by the
+       pool */
+   int violated_count;
+   /** The check round when the cut was last violated (or when it entered
+       the pool if it was never violated) */
+   int last_violated;
+   /** */
+   BCP_cp_cut(BCP_cut* c, const int lvl, const int round) :
+      cut(c), level(lvl), violated_count(0), last_violated(round) {}
+};
+
+//#############################################################################
+
+/**
+   This class is the central class of the Cut Pool process. Only one object
+   of this type is created and that holds all the data in the CP process. A
+   reference to that object is passed to (almost) every function (or member
+   method) that's invoked within the CP process.
+
+   The LP processes send the cuts that proved to be effective to the pool
+   (BCP_Msg_CutsToCutPool). The LP processes also send their LP solutions
+   every \c CutPoolCheckFrequency iterations; the pool then sends back the
+   stored cuts violated by the solution (followed by a
+   BCP_Msg_NoMoreCuts message) so that the LP processes need not regenerate
+   them.
+*/
+
+class BCP_cp_prob : public BCP_process {
+private:
+   /**@name Disabled members */
+   /*@{*/
+   /** The copy constructor is declared but not defined to disable it. */
+   BCP_cp_prob(const BCP_cp_prob&);
+   /** The assignment operator is declared but not defined to disable it. */
+   BCP_cp_prob& operator=(const BCP_cp_prob&);
+   /*@}*/
+
+public:
+   /**@name Data members */
+   /*@{*/
+
+   // User provided members ---------------------------------------------------
+   /** The user object holding the user's data. This object
+       is created by a call to the appropriate member of
+       \URL[<code>USER_initialize</code>]{USER_initialize.html}. */
+   BCP_cp_user* user;
+
+   /** A class that holds the methods about how to pack things. */
+   BCP_user_pack* packer;
+
+   /** The message passing environment. This object
+       is created by a call to the appropriate member of
+       \URL[<code>USER_initialize</code>]{USER_initialize.html}. */
+   BCP_message_environment* msg_env;
+
+   /** The message buffer of the Cut Pool process. */
+   BCP_buffer  msg_buf;
+
+   /** The parameters controlling the Cut Pool process. */
+   BCP_parameter_set<BCP_cp_par> par;
+
+   /** The description of the core of the problem. */
+   BCP_problem_core* core;
+
+   /** The best currently known upper bound. */
+   double upper_bound;
+
+   // the pool itself
+   /** The cuts in the pool. */
+   BCP_vec<BCP_cp_cut*> cuts;
+   /** Maps the (absolute value of the) internal index of a cut to its
+       position in <code>cuts</code>. Used to recognize cuts that arrive to
+       the pool again. */
+   std::map<int, int> cut_position;
+   /** The number of LP solutions checked so far. */
+   int check_round;
+
+   // the lp solution, its sender and at which node in which iteration the lp
+   // solution was generated.
+   /** The variables of the LP solution the cuts are checked against. Not
+       all variables need to be listed (e.g., list only those that have
+       nonzero values in current LP solution).
+       \sa BCP_lp_user::pack_primal_solution()
+   */
+   BCP_vec<BCP_var*> vars;
+   /** The primal values corresponding to the variables above. */
+   BCP_vec<double>   x;
+   /** The process id of the LP process that sent the solution. */
+   int sender;
+
+   /** The phase the algorithm is in. */
+   int phase;
+   /** The level of search tree node where the solution was generated. */
+   int node_level;
+   /** The index of search tree node where the solution was generated. */
+   int node_index;
+   /** The iteration within the search tree node where the solution was
+       generated. */
+   int node_iteration;
+
+   /*@}*/
+
+public:
+   /**@name Constructor and destructor */
+   /*@{*/
+   /** The default constructor. Initializes every data member to a natural
+       state. */
+   BCP_cp_prob(int my_id, int parent);
+   /** The destructor deletes everything. */
+   virtual ~BCP_cp_prob();
+   /*@}*/
+
+   /**@name Query methods */
+   /*@{*/
+   /** Return true/false indicating whether any upper bound has been found. */
+   inline bool has_ub() const { return upper_bound < BCP_DBL_MAX / 10; }
+   /** Return the current upper bound (<code>BCP_DBL_MAX</code> if there's no
+       upper bound found yet.) */
+   inline double ub() const   { return upper_bound; }
+   /*@}*/
+
+   /**@name Modifying methods */
+   /*@{*/
+   /** Set the upper bound equal to the argument. */
+   inline void ub(const double bd) { upper_bound = bd; }
+   /*@}*/
+
+   /**@name Pool management */
+   /*@{*/
+   /** Unpack the cuts in a BCP_Msg_CutsToCutPool message and add those to
+       the pool that are not there yet. Return the number of new cuts. */
+   int unpack_cuts_to_pool();
+   /** Check the cuts in the pool against the LP solution in
+       <code>vars</code> and <code>x</code>, update the statistics of the
+       cuts and send the violated ones to the sender of the solution.
+       Return the number of cuts sent. */
+   int check_cuts();
+   /** Delete the cuts that have not been violated for too long, then, if
+       the pool is still too large, the ones that were violated the longest
+       time ago. */
+   void purge_pool();
+   /*@}*/
+
+   /**@name Packing and unpacking */
+   /*@{*/
+   /** Unpack a variable. Invoked from the built-in
+       BCP_cp_user::unpack_primal_solution(). */
+   BCP_var* unpack_var();
+   /** Unpack a cut sent by an LP process. */
+   BCP_cut* unpack_cut();
+   /** Pack a cut into the message buffer the same way the LP process does
+       (i.e., so that BCP_lp_prob::unpack_cut() can unpack it). */
+   void pack_cut(const BCP_cut& cut);
+   /*@}*/
+   //--------------------------------------------------------------------------
+   virtual BCP_buffer& get_message_buffer() { return msg_buf; }
+   virtual void process_message();
+};
+
+// This function is used only internally.
+bool
+BCP_cp_process_message(BCP_cp_prob& p, BCP_buffer& buf);
+
+#endif
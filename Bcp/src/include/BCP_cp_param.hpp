@@ -0,0 +1,108 @@
+// Copyright (C) 2000, International Business Machines
+// Corporation and others.  All Rights Reserved.
+#ifndef _BCP_CP_PARAM_H
+#define _BCP_CP_PARAM_H
+
+// This file is fully docified.
+
+/** Parameters used in the Cut Pool process. These parameters can be set
+    in the original parameter file by including the following line: <br>
+    <code>BCP_{parameter name}  {parameter value}</code>. */
+
+struct BCP_cp_par{
+   /** Character parameters. All of these variables are used as booleans
+       (true = 1, false = 0). */
+   enum chr_params{
+      /** Indicates whether message passing is serial (all processes are on
+	  the same processor) or not. <br>
+	  Values: true (1), false (0). Default: 1. */
+      MessagePassingIsSerial,
+      /** Print out a message when the default version of an overridable
+	  method is executed. Default: 1. */
+      ReportWhenDefaultIsExecuted,
+      /** If true then only those cuts are checked for an LP solution that
+	  were sent to the pool from a search tree node at the same or at a
+	  smaller depth than the node where the LP solution was generated
+	  (cuts found deeper in the tree are less likely to be useful
+	  higher up). <br>
+	  Values: true (1), false (0). Default: 0. */
+      CutPoolCheckOnlyShallowerCuts,
+      /** Just a marker for the first CpVerb */
+      CpVerb_First,
+      /** Print the number of cuts received from an LP process and the
+	  number of cuts sent back for an LP solution.
+	  (BCP_cp_prob::process_message) */
+      CpVerb_CutsReceivedAndSent,
+      /** Print the size of the pool after cuts are purged from it.
+	  (BCP_cp_prob::purge_pool) */
+      CpVerb_PoolPurge,
+      /** Just a marker for the last CpVerb */
+      CpVerb_Last,
+      //
+      end_of_chr_params
+   };
+
+   /** Integer parameters. */
+   enum int_params{
+      /** The "nice" level the process should run at. On Linux and on AIX this
+	  value should be between -20 and 20. The higher this value the less
+	  resource the process will receive from the system. Note that
+	  <ol>
+	    <li> The process starts with 0 priority and it can only be
+	         increased.
+	    <li> If the load is low on the machine (e.g., when all other
+	         processes are interactive like netscape or text editors) then
+		 even with 20 priority the process will use close to 100% of
+		 the cpu, and the interactive processes will be noticably more
+		 responsive than they would be if this process ran with 0
+		 priority.
+	  </ol>
+	  @see the man page of the <code>setpriority</code> system function.
+      */
+      NiceLevel,
+      /** The maximum number of cuts kept in the pool. When the pool grows
+	  larger than this then the cuts that have not been violated for the
+	  longest time are deleted. Default: 10000. */
+      CutPoolMaxSize,
+      /** A cut is deleted from the pool if it was not violated by any of the
+	  last this many LP solutions the pool has checked. Default: 1000. */
+      CutPoolMaxAge,
+      /** The maximum number of cuts sent back to an LP process for one LP
+	  solution. The most violated cuts are sent. 0 means no limit.
+	  Default: 0. */
+      CutPoolMaxCutsToSend,
+      //
+      end_of_int_params
+   };
+
+   /** Double parameters. */
+   enum dbl_params{
+      /** A cut is considered violated if its violation (as computed by
+	  BCP_cp_user::compute_violations()) exceeds this value.
+	  Default: 1e-6. */
+      CutPoolViolationTolerance,
+      //
+      end_of_dbl_params
+   };
+
+   /** String parameters. */
+   enum str_params{
+      /** The file where the output from this process should be logged. To
+	  distinguish the output of this CP process from that of the others,
+	  the string "-cp-<process_id>" is appended to the given logfile name
+	  to form the real filename. */
+      LogFileName,
+      //
+      end_of_str_params
+   };
+
+   /** There are no string array parameters. */
+   enum str_array_params{
+      str_array_dummy,
+      //
+      end_of_str_array_params
+   };
+
+};
+
+#endif
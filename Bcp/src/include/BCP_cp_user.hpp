@@ -0,0 +1,148 @@
+// Copyright (C) 2000, International Business Machines
+// Corporation and others.  All Rights Reserved.
+#ifndef _BCP_CP_USER_H
+#define _BCP_CP_USER_H
+
+// This file is fully docified.
+
+#include "BCP_math.hpp"
+#include "BCP_vector.hpp"
+#include "BCP_cp_param.hpp"
+#include "BCP_string.hpp"
+#include "BCP_USER.hpp"
+
+class BCP_cp_prob;
+class BCP_buffer;
+class BCP_var;
+class BCP_cut;
+
+/**
+   The BCP_cp_user class is the base class from which the user
+   can derive a problem specific class to be used in the Cut Pool process.
+
+   In that derived class the user can store data to be used in the methods she
+   overrides. Also that is the object the user must return in the
+   USER_initialize::cp_init() method.
+
+   There are two kind of methods in the class. The non-virtual methods are
+   helper functions for the built-in defaults, but the user can use them as
+   well. The virtual methods execute steps in the BCP algorithm where the user
+   might want to override the default behavior.
+
+   The default implementations fall into three major categories.
+   <ul>
+     <li> Empty; doesn't do anything and immediately returns (e.g.,
+          unpack_module_data()).
+     <li> There is no reasonable default, so throw an exception. This
+          happens with compute_violations(): the pool stores only
+	  algorithmic cuts and only the user knows how to evaluate them at an
+	  LP solution.
+     <li> A default is given. Frequently there are multiple defaults and
+          parameters govern which one is selected (e.g.,
+	  unpack_primal_solution()).
+   </ul>
+*/
+
+class BCP_cp_user : public BCP_user_class {
+private:
+  BCP_cp_prob * p;
+public:
+  /**@name Methods to set and get the pointer to the BCP_cp_prob
+     object. It is unlikely that the users would want to muck around with
+     these (especially with the set method!) but they are here to provide
+     total control.
+  */
+  /*@{*/
+    /// Set the pointer
+    void setCpProblemPointer(BCP_cp_prob * ptr) { p = ptr; }
+    /// Get the pointer
+    BCP_cp_prob * getCpProblemPointer() { return p; }
+  /*@}*/
+
+  /**@name Informational methods for the user. */
+  /*@{*/
+    /** Return what is the best known upper bound (might be BCP_DBL_MAX) */
+    double upper_bound() const;
+    /** Return the phase the algorithm is in */
+    int current_phase() const;
+    /** Return the level of the search tree node for which cuts are being
+        checked */
+    int current_level() const;
+    /** Return the internal index of the search tree node for which cuts are
+	being checked */
+    int current_index() const;
+    /** Return the iteration count within the search tree node for which cuts
+	are being checked */
+    int current_iteration() const;
+  /*@}*/
+
+  /**@name Methods to get/set BCP parameters on the fly */
+  /*@{*/
+    ///
+    char              get_param(const BCP_cp_par::chr_params key) const;
+    ///
+    int               get_param(const BCP_cp_par::int_params key) const;
+    ///
+    double            get_param(const BCP_cp_par::dbl_params key) const;
+    ///
+    const BCP_string& get_param(const BCP_cp_par::str_params key) const;
+
+    ///
+    void set_param(const BCP_cp_par::chr_params key, const bool val);
+    ///
+    void set_param(const BCP_cp_par::chr_params key, const char val);
+    ///
+    void set_param(const BCP_cp_par::int_params key, const int val);
+    ///
+    void set_param(const BCP_cp_par::dbl_params key, const double val);
+    ///
+    void set_param(const BCP_cp_par::str_params key, const char * val);
+  /*@}*/
+
+  //===========================================================================
+  /**@name Constructor, Destructor */
+  /*@{*/
+    BCP_cp_user() : p(0) {}
+    /** Being virtual, the destructor invokes the destructor for the real type
+	of the object being deleted. */
+    virtual ~BCP_cp_user() {}
+  /*@}*/
+
+  //===========================================================================
+  // Here are the user defined functions. For each of them a default is given
+  // which can be overridden when the concrete user class is defined.
+  //===========================================================================
+  /** Unpack the initial information sent to the Cut Pool process by the
+      Tree Manager. This information was packed by the method
+      BCP_tm_user::pack_module_data() invoked with \c BCP_ProcessType_CP as
+      the third (target process type) argument. <br>
+      Default: empty method. */
+  virtual void
+  unpack_module_data(BCP_buffer & buf);
+
+  //---------------------------------------------------------------------------
+  /** Unpack the LP solution arriving from the LP process. This method is
+      invoked only if the user packs the info necessary for cut generation by
+      herself, i.e., she overrides the BCP_lp_user::pack_primal_solution().
+      If that's the case the user has to unpack the same info she has packed
+      in the LP process. */
+  virtual void
+  unpack_primal_solution(BCP_buffer& buf);
+
+  //---------------------------------------------------------------------------
+  /** Compute the violation of each cut in <code>cuts</code> at the LP
+      solution given by <code>vars</code> and <code>x</code>. The violation
+      of the i-th cut must be stored in <code>violations[i]</code>; a cut is
+      sent back to the LP process if its violation exceeds the
+      \c CutPoolViolationTolerance parameter. <code>violations</code> has
+      the same size as <code>cuts</code> upon invocation and is filled with
+      zeros. <br>
+      Default: throw an exception. */
+  virtual void
+  compute_violations(const BCP_vec<BCP_var*>& vars,
+		     const BCP_vec<double>& x,
+		     const BCP_vec<BCP_cut*>& cuts,
+		     BCP_vec<double>& violations);
+};
+
+#endif
@@ -84,6 +84,10 @@ public:
     inline double ub() const             { return _ub; }
     /** Return the internal index of the cut. */
     inline int bcpind() const  { return _bcpind; }
+    /** Return the number of bytes the cut occupies in memory. This is used
+	for the memory accounting of the TM and TS processes. Algorithmic
+	cuts holding a large amount of data should override it. */
+    virtual size_t size_in_bytes() const { return sizeof(BCP_cut); }
 
     /* *@name Query methods about the status of the variable */
     /* @{*/
@@ -224,6 +228,8 @@ public:
    /** Return <code>BCP_CoreObj</code> indicating that the object is a core
        cut. */
    inline BCP_object_t obj_type() const  { return BCP_CoreObj; }
+   /** Return the memory occupied by the core cut. */
+   virtual size_t size_in_bytes() const { return sizeof(BCP_cut_core); }
    /*@}*/
 };
 
@@ -267,6 +273,22 @@ public:
        algorithmic cut. */
    inline BCP_object_t obj_type() const   { return BCP_AlgoObj; }
    /*@}*/
+
+   /**@name Hashing */
+   /*@{*/
+   /** Return a hash value of the cut for fast duplicate detection in the LP
+       process (see the <code>CompareNewCutsToOldOnes</code> parameter). If
+       the method returns a nonzero value then BCP_lp_user::compare_cuts() is
+       invoked only for cuts with the same hash value, thus cuts that
+       compare_cuts() may find the same (or one better than the other) must
+       have the same hash value. The default returns 0 (no hash), in which
+       case the row expanded from the cut is hashed (see
+       BCP_row::hash_value()) and only cuts identical up to scaling are
+       found; compare_cuts() is not invoked. An application whose
+       compare_cuts() finds other duplicates (e.g., dominated cuts) should
+       override this method. */
+   virtual size_t hash_value() const { return 0; }
+   /*@}*/
 };
 
 //#############################################################################
@@ -18,7 +18,12 @@ enum BCP_slack_cut_discarding{
    BCP_DiscardSlackCutsAtNewNode,
    /** Purge the slack cuts at every iteration while processing search tree
        nodes. (Note that purging will be performed more often in this case.) */
-   BCP_DiscardSlackCutsAtNewIteration
+   BCP_DiscardSlackCutsAtNewIteration,
+   /** Keep the slack cuts (of every removed cut, not only when branching on
+       cuts) until the pool holds <code>SlackPoolMaxSize</code> of them, then
+       discard the least recently used ones. Before cut generation the pool
+       is checked and the violated cuts are added back to the formulation. */
+   BCP_DiscardSlackCutsLeastRecentlyUsed
 };
 
 //-----------------------------------------------------------------------------
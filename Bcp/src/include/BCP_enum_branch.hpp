@@ -108,7 +108,8 @@ enum BCP_branching_object_comparison{
    BCP_LowestHighObjval =         0x04 | BCP_Comparison_Objval,
    BCP_HighestHighObjval =        0x06 | BCP_Comparison_Objval,
    BCP_LowestAverageObjval =      0x08 | BCP_Comparison_Objval,
-   BCP_HighestAverageObjval =     0x0a | BCP_Comparison_Objval
+   BCP_HighestAverageObjval =     0x0a | BCP_Comparison_Objval,
+   BCP_HighestProductObjval =     0x0c | BCP_Comparison_Objval
    // We have info about fracnum_branching on the second to last four bits.
    // Of those, the last shows that this is fracnum branching, the three
    // before that show the various types.
@@ -21,6 +21,11 @@ class BCP_fatal_error{
 public:
    static bool abort_on_error;
 
+private:
+   /** The error message (at most 1000 characters of it if it was given by a
+       format string). */
+   std::string _msg;
+
 public:
    /** The constructor prints out the error message, flushes the stdout buffer
        and aborts execution. */
@@ -31,7 +36,7 @@ public:
       abort();
    }
 #endif
-   BCP_fatal_error(const std::string& str) {
+   BCP_fatal_error(const std::string& str) : _msg(str) {
       printf("%s", str.c_str());
       fflush(0);
       if (abort_on_error)
@@ -42,12 +47,19 @@ public:
       va_start(valist,format);
       vprintf(format, valist);
       va_end(valist);
+      char msg[1001];
+      va_start(valist,format);
+      vsnprintf(msg, sizeof(msg), format, valist);
+      va_end(valist);
+      _msg = msg;
       fflush(0);
       if (abort_on_error)
 	 abort();
    }
    /** The destructor exists only because it must. */
    ~BCP_fatal_error() {}
+   /** Return the error message. */
+   const char* what() const { return _msg.c_str(); }
 };
 
 #endif
@@ -4,6 +4,8 @@
 #define _BCP_LP_H
 
 #include <cfloat>
+#include <map>
+#include <utility>
 
 #include "BCP_math.hpp"
 #include "BCP_enum.hpp"
@@ -15,6 +17,13 @@
 
 #include "BCP_buffer.hpp"
 #include "BCP_process.hpp"
+#include "BCP_lp_pseudocost.hpp"
+#include "BCP_lp_sb_cache.hpp"
+#include "BCP_lp_propagator.hpp"
+#include "BCP_lp_stabilizer.hpp"
+#include "BCP_lp_lagrangian.hpp"
+#include "BCP_lp_slack_pool.hpp"
+#include "BCP_lp_hash_index.hpp"
 
 //#############################################################################
 class OsiObject;
@@ -49,6 +58,50 @@ class CoinWarmStart;
 // Everything in BCP_lp_prob is public. If the user wants to shoot herself in
 // the leg she can do it.
 
+/** A histogram of durations (in seconds) on a logarithmic scale. The first
+    bin counts the durations under 1 millisecond, the k-th bin those in
+    <code>[2^(k-1), 2^k)</code> milliseconds and the last bin the rest. */
+
+class BCP_time_histogram {
+public:
+    /** The number of bins */
+    enum { BinNum = 16 };
+    /** The number of durations in the bins */
+    int count[BinNum];
+    /** The sum of the durations */
+    double total;
+    /** The longest duration */
+    double longest;
+
+public:
+    /** The constructor creates an empty histogram */
+    BCP_time_histogram() : total(0), longest(0) {
+	for (int i = 0; i < BinNum; ++i)
+	    count[i] = 0;
+    }
+
+    /** The number of durations recorded */
+    int num() const;
+    /** Record a duration */
+    void record(const double t);
+
+    /**@name Packing and unpacking */
+    /*@{*/
+    /** */
+    void pack(BCP_buffer& buf) const;
+    /** */
+    void unpack(BCP_buffer& buf);
+    /*@}*/
+
+    /** Print out the non-empty bins with the given title */
+    void display(const char* title) const;
+
+    /** Add the argument histogram to this one */
+    void add(const BCP_time_histogram& hist);
+};
+
+//#############################################################################
+
 /** NO OLD DOC
 
 */
@@ -67,6 +120,71 @@ public:
     double time_lp_solving;
     /** */
     double time_branching;
+    /** Time spent on loading the formulation of the search tree nodes into
+	the LP solver */
+    double time_node_setup;
+    /** The number of search tree nodes loaded into the LP solver */
+    int nodes_set_up;
+    /** The number of those that were set up by modifying the LP of the
+	previous node */
+    int nodes_reused_lp;
+    /** The number of presolved children looked up in the strong branching
+	cache */
+    int sb_cache_lookups;
+    /** The number of those that were found in the cache */
+    int sb_cache_hits;
+    /** The number of simplex iterations in the LP solves within the nodes
+	(strong branching not included) */
+    int lp_iterations;
+    /** Time spent on adding/deleting rows and columns of the LP solver
+	(except at node setup) */
+    double time_lp_modification;
+    /** Time spent on computing the violations/reduced costs of the cuts and
+	variables in the local pools (and the slack pool) */
+    double time_pool_checks;
+    /** Time spent on packing node descriptions sent to the TM */
+    double time_msg_packing;
+    /** Time spent on unpacking node descriptions received from the TM */
+    double time_msg_unpacking;
+    /** Time (wallclock) spent on waiting for cuts from the CG/CP */
+    double time_waiting_cg;
+    /** Time (wallclock) spent on waiting for variables from the VG/VP */
+    double time_waiting_vg;
+    /** Time (wallclock) spent on waiting for diving info from the TM */
+    double time_waiting_tm;
+    /** The processing time of the search tree nodes (without the setup) */
+    BCP_time_histogram node_time;
+    /** The time of the LP solves within the nodes */
+    BCP_time_histogram lp_solve_time;
+    /** The time (wallclock) of presolving the strong branching candidates,
+	one entry for every candidate */
+    BCP_time_histogram sb_candidate_time;
+    /** The number of calls to BCP_lp_user::generate_heuristic_solution() */
+    int heur_calls;
+    /** The number of those calls that improved the upper bound */
+    int heur_successes;
+    /** The number of iterations where the heuristic was not invoked because
+	of the <code>HeuristicFrequency</code> parameter */
+    int heur_skipped_frequency;
+    /** ... because the node was deeper than <code>HeuristicMaxDepth</code> */
+    int heur_skipped_depth;
+    /** ... because the gap was below <code>HeuristicMinGap</code> */
+    int heur_skipped_gap;
+    /** ... because the time spent in the heuristic exceeded
+	<code>HeuristicMaxTimeFraction</code> */
+    int heur_skipped_time;
+    /** ... by the adaptive throttling (see <code>HeuristicAdaptive</code>) */
+    int heur_skipped_adaptive;
+    /** The number of calls of the heuristic at every depth of the search
+	tree */
+    BCP_vec<int> heur_calls_by_depth;
+    /** The number of successful calls at every depth */
+    BCP_vec<int> heur_successes_by_depth;
+    /** The number of iterations at every depth where the adaptive throttling
+	decided whether to invoke the heuristic */
+    BCP_vec<int> heur_chances_by_depth;
+    /** The time of the heuristic calls */
+    BCP_time_histogram heur_time;
 
 public:
     /** The contsructor just zeros out every timing data */
@@ -76,7 +194,27 @@ public:
 	time_var_generation(0),
 	time_heuristics(0),
 	time_lp_solving(0),
-	time_branching(0)
+	time_branching(0),
+	time_node_setup(0),
+	nodes_set_up(0),
+	nodes_reused_lp(0),
+	sb_cache_lookups(0),
+	sb_cache_hits(0),
+	lp_iterations(0),
+	time_lp_modification(0),
+	time_pool_checks(0),
+	time_msg_packing(0),
+	time_msg_unpacking(0),
+	time_waiting_cg(0),
+	time_waiting_vg(0),
+	time_waiting_tm(0),
+	heur_calls(0),
+	heur_successes(0),
+	heur_skipped_frequency(0),
+	heur_skipped_depth(0),
+	heur_skipped_gap(0),
+	heur_skipped_time(0),
+	heur_skipped_adaptive(0)
     {}
 
     /**@name Packing and unpacking */
@@ -90,6 +228,10 @@ public:
     /** Print out the statistics */
     void display() const;
 
+    /** Make sure that the per depth heuristic statistics have an entry for
+	<code>depth</code> */
+    void heur_extend_to_depth(const int depth);
+
     /** Add the argument statistics to this one. This method is used when
 	multiple LP processes are running and their stats need to be combined. */
     void add(const BCP_lp_statistics& stat);
@@ -135,6 +277,15 @@ public:
     OsiSolverInterface* master_lp;
     /** */
     OsiSolverInterface* lp_solver;
+    /** The LP solver kept from the previous search tree node if the
+	\c ReuseLpBetweenNodes parameter is set (0 otherwise). */
+    OsiSolverInterface* resident_lp;
+    /** The (absolute value of the) internal indices of the extra vars and
+	cuts whose columns/rows are in <code>resident_lp</code>, in the
+	order they are there. */
+    BCP_vec<int> resident_var_ind;
+    /** */
+    BCP_vec<int> resident_cut_ind;
     /** */
     BCP_message_environment* msg_env;
     /*@}*/
@@ -185,12 +336,18 @@ public:
     BCP_lp_result* lp_result;
     /** */
     int var_bound_changes_since_logical_fixing;
-    /** */
-    BCP_vec<BCP_cut*> slack_pool;
+    /** The cuts that have become slack and were removed from the
+	formulation */
+    BCP_lp_slack_pool slack_pool;
     /** */
     BCP_lp_var_pool* local_var_pool;
     /** */
     BCP_lp_cut_pool* local_cut_pool;
+    /** The hash index of the cuts in the formulation and in the local cut
+	pool while new cuts are received */
+    BCP_lp_hash_index<BCP_cut, BCP_row> cut_hash_index;
+    /** The same for the vars */
+    BCP_lp_hash_index<BCP_var, BCP_col> var_hash_index;
 
     // The next/last index we can assign to a newly generated var/cut
     /** */
@@ -222,12 +379,34 @@ public:
     double upper_bound;
     /** */
     int phase;
+    /** The pseudo-costs of the variables collected during branching. */
+    BCP_lp_pseudocosts pseudocosts;
+    /** The cached strong branching results. */
+    BCP_lp_sb_cache sb_cache;
+    /** The bound propagator working on the rows of the LP relaxation. */
+    BCP_lp_propagator propagator;
+    /** The dual stabilization used in pricing. */
+    BCP_lp_dual_stabilizer stabilizer;
+    /** The Lagrangian bound computed from the reports of the pricing. */
+    BCP_lp_lagrangian_bound lagrangian;
     /** */
     int no_more_cuts_cnt; // a counter for how many places we got to get
                           // NO_MORE_CUTS message to know for sure not to
                           // expect more.
     /** */
     int no_more_vars_cnt; // similar for vars
+    /** The number of LP solutions sent to each CG/CP/VG/VP process (keyed
+	by process id) that have not been answered by a
+	BCP_Msg_NoMoreCuts/BCP_Msg_NoMoreVars message yet. Used in
+	asynchronous generation to tell whether a process is busy. */
+    std::map<int, int> unanswered_solutions;
+    /** The search tree node index and iteration of the last LP solution
+	sent to each CG/CP/VG/VP process (keyed by process id). */
+    std::map<int, std::pair<int, int> > last_solution_sent;
+    /** The bounds on variables that are valid in the whole search tree
+	(keyed by the index of the variable), as received from the TM. They
+	are applied at the beginning of every search tree node. */
+    std::map<int, std::pair<double, double> > global_var_bounds;
     /*@}*/
    
     // message passing related fields
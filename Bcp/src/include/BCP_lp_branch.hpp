@@ -139,6 +139,13 @@ public:
     BCP_vec<double>* objval_;
     BCP_vec<int>* termcode_;
     /*@}*/
+
+    /** True if the candidate need not be presolved because the estimate of
+	its children is trusted (e.g., its pseudo-costs are reliable). If the
+	only candidate selected for branching is reliable then it is
+	branched on without strong branching; otherwise every candidate is
+	presolved as usual. */
+    bool reliable_;
   
     /*@}*/
 
@@ -167,7 +174,7 @@ public:
 	forced_var_bd(0), forced_cut_bd(0),
 	implied_var_pos(0), implied_cut_pos(0),
 	implied_var_bd(0), implied_cut_bd(0),
-	objval_(0), termcode_(0)
+	objval_(0), termcode_(0), reliable_(false)
     {
 	if ( ((fvp == 0) ^ (fvb == 0)) || ((fcp == 0) ^ (fcb == 0)) || 
 	     ((ivp == 0) ^ (ivb == 0)) || ((icp == 0) ^ (icb == 0)) )
@@ -425,6 +432,16 @@ public:
     /** Return true if at least one child had numerical difficulties while
 	presolving. */
     bool had_numerical_problems() const; 
+    /** Return true if every child has an LP solution, i.e., none of the
+	results was taken from the strong branching cache (see
+	<code>fake_results()</code>). */
+    inline bool has_lp_solutions() const {
+	for (int i = _lpres.size() - 1; i >= 0; --i) {
+	    if (_lpres[i]->x() == 0)
+		return false;
+	}
+	return true;
+    }
     /*@}*/
 
     /**@name Modifying methods */
@@ -467,6 +484,12 @@ public:
     inline void get_results(OsiSolverInterface& lp, const int child_ind) {
 	_lpres[child_ind]->get_results(lp);
     }
+    /** Set the outcome of presolving the <code>child_ind</code>-th child
+	without solving it (e.g., from the strong branching cache). */
+    inline void fake_results(const int child_ind, const int termcode,
+			     const int iternum, const double objval) {
+	_lpres[child_ind]->fake_result(termcode, iternum, objval);
+    }
     /** Examine the termination codes for the children and for those that do
 	not have a valid lower bound fake the objective value depending on the
 	termination code:
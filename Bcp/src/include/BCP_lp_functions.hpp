@@ -26,6 +26,7 @@ class BCP_col;
 class BCP_row;
 class BCP_warmstart;
 class BCP_var;
+class BCP_cut;
 
 //-----------------------------------------------------------------------------
 // BCP_lp_main.cpp
@@ -60,9 +61,20 @@ int BCP_lp_generate_cuts(BCP_lp_prob& p,
 
 //-----------------------------------------------------------------------------
 // BCP_lp_generate_vars.cpp
+void BCP_lp_stabilize_duals(BCP_lp_prob& p, const bool cutset_changed);
 int BCP_lp_generate_vars(BCP_lp_prob& p,
 			 bool first_in_loop, const bool from_repricing);
 
+//-----------------------------------------------------------------------------
+// BCP_lp_generators.cpp
+void BCP_lp_run_separators(BCP_lp_prob& p, const BCP_lp_result& lpres,
+			   BCP_vec<BCP_cut*>& new_cuts,
+			   BCP_vec<BCP_row*>& new_rows);
+void BCP_lp_run_pricers(BCP_lp_prob& p, const BCP_lp_result& lpres,
+			const bool before_fathom, const int first,
+			BCP_vec<BCP_var*>& new_vars,
+			BCP_vec<BCP_col*>& new_cols);
+
 //-----------------------------------------------------------------------------
 // BCP_lp_misc.cpp
 void BCP_lp_process_result(BCP_lp_prob& p, const BCP_lp_result& lpres);
@@ -82,19 +94,41 @@ void BCP_lp_add_rows_to_lp(const BCP_vec<BCP_row*>& rows,
 void BCP_lp_check_ub(BCP_lp_prob& p);
 int BCP_lp_next_var_index(BCP_lp_prob& p);
 int BCP_lp_next_cut_index(BCP_lp_prob& p);
+void BCP_lp_set_objective_cutoff(BCP_lp_prob& p, OsiSolverInterface& lp);
 void BCP_lp_process_ub_message(BCP_lp_prob& p, BCP_buffer& buf);
+void BCP_lp_process_global_var_bounds(BCP_lp_prob& p, BCP_buffer& buf);
+void BCP_lp_process_child_bound(BCP_lp_prob& p, BCP_buffer& buf);
+void BCP_lp_send_global_var_bounds(BCP_lp_prob& p,
+				   const BCP_vec<int>& changed_pos);
 void BCP_lp_send_cuts_to_cp(BCP_lp_prob& p, const int eff_cnt_limit);
+void BCP_lp_send_vars_to_vp(BCP_lp_prob& p);
+void BCP_lp_send_solution(BCP_lp_prob& p, const int target,
+			  const BCP_message_tag msgtag);
+bool BCP_lp_has_current_solution(const BCP_lp_prob& p, const int target);
+bool BCP_lp_is_busy(const BCP_lp_prob& p, const int target);
+void BCP_lp_send_for_cg(BCP_lp_prob& p, const bool check_pool,
+			const bool force);
+void BCP_lp_send_for_vg(BCP_lp_prob& p, const bool force);
+void BCP_lp_receive_pending(BCP_lp_prob& p);
 void BCP_lp_unpack_diving_info(BCP_lp_prob& p, BCP_buffer& buf);
+void BCP_lp_build_cut_hash_index(BCP_lp_prob& p);
+void BCP_lp_build_var_hash_index(BCP_lp_prob& p);
 
 //-----------------------------------------------------------------------------
 // BCP_lp_branch.cpp
 BCP_branching_result
 BCP_lp_branch(BCP_lp_prob& p);
+int BCP_lp_single_var_branch(const BCP_lp_prob& p,
+			     const BCP_lp_branching_object* can,
+			     const int orig_colnum, const int child,
+			     bool& up, double& change);
 
 //-----------------------------------------------------------------------------
 // BCP_lp_colrow.cpp
 bool BCP_lp_fix_vars(BCP_lp_prob& p);
+bool BCP_lp_propagate_bounds(BCP_lp_prob& p);
 void BCP_lp_adjust_row_effectiveness(BCP_lp_prob& p);
+void BCP_lp_adjust_col_effectiveness(BCP_lp_prob& p);
 void BCP_lp_delete_cols_and_rows(BCP_lp_prob& p,
 				 BCP_lp_branching_object* can,
 				 const int added_colnum,
@@ -118,7 +152,7 @@ void BCP_lp_unpack_active_node(BCP_lp_prob& p, BCP_buffer& buf);
 
 //-----------------------------------------------------------------------------
 // BCP_lp_create_lp.cpp
-void BCP_lp_create_lp(BCP_lp_prob& p);
+void BCP_lp_create_lp(BCP_lp_prob& p, const bool reuse);
 
 //-----------------------------------------------------------------------------
 // BCP_lp_create_warmstart.cpp
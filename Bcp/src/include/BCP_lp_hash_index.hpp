@@ -0,0 +1,67 @@
+// Copyright (C) 2000, International Business Machines
+// Corporation and others.  All Rights Reserved.
+#ifndef _BCP_LP_HASH_INDEX_H
+#define _BCP_LP_HASH_INDEX_H
+
+#include <map>
+#include <utility>
+
+//#############################################################################
+
+/** A hash index of the cuts (vars) in the current formulation and in the
+    local pool, used for detecting duplicates among newly arrived cuts
+    (vars) without comparing them to every existing one.
+
+    An object is indexed either by its own hash value (see
+    BCP_cut_algo::hash_value()), in which case <code>vec</code> is 0 in
+    its entry, or by the hash value of the row (column) expanded from it.
+    The index only holds pointers; it is built when the LP process starts
+    to receive new objects and is deactivated (emptied) when it stops, so
+    that nothing is deleted while the index refers to it. */
+
+template <class Obj, class Vec>
+class BCP_lp_hash_index {
+public:
+   /** */
+   struct entry {
+      /** */
+      const Obj* obj;
+      /** The expanded object if the entry is indexed by its hash value */
+      const Vec* vec;
+   };
+   /** */
+   typedef typename std::multimap<size_t, entry>::const_iterator
+   const_iterator;
+
+private:
+   /** */
+   std::multimap<size_t, entry> _index;
+   /** */
+   bool _is_active;
+
+public:
+   /** */
+   BCP_lp_hash_index() : _index(), _is_active(false) {}
+
+   /** Whether the index is in use (i.e., new objects are received) */
+   inline bool is_active() const { return _is_active; }
+   /** Empty the index and start using it. */
+   inline void activate() { _index.clear(); _is_active = true; }
+   /** Empty the index and stop using it. */
+   inline void deactivate() { _index.clear(); _is_active = false; }
+
+   /** */
+   inline void insert(const size_t hash, const Obj* obj, const Vec* vec) {
+      entry e;
+      e.obj = obj;
+      e.vec = vec;
+      _index.insert(std::make_pair(hash, e));
+   }
+   /** The entries with the given hash value. */
+   inline std::pair<const_iterator, const_iterator>
+   equal_range(const size_t hash) const {
+      return _index.equal_range(hash);
+   }
+};
+
+#endif
@@ -0,0 +1,119 @@
+// Copyright (C) 2000, International Business Machines
+// Corporation and others.  All Rights Reserved.
+#ifndef _BCP_LP_LAGRANGIAN_H
+#define _BCP_LP_LAGRANGIAN_H
+
+#include "BCP_math.hpp"
+#include "BCP_vector.hpp"
+
+//#############################################################################
+
+/** Lagrangian lower bounds of a search tree node during column generation.
+
+    While columns are generated the objective value of the LP relaxation is
+    not a lower bound for the node. However, if the pricing is exact then
+    the most negative reduced cost found by the pricing of each subproblem
+    yields one. For a minimization problem whose columns come from the
+    subproblems <code>k</code>, and the columns of subproblem <code>k</code>
+    sum up to at most <code>m_k</code> in any solution (the multiplicity,
+    e.g., the right hand side of its convexity constraint), the bound is
+
+    <code>z_LP + sum_k m_k * min(0, rc_k)</code>
+
+    where <code>z_LP</code> is the optimal LP value and <code>rc_k</code>
+    is the smallest reduced cost in subproblem <code>k</code>. If every cost
+    coefficient is positive and the pricing also reports the smallest ratio
+    <code>r_k</code> of reduced cost and cost then the Farley bound
+
+    <code>z_LP / (1 - min(0, min_k r_k))</code>
+
+    is valid as well, and this does not need the multiplicities. The larger
+    of the two is used.
+
+    The reports are collected in a pricing round (see
+    <code>start_round()</code>), and the bound is valid only if every
+    subproblem was solved to optimality and reported in that round. */
+
+class BCP_lp_lagrangian_bound {
+private:
+    /**@name Disabled methods */
+    /*@{*/
+    /** The copy constructor is declared but not defined to disable it. */
+    BCP_lp_lagrangian_bound(const BCP_lp_lagrangian_bound&);
+    /** The assignment operator is declared but not defined to disable it. */
+    BCP_lp_lagrangian_bound& operator=(const BCP_lp_lagrangian_bound&);
+    /*@}*/
+
+private:
+    /**@name The reports of the current round, one entry per subproblem */
+    /*@{*/
+    /** */
+    BCP_vec<char> _reported;
+    /** */
+    BCP_vec<double> _min_rc;
+    /** */
+    BCP_vec<double> _multiplicity;
+    /** */
+    BCP_vec<double> _min_rc_ratio;
+    /** Whether a report was rejected in the round (see
+	<code>fix_subproblem_num()</code>) */
+    bool _rejected;
+    /*@}*/
+
+    /** Whether the number of subproblems is fixed (the pricers are running,
+	possibly concurrently) */
+    bool _fixed;
+
+    /** The best bound computed at the current search tree node */
+    double _best;
+    /** The number of consecutive rounds at the current node in which the
+	best bound has not improved significantly */
+    int _stalled;
+
+public:
+    /**@name Constructor and destructor */
+    /*@{*/
+    /** */
+    BCP_lp_lagrangian_bound() :
+	_rejected(false), _fixed(false), _best(-BCP_DBL_MAX), _stalled(0) {}
+    /** */
+    ~BCP_lp_lagrangian_bound() {}
+    /*@}*/
+
+    /** Forget the bounds of the previous search tree node. */
+    void reset() { _best = -BCP_DBL_MAX; _stalled = 0; }
+
+    /** Start a new pricing round, dropping the reports of the previous one.
+	Room is made for <code>subproblem_num</code> subproblems so that the
+	pricers running concurrently (each reporting on its own subproblem)
+	do not need to reallocate. */
+    void start_round(const int subproblem_num);
+
+    /** Fix (or release) the number of subproblems. While it is fixed the
+	vectors of the reports are not resized, so the pricers running
+	concurrently can report safely; a report on a subproblem beyond those
+	the round was started with is rejected and invalidates the round. */
+    void fix_subproblem_num(const bool fixed) { _fixed = fixed; }
+
+    /** Record the result of the pricing of subproblem
+	<code>subproblem</code>. See BCP_lp_user::report_pricing_bound(). */
+    void report(const int subproblem, const double min_rc,
+		const double multiplicity, const double min_rc_ratio);
+
+    /** Compute the bound from the reports of the current round and the
+	optimal value <code>lp_objval</code> of the LP relaxation. Also
+	update the best bound of the node and its stall count; an improvement
+	less than <code>improvement</code> (relative) does not count.
+	@return false unless every subproblem the round was started with
+	(and every other one up to the largest reported index) has reported
+	in the round and no report was rejected. */
+    bool compute(const double lp_objval, const double improvement,
+		 double& bound);
+
+    /** The best bound computed at the current search tree node */
+    double best() const { return _best; }
+    /** The number of consecutive rounds without improving the best bound */
+    int stalled() const { return _stalled; }
+};
+
+#endif
@@ -15,6 +15,16 @@ struct BCP_lp_par{
    /** Character parameters. All of these variables are used as booleans
        (true = 1, false = 0). */
    enum chr_params{
+      /** If true (and the message passing is not serial) then the LP process
+	  does not wait for the CG/CP (VG) to answer the current LP solution
+	  when it has cuts (vars) to add already, e.g., results that arrived
+	  for an earlier solution, or the ones generated in the LP process
+	  itself. In that case the LP is resolved while the generators keep
+	  working in the background. A CG/CP (VG) that is still working on an
+	  earlier solution is not sent a new one unless the LP has nothing to
+	  add and has to wait for it. <br>
+	  Values: true (1), false (0). Default: 0. */
+      AsynchronousGeneration,
       /** If true, BCP supports branching on cuts by providing potential
 	  branching candidates for the user. These are cuts that were added to
 	  the formulation at some point but became slack later in
@@ -22,11 +32,17 @@ struct BCP_lp_par{
 	  Values: true (1), false (0). Default: 0. */ 
       BranchOnCuts,
       /** If true then the LP process will check each newly received cut
-	  whether it already exists in the local cut pool or not. <br>
+	  whether it already exists in the local cut pool or not. When the
+	  cuts are received in response to an LP solution, a hash index of
+	  the cuts in the formulation and in the local cut pool is used and
+	  only cuts with equal hash values are compared (see
+	  BCP_cut_algo::hash_value()). <br>
 	  Values: true (1), false (0). Default: 1. */
       CompareNewCutsToOldOnes,
       /** If true then the LP process will check each newly arrived variable
-	  whether it already exists in the local variable pool or not. <br> 
+	  whether it already exists in the local variable pool or not. The
+	  same hash index is used as for cuts (see
+	  BCP_var_algo::hash_value()). <br> 
 	  Values: true (1), false (0). Default: 1. */
       CompareNewVarsToOldOnes,
       /** If true the BCP will attempt to do reduced cost fixing only for
@@ -37,6 +53,22 @@ struct BCP_lp_par{
 	  variable, no matter what is their current value. <br>
 	  Values: true (1), false (0). Default: 1. */
       DoReducedCostFixingAtAnything,
+      /** If true then the bounds tightened by reduced cost fixing at the
+	  root are sent to the TM which forwards them to every LP process.
+	  These bounds are valid in the whole search tree and are applied at
+	  the beginning of every search tree node. Not done when columns are
+	  generated at the root. <br>
+	  Values: true (1), false (0). Default: 0. */
+      GlobalReducedCostFixing,
+      /** What to do with cuts (vars) that were generated for an earlier LP
+	  solution of the current search tree node (this can happen only if
+	  \c AsynchronousGeneration is set or a generator timed out). If
+	  true, they are kept if they are violated (have negative reduced
+	  cost) at the current LP solution; if false, they are discarded. Cuts
+	  (vars) generated for a different search tree node are always
+	  discarded. <br>
+	  Values: true (1), false (0). Default: 1. */
+      FilterStaleGeneratorResults,
       /** Indicates whether message passing is serial (all processes are on
 	  the same processor) or not. <br>
 	  Values: true (1), false (0). Default: 1. */
@@ -54,6 +86,56 @@ struct BCP_lp_par{
 	  manager. <br>
 	  Values: true (1), false (0). Default: 0. */
       NoCompressionAtFathom,
+      /** If true then the variables and cuts deleted from the formulation
+	  because they have been ineffective for long (see
+	  IneffectiveBeforeDelete and IneffectiveColsBeforeDelete) are moved
+	  into the local var/cut pool instead of being discarded. They are
+	  priced (checked for violation) again in the next iteration and
+	  come back if they are useful, otherwise they are dropped from the
+	  pool as usual. <br>
+	  Values: true (1), false (0). Default: 0. */
+      KeepDeletedInLocalPool,
+      /** If true then the LP solver is not discarded when the processing of
+	  a search tree node is over. When the next node arrives the extra
+	  (non-core) vars/cuts it shares with the previous one (and that are
+	  in the same order) are kept in the LP solver, only the rest of the
+	  columns/rows are deleted/added and the bounds are reset. This saves
+	  reloading the whole formulation, e.g., when a sibling of the
+	  previous node is processed. The coefficients of a column/row must
+	  depend only on the var/cut and the cuts/vars it is expanded on.
+	  Used only if the core has both vars and cuts, and should not be
+	  set if BCP_lp_user::load_problem() is overridden. <br>
+	  Values: true (1), false (0). Default: 0. */
+      ReuseLpBetweenNodes,
+      /** If true then bound propagation is performed on the rows of the LP
+	  relaxation before every LP solve: the bounds of the variables are
+	  tightened using the activity bounds of the rows and infeasible
+	  nodes are pruned without solving the LP. Only rows touched by
+	  bound changes since the previous propagation are reprocessed. Used
+	  only when columns are not generated at the node, since bounds
+	  derived from the columns in the LP are not valid for the missing
+	  ones. <br>
+	  Values: true (1), false (0). Default: 0. */
+      BoundPropagation,
+      /** If true then the dual (and primal-dual) warmstart information is
+	  packed in single precision into the messages, which halves the size
+	  of the values in the messages sent to the Tree Manager. Once
+	  unpacked the values are stored in double precision again, so the
+	  memory used by the Tree Manager does not change. The basis warmstart
+	  information is always packed compactly, on 2 bits per status. <br>
+	  Values: true (1), false (0). Default: 0. */
+      WarmstartSinglePrecision,
+      /** If true then the calls to the
+	  BCP_lp_user::generate_heuristic_solution() method are throttled
+	  adaptively: at every depth of the search tree the success rate of
+	  the heuristic (the fraction of the calls that improved the upper
+	  bound) is recorded and when it is below
+	  <code>HeuristicAdaptiveMinSuccessRate</code> the heuristic is
+	  invoked only at every k-th opportunity at that depth, where k grows
+	  as the success rate falls (up to
+	  <code>HeuristicAdaptiveMaxInterval</code>). <br>
+	  Values: true (1), false (0). Default: 0. */
+      HeuristicAdaptive,
 
       UseExplicitStorage,
       Lp_DumpNodeDescCuts,
@@ -81,7 +163,8 @@ struct BCP_lp_par{
         /** Print the number of cuts sent from the LP to the cut pool.
 	    (BCP_lp_send_cuts_to_cp) */
         LpVerb_CutsToCutPoolCount,
-        /** **** This parameter is not used anywhere!!! **** */
+        /** Print the number of variables sent from the LP to the variable
+	    pool. (BCP_lp_send_vars_to_vp) */
         LpVerb_VarsToVarPoolCount,
         /** Print information related to fathoming. (BCP_lp_main_loop,
 	    BCP_lp_perform_fathom, BCP_lp_branch)
@@ -139,6 +222,10 @@ struct BCP_lp_par{
 	    by the paramter IneffectiveConstraints.
 	    (BCP_lp_adjust_row_effectiveness) */
         LpVerb_RowEffectivenessCount,
+        /** Print the number of ineffective columns in the current problem
+	    if columns are aged (see IneffectiveColsBeforeDelete).
+	    (BCP_lp_adjust_col_effectiveness) */
+        LpVerb_ColEffectivenessCount,
         /** Print detailed information on the branching candidate selected by
 	    strong branching. LpVerb_StrongBranchResult must be set fo this
 	    parameter to have an effect. (BCP_print_brobj_stat) */ 
@@ -177,6 +264,11 @@ struct BCP_lp_par{
 	  Values: \link BCP_slack_cut_discarding.<br>
 	  Default: <code>BCP_DiscardSlackCutsAtNewIteration</code> */
       SlackCutDiscardingStrategy,
+      /** The maximum number of cuts in the slack pool when the
+	  <code>SlackCutDiscardingStrategy</code> is
+	  <code>BCP_DiscardSlackCutsLeastRecentlyUsed</code>. <br>
+	  Values: positive integer. Default: 1000. */
+      SlackPoolMaxSize,
       /** A cut has to remain effective through this many iterations in the LP
 	  before it is sent to the Cut Pool process. <br>
 	  The default 1000 effectively says that only those cuts are sent to
@@ -201,6 +293,12 @@ struct BCP_lp_par{
 	  before it is marked for deletion. <br>
 	  Values: any positive number. Default: 1. */
       IneffectiveBeforeDelete,
+      /** How many times in a row a variable must be found ineffective (at
+	  its lower bound with positive reduced cost) before it is marked for
+	  deletion. Variables are aged only at search tree nodes where columns
+	  are generated, since only there can they come back. <br>
+	  Values: nonnegative integer. Default: 0 (variables are not aged). */
+      IneffectiveColsBeforeDelete,
 
       /** The number of non dual-feasible colums that can be added at a time
 	  to the formulation is a certain fraction
@@ -222,6 +320,24 @@ struct BCP_lp_par{
 	  (The other option is <code>BCP_CutViolationNorm_Distance</code>: the
 	  distance of the fractional point from the cut. */
       CutViolationNorm,
+      /** The number of threads used for computing the violations of the cuts
+	  in the local cut pool. Only large pools are split among threads.
+	  Requires pthreads support, otherwise it is ignored. <br>
+	  Values: positive integer. Default: 1. */
+      CutViolationThreadNum,
+      /** The number of threads used for running the independent separators
+	  and pricers of the user (see BCP_lp_user::separator_num() and
+	  BCP_lp_user::pricer_num()). Their results are merged in the order
+	  of the separators (pricers), so the outcome does not depend on the
+	  number of threads. Requires pthreads support, otherwise it is
+	  ignored. <br>
+	  Values: positive integer. Default: 1. */
+      GeneratorThreadNum,
+      /** The maximum number of rows (counting repetitions) processed by one
+	  round of bound propagation (see the \c BoundPropagation
+	  parameter). <br>
+	  Values: positive integer. Default: 100000. */
+      BoundPropagationMaxRowVisits,
 
       /** The maximum number of violated valid inequalities that can be added
 	  per iteration. <br>
@@ -231,6 +347,13 @@ struct BCP_lp_par{
 	  <br>
 	  Values: . Default: 100,000. */
       MaxVarsAddedPerIteration,
+      /** If positive then the local variable pool is priced partially: the
+	  pricing of the pool starts where the previous one stopped and stops
+	  as soon as this many columns with negative reduced cost are found.
+	  Only the priced columns are considered for adding to the LP. If 0
+	  then every column in the pool is priced. <br>
+	  Values: nonnegative integer. Default: 0. */
+      VarPoolPartialPricingNum,
 
       /** The maximum number of violated but not added cuts to be kept from
 	  one iteration to the next. Also see the MaxLeftoverCutFrac
@@ -250,6 +373,21 @@ struct BCP_lp_par{
 	  Values: positive integer. Default: 10. */
       DeletedRowToCompress_Min,
 
+      /** If positive then the LP relaxation is solved in chunks of at most
+	  this many iterations. Between the chunks the LP process checks
+	  whether a better upper bound has arrived and updates the dual
+	  objective limit of the LP solver accordingly, so a solve is
+	  interrupted as soon as the node can be pruned. Not used when
+	  columns are generated at the node. <br>
+	  Values: nonnegative integer. Default: 0 (no chunks). */
+      ResolveIterationChunk,
+      /** If positive and the pricing reports Lagrangian bounds (see
+	  BCP_lp_user::report_pricing_bound()) then column generation at a
+	  search tree node is stopped and the node is branched on once the
+	  Lagrangian bound has not improved (see LagrangianStallImprovement)
+	  in this many consecutive pricing rounds. <br>
+	  Values: nonnegative integer. Default: 0 (never). */
+      LagrangianStallRounds,
       /** Upper limit on the number of iterations performed in each of the
 	  children of the search tree node when presolving branching
 	  candidates. This parameter is passed onto the LP solver. If the
@@ -270,6 +408,41 @@ struct BCP_lp_par{
       StrongBranchNum,
       /** <bf>Deprecated parameter. Use StrongBranchNum</bf> */
       StrongBranch_CloseToHalfNum,
+      /** The number of threads used for presolving the branching candidates
+	  (strong branching). If larger than 1 then the LP solver is cloned
+	  for each thread and the candidates are presolved concurrently. The
+	  user methods (feasibility testing, cut generation, candidate
+	  comparison) are still invoked sequentially by the main thread.
+	  Requires pthreads support, otherwise it is ignored. <br>
+	  Values: positive integer. Default: 1. */
+      StrongBranchThreadNum,
+      /** If positive then the built-in
+	  <code>select_branching_candidates()</code> does reliability
+	  branching: the fractional integer variables are ranked by their
+	  pseudo-cost score and only those whose pseudo-costs have fewer than
+	  this many observations in either direction are presolved (at most
+	  \c StrongBranchNum of them). If the best ranked variable is reliable
+	  then it is branched on without presolving. The pseudo-costs are
+	  updated from strong branching and, if this is positive, from the
+	  final bounds of the children, which the TM forwards to every LP
+	  process. If 0 then the built-in routine uses OsiChooseStrong. <br>
+	  Values: nonnegative integer. Default: 0. */
+      PseudoCostReliability,
+      /** The results of presolving single variable branching candidates are
+	  cached (keyed by the variable and its bounds in the child) and are
+	  reused instead of presolving the same child again if they were
+	  computed in the last this many strong branching rounds. 0 disables
+	  the cache. Cached results have no LP solution, so candidates with
+	  cached children are compared by the default
+	  BCP_lp_user::compare_branching_candidates() even if it is
+	  overridden. <br>
+	  Values: nonnegative integer. Default: 0. */
+      StrongBranchCacheAge,
+      /** A cached strong branching result is reused only at search tree
+	  nodes whose level differs by at most this much from the level of
+	  the node where it was computed. <br>
+	  Values: nonnegative integer. Default: 1. */
+      StrongBranchCacheLevelDiff,
       /** Specifies the rule used for built-in branching object comparison (if
 	  the buit-in routine is used at all). <br>
 	  Values: \link BCP_branching_object_comparison.<br>
@@ -305,6 +478,27 @@ struct BCP_lp_par{
 	  Values: See \link BCP_dual_solution_description.<br>
 	  Default: <code>BCP_DualSolution_Full</code>. */
       InfoForVG,
+      /** The heuristic (BCP_lp_user::generate_heuristic_solution()) is
+	  invoked in the first and then in every
+	  <code>HeuristicFrequency</code>-th iteration at a search tree
+	  node. <br>
+	  Values: positive integer. Default: 1. */
+      HeuristicFrequency,
+      /** The heuristic is not invoked at search tree nodes deeper than this
+	  level. <br>
+	  Values: negative (no limit) or non-negative integer. Default: -1. */
+      HeuristicMaxDepth,
+      /** The number of calls at a depth of the search tree before the
+	  adaptive throttling (see <code>HeuristicAdaptive</code>) considers
+	  the success rate of the heuristic at that depth. <br>
+	  Values: positive integer. Default: 10. */
+      HeuristicAdaptiveMinCalls,
+      /** The adaptive throttling invokes the heuristic at least at every
+	  <code>HeuristicAdaptiveMaxInterval</code>-th opportunity, so that
+	  the success rate is still sampled. A value less than 1 is taken as
+	  1. <br>
+	  Values: positive integer. Default: 32. */
+      HeuristicAdaptiveMaxInterval,
       //
       end_of_int_params
    };
@@ -343,6 +537,33 @@ struct BCP_lp_par{
 	  parameter are considered to be integer. <br>
 	  Values: . Default: .*/
       IntegerTolerance,
+      /** The smoothing factor (alpha) of dual stabilization in column
+	  generation. If positive then the duals used for pricing (in the LP
+	  process and in the VG) are the convex combination of the stability
+	  center (with weight alpha) and the current LP duals. If no
+	  variable prices out with the current LP duals then the pricing is
+	  repeated with a smaller alpha, eventually with the LP duals
+	  themselves. Not used in asynchronous generation. <br>
+	  Values: [0,1). Default: 0 (no smoothing). */
+      DualSmoothingFactor,
+      /** If positive then the duals used for pricing are restricted to a
+	  box of this half-width around the stability center (box-step
+	  stabilization). The box is doubled at every mispricing and is
+	  dropped after a few of them. Also see DualSmoothingFactor. <br>
+	  Values: nonnegative. Default: 0 (no box). */
+      DualBoxStepSize,
+      /** If positive and the pricing reports Lagrangian bounds then column
+	  generation at a search tree node is stopped and the node is
+	  branched on once the gap between the LP value and the Lagrangian
+	  bound is at most this fraction of the LP value. Regardless of this
+	  parameter the node is fathomed when the Lagrangian bound exceeds
+	  the upper bound. <br>
+	  Values: nonnegative. Default: 0 (never). */
+      LagrangianGapTolerance,
+      /** The relative improvement of the Lagrangian bound that does not
+	  count as stalling. See LagrangianStallRounds. <br>
+	  Values: nonnegative. Default: 1e-4. */
+      LagrangianStallImprovement,
 
       /** This and the following three parameters control how long the LP
 	  process waits for generated cuts. The parameters specify waiting
@@ -415,6 +636,22 @@ struct BCP_lp_par{
       LaterLP_AllVarsTimeout,
       /** Maximum allowed running time */
       MaxRunTime,
+      /** The heuristic is not invoked if the relative gap between the upper
+	  bound and the LP relaxation value (the difference divided by the
+	  larger of 1 and the absolute value of the upper bound) is below
+	  this value, since little is gained by improving the upper bound
+	  then. <br>
+	  Values: non-negative number. Default: 0.0. */
+      HeuristicMinGap,
+      /** The success rate of the heuristic at a depth of the search tree
+	  below which the adaptive throttling starts to skip calls at that
+	  depth. <br>
+	  Values: number in [0,1]. Default: 0.05. */
+      HeuristicAdaptiveMinSuccessRate,
+      /** The heuristic is not invoked while the time spent in it exceeds
+	  this fraction of the CPU time of the LP process. <br>
+	  Values: number in [0,1]; 1.0 means no limit. Default: 1.0. */
+      HeuristicMaxTimeFraction,
 
       //
       end_of_dbl_params
@@ -3,6 +3,7 @@
 #ifndef _BCP_LP_POOL_H
 #define _BCP_LP_POOL_H
 
+#include "BCP_math.hpp"
 #include "BCP_error.hpp"
 #include "BCP_vector.hpp"
 #include "BCP_lp_result.hpp"
@@ -12,6 +13,30 @@
 
 //#############################################################################
 
+/** The violation kernel: the violation of the row with lower and upper
+    bounds <code>lb</code> and <code>ub</code> whose <code>len</code>
+    entries are given in <code>ind</code> and <code>val</code> at the
+    primal solution <code>x</code>. Two partial sums are kept so that the
+    compiler can overlap the gathers from <code>x</code>. */
+inline double
+BCP_row_violation(const int* ind, const double* val, const int len,
+		  const double lb, const double ub, const double* x)
+{
+   double lhs0 = 0.0;
+   double lhs1 = 0.0;
+   int j = 0;
+   for ( ; j + 1 < len; j += 2) {
+      lhs0 += val[j] * x[ind[j]];
+      lhs1 += val[j+1] * x[ind[j+1]];
+   }
+   if (j < len)
+      lhs0 += val[j] * x[ind[j]];
+   const double lhs = lhs0 + lhs1;
+   return std::max<double>(0.0, std::max<double>(lb - lhs, lhs - ub));
+}
+
+//#############################################################################
+
 class BCP_lp_waiting_row {
 private:
    BCP_lp_waiting_row(const BCP_lp_waiting_row&);
@@ -20,9 +45,12 @@ private:
    BCP_cut* _cut;
    BCP_row* _row;
    double _violation;
+   /** The position of the row in the CSR block of the cut pool, -1 if it is
+       not there. */
+   int _csr_pos;
 public:
    BCP_lp_waiting_row(BCP_cut* cut, BCP_row* row=0, double viol=-1) :
-      _cut(cut), _row(row), _violation(viol) {}
+      _cut(cut), _row(row), _violation(viol), _csr_pos(-1) {}
    ~BCP_lp_waiting_row() {
       delete _row;
       delete _cut;
@@ -34,8 +62,13 @@ public:
    inline const BCP_row* row() const { return _row; }
 
    inline void clear_cut() { _cut = 0; }
-   inline void delete_row() { delete _row;  _row = 0; _violation = -1;}
-   inline void set_row(BCP_row*& row) { _row = row; row = 0; }
+   inline void delete_row() {
+      delete _row;  _row = 0; _violation = -1; _csr_pos = -1;
+   }
+   inline void set_row(BCP_row*& row) { _row = row; row = 0; _csr_pos = -1; }
+
+   inline int csr_pos() const { return _csr_pos; }
+   inline void set_csr_pos(int pos) { _csr_pos = pos; }
 
    inline double violation() const { return _violation; }
    inline void set_violation(double v) { _violation = v; }
@@ -44,32 +77,63 @@ public:
 
 //-----------------------------------------------------------------------------
 
+/** The local cut pool of the LP process.
+
+    Besides the waiting rows the pool keeps a copy of their matrix rows in
+    one contiguous block in compressed sparse row (CSR) format so that the
+    violations can be computed in a single sweep over memory instead of
+    chasing a pointer for every row. A row is appended to the block when
+    its violation is first computed. Rows leaving the pool just leave a
+    hole, the block is rebuilt when the holes take up most of it or when
+    the rows become invalid. */
+
 class BCP_lp_cut_pool : public BCP_vec<BCP_lp_waiting_row*> {
 private:
    static bool _rows_are_valid;
    // disable the default copy constructor and assignment operator
    BCP_lp_cut_pool(const BCP_lp_cut_pool&);
    BCP_lp_cut_pool& operator=(const BCP_lp_cut_pool&);
+private:
+   /**@name The CSR block of the rows */
+   /*@{*/
+   /** The first entry of each row in the block (one more than the number
+       of rows) */
+   BCP_vec<int> _csr_start;
+   /** */
+   BCP_vec<int> _csr_ind;
+   /** */
+   BCP_vec<double> _csr_val;
+   /** The lower bounds of the rows */
+   BCP_vec<double> _csr_lb;
+   /** The upper bounds of the rows */
+   BCP_vec<double> _csr_ub;
+   /*@}*/
+
+   /** Drop the CSR block and mark every row as not being in it. */
+   void clear_csr();
+   /** Append the row of the waiting row to the CSR block. */
+   void append_to_csr(BCP_lp_waiting_row* wrow);
 public:
-   BCP_lp_cut_pool() {}
+   BCP_lp_cut_pool() : _csr_start(1, 0) {}
    ~BCP_lp_cut_pool() { 
       purge_ptr_vector(dynamic_cast< BCP_vec<BCP_lp_waiting_row*>& >(*this)); 
    }
 
    inline bool rows_are_valid() const { return _rows_are_valid; }
-   inline void rows_are_valid(bool status) { _rows_are_valid = status; }
-
-   inline void compute_violations(const BCP_lp_result& lpres,
-				  BCP_lp_cut_pool::iterator first, 
-				  BCP_lp_cut_pool::iterator last) {
-      if (! _rows_are_valid)
-	 throw BCP_fatal_error("\
-BCP_lp_cut_pool::compute_violations() : rows are not valid\n");
-      while (first != last) {
-	 (*first)->compute_violation(lpres);
-	 ++first;
-      }
+   inline void rows_are_valid(bool status) {
+      _rows_are_valid = status;
+      if (! status)
+	 clear_csr();
    }
+
+   /** Compute the violations of the waiting rows in <code>[first,last)</code>
+       using the CSR block. If <code>thread_num</code> is larger than 1 and
+       there are enough rows then the work is split among that many threads
+       (if pthreads are available). */
+   void compute_violations(const BCP_lp_result& lpres,
+			   BCP_lp_cut_pool::iterator first, 
+			   BCP_lp_cut_pool::iterator last,
+			   const int thread_num = 1);
    int remove_nonviolated(const double etol);
 };
 
@@ -83,9 +147,15 @@ private:
    BCP_var* _var;
    BCP_col* _col;
    double _red_cost;
+   /** Whether the reduced cost belongs to the current dual solution (it
+       does not if the column was skipped by partial pricing). */
+   bool _is_priced;
+   /** The position of the column in the CSC block of the var pool, -1 if it
+       is not there. */
+   int _csc_pos;
 public:
    BCP_lp_waiting_col(BCP_var* var, BCP_col* col=0, double rc=0) :
-      _var(var), _col(col), _red_cost(rc) {}
+      _var(var), _col(col), _red_cost(rc), _is_priced(true), _csc_pos(-1) {}
    ~BCP_lp_waiting_col() {
       delete _col;
       delete _var;
@@ -97,41 +167,93 @@ public:
    inline const BCP_col* col() const { return _col; }
 
    inline void clear_var() { _var = 0; }
-   inline void delete_col() { delete _col;   _col = 0; _red_cost = 0; }
-   inline void set_col(BCP_col*& col) { _col = col; col = 0; }
+   inline void delete_col() {
+      delete _col;   _col = 0; _red_cost = 0; _csc_pos = -1;
+   }
+   inline void set_col(BCP_col*& col) { _col = col; col = 0; _csc_pos = -1; }
+
+   inline int csc_pos() const { return _csc_pos; }
+   inline void set_csc_pos(int pos) { _csc_pos = pos; }
 
    inline double red_cost() const { return _red_cost; }
+   inline void set_red_cost(double rc) { _red_cost = rc; _is_priced = true; }
+   inline bool is_priced() const { return _is_priced; }
+   /** Mark the reduced cost out of date. The column then sorts behind every
+       priced one when the most negative columns are looked for. */
+   inline void set_unpriced() { _red_cost = BCP_DBL_MAX; _is_priced = false; }
    void compute_red_cost(const BCP_lp_result& lpres);
 };
 
 //-----------------------------------------------------------------------------
 
+/** The local variable pool of the LP process.
+
+    Like the local cut pool, it keeps a copy of the columns of the waiting
+    columns in one contiguous block, here in compressed sparse column (CSC)
+    format, and prices them in a single sweep. It also supports partial
+    pricing: only a window of the pool, rotating from call to call, is
+    priced until enough columns with negative reduced cost are found. */
+
 class BCP_lp_var_pool : public BCP_vec<BCP_lp_waiting_col*> {
 private:
    static bool _cols_are_valid;
    // disable the default copy constructor and assignment operator
    BCP_lp_var_pool(const BCP_lp_var_pool&);
    BCP_lp_var_pool& operator=(const BCP_lp_var_pool&);
+private:
+   /**@name The CSC block of the columns */
+   /*@{*/
+   /** The first entry of each column in the block (one more than the number
+       of columns) */
+   BCP_vec<int> _csc_start;
+   /** */
+   BCP_vec<int> _csc_ind;
+   /** */
+   BCP_vec<double> _csc_val;
+   /** The objective coefficients of the columns */
+   BCP_vec<double> _csc_obj;
+   /*@}*/
+   /** Where the next partial pricing starts */
+   int _price_start;
+
+   /** Drop the CSC block and mark every column as not being in it. */
+   void clear_csc();
+   /** Append the column of the waiting column to the CSC block. */
+   void append_to_csc(BCP_lp_waiting_col* wcol);
+   /** Make sure that the columns in <code>[first,last)</code> are in the
+       CSC block (rebuilding it if most of it is holes). */
+   void update_csc(BCP_lp_var_pool::iterator first,
+		   BCP_lp_var_pool::iterator last);
 public:
-   BCP_lp_var_pool() {}
+   BCP_lp_var_pool() : _csc_start(1, 0), _price_start(0) {}
    ~BCP_lp_var_pool() { 
       purge_ptr_vector(*(dynamic_cast<BCP_vec<BCP_lp_waiting_col*>*>(this))); 
    }
 
    inline bool cols_are_valid() const { return _cols_are_valid; }
-   inline void cols_are_valid(bool status) { _cols_are_valid = status; }
-
-   inline void compute_red_costs(const BCP_lp_result& lpres,
-				 BCP_lp_var_pool::iterator first, 
-				 BCP_lp_var_pool::iterator last) {
-      if (! _cols_are_valid)
-	 throw BCP_fatal_error("\
-BCP_lp_var_pool::compute_red_costs() : cols are not valid\n");
-      while (first != last) {
-	 (*first)->compute_red_cost(lpres);
-	 ++first;
-      }
+   inline void cols_are_valid(bool status) {
+      _cols_are_valid = status;
+      if (! status)
+	 clear_csc();
    }
+
+   /** Compute the reduced costs of the waiting columns in
+       <code>[first,last)</code> using the CSC block. */
+   void compute_red_costs(const BCP_lp_result& lpres,
+			  BCP_lp_var_pool::iterator first, 
+			  BCP_lp_var_pool::iterator last);
+   /** Partial pricing. Price the columns starting where the previous call
+       stopped (wrapping around) until at least <code>max_negative</code>
+       columns with reduced cost below <code>-detol</code> are found or the
+       whole pool is priced. The columns not priced are marked so. Return the
+       number of columns with negative reduced cost found. */
+   int compute_red_costs_partially(const BCP_lp_result& lpres,
+				   const double detol,
+				   const int max_negative);
+   /** Return the number of columns whose reduced cost is up to date. */
+   int priced_num() const;
+   /** Remove the priced columns whose reduced cost is at least
+       <code>-etol</code>. Columns skipped by partial pricing are kept. */
    int remove_positives(const double etol);
 };
 
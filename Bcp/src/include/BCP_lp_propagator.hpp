@@ -0,0 +1,103 @@
+// Copyright (C) 2000, International Business Machines
+// Corporation and others.  All Rights Reserved.
+#ifndef _BCP_LP_PROPAGATOR_H
+#define _BCP_LP_PROPAGATOR_H
+
+#include "BCP_vector.hpp"
+
+class OsiSolverInterface;
+class BCP_var;
+
+//#############################################################################
+
+/** Bound propagation on the rows of the LP relaxation of a search tree node.
+
+    The minimum and maximum activity of each row is computed from the
+    current column bounds and then used to tighten the bounds of the columns
+    in the row (rounded for integer variables). A column whose bounds change
+    puts the rows it appears in back to the queue. If the activity range of
+    a row and its bounds do not intersect, or a column ends up with an empty
+    domain, then the LP is infeasible.
+
+    The propagator is incremental: it remembers the row and column bounds it
+    has seen at the end of its previous run and in the next run it only
+    processes the rows that contain a column whose bounds have changed since
+    then or whose own bounds have changed. Whenever rows or columns are
+    added to or deleted from the LP (or a new LP is loaded)
+    <code>reset()</code> must be invoked; then the next run processes every
+    row. (If the dimensions of the LP differ from those of the snapshot then
+    the snapshot is dropped as well.) */
+
+class BCP_lp_propagator {
+private:
+    /**@name Disabled methods */
+    /*@{*/
+    /** The copy constructor is declared but not defined to disable it. */
+    BCP_lp_propagator(const BCP_lp_propagator&);
+    /** The assignment operator is declared but not defined to disable it. */
+    BCP_lp_propagator& operator=(const BCP_lp_propagator&);
+    /*@}*/
+
+private:
+    /**@name The bounds at the end of the previous run */
+    /*@{*/
+    /** */
+    BCP_vec<double> _col_lb;
+    /** */
+    BCP_vec<double> _col_ub;
+    /** */
+    BCP_vec<double> _row_lb;
+    /** */
+    BCP_vec<double> _row_ub;
+    /** Whether the snapshot above is usable at all */
+    bool _valid;
+    /*@}*/
+
+    /** The queue of the rows to be processed (and the position of its head)
+	and a flag for each row telling whether it is in the queue. */
+    BCP_vec<int> _queue;
+    /** */
+    BCP_vec<char> _in_queue;
+
+private:
+    /** Append row <code>row</code> to the queue unless it's already there */
+    inline void _enqueue(const int row) {
+	if (! _in_queue[row]) {
+	    _in_queue[row] = 1;
+	    _queue.push_back(row);
+	}
+    }
+
+public:
+    /**@name Constructor and destructor */
+    /*@{*/
+    /** */
+    BCP_lp_propagator() : _valid(false) {}
+    /** */
+    ~BCP_lp_propagator() {}
+    /*@}*/
+
+    /** Forget the snapshot of the previous run, the next run processes every
+	row. Must be invoked whenever a new LP is loaded into the solver or
+	rows or columns are added to or deleted from the LP. */
+    void reset() { _valid = false; }
+
+    /** Propagate the bounds of the LP in <code>lp</code>.
+	<code>vars</code> is used only to find out which columns are
+	integral. The columns whose bounds can be tightened are listed in
+	<code>changed_pos</code> and the new bounds are in <code>new_bd</code>
+	(lower and upper bound for each, just like in
+	BCP_lp_user::logical_fixing()). Neither the LP nor the variables are
+	modified, but the next run assumes that the changes have been applied
+	to the LP. At most <code>max_row_visits</code> rows are processed
+	(including the repeated ones) in a run.
+	@return false if the LP is found to be infeasible. In that case the
+	content of <code>changed_pos</code> and <code>new_bd</code> is
+	undefined. */
+    bool propagate(const OsiSolverInterface& lp,
+		   const BCP_vec<BCP_var*>& vars,
+		   const int max_row_visits,
+		   BCP_vec<int>& changed_pos, BCP_vec<double>& new_bd);
+};
+
+#endif
@@ -0,0 +1,100 @@
+// Copyright (C) 2000, International Business Machines
+// Corporation and others.  All Rights Reserved.
+#ifndef _BCP_LP_PSEUDOCOST_H
+#define _BCP_LP_PSEUDOCOST_H
+
+#include <map>
+
+//#############################################################################
+
+/** The pseudo-cost information collected for a single variable: the sum of
+    the per unit objective changes observed when the variable was branched
+    down / up and the number of those observations. */
+
+struct BCP_pseudocost_entry {
+    /** */
+    double down_sum;
+    /** */
+    double up_sum;
+    /** */
+    int down_num;
+    /** */
+    int up_num;
+    /** */
+    BCP_pseudocost_entry() :
+	down_sum(0.0), up_sum(0.0), down_num(0), up_num(0) {}
+};
+
+//#############################################################################
+
+/** Per variable up/down pseudo-costs in an LP process.
+
+    The entries are indexed by the <code>bcpind</code> of the variables,
+    which is the same at every search tree node, thus the information
+    collected at one node can be used at every later node the LP process
+    works on. A pseudo-cost is the average objective change per unit change
+    of the variable; variables without observations in a direction are
+    estimated by the average over all variables.
+
+    Observations come from two sources: the presolved children of single
+    variable branching candidates (strong branching) and the final lower
+    bounds of the processed children of single variable branchings, which
+    the TM forwards to every LP process (see BCP_Msg_ChildBound). */
+
+class BCP_lp_pseudocosts {
+private:
+    /**@name Disabled methods */
+    /*@{*/
+    /** The copy constructor is declared but not defined to disable it. */
+    BCP_lp_pseudocosts(const BCP_lp_pseudocosts&);
+    /** The assignment operator is declared but not defined to disable it. */
+    BCP_lp_pseudocosts& operator=(const BCP_lp_pseudocosts&);
+    /*@}*/
+
+private:
+    /** The pseudo-costs of the individual variables */
+    std::map<int, BCP_pseudocost_entry> _costs;
+    /** The sum of every down observation (for estimating unknown entries) */
+    double _down_sum;
+    /** The sum of every up observation */
+    double _up_sum;
+    /** */
+    int _down_num;
+    /** */
+    int _up_num;
+
+public:
+    /**@name Constructor and destructor */
+    /*@{*/
+    /** */
+    BCP_lp_pseudocosts() :
+	_costs(), _down_sum(0.0), _up_sum(0.0), _down_num(0), _up_num(0) {}
+    /** */
+    ~BCP_lp_pseudocosts() {}
+    /*@}*/
+
+    /**@name Query methods */
+    /*@{*/
+    /** The down pseudo-cost of the variable. */
+    double down(const int bcpind) const;
+    /** The up pseudo-cost of the variable. */
+    double up(const int bcpind) const;
+    /** The reliability of the pseudo-costs of the variable, i.e., the
+	smaller of the number of up and down observations. */
+    int reliability(const int bcpind) const;
+    /** The product score of branching on the variable when its fractional
+	part is <code>frac</code>. */
+    double score(const int bcpind, const double frac) const;
+    /*@}*/
+
+    /**@name Modifying methods */
+    /*@{*/
+    /** Record an observation: moving the variable <code>change</code>
+	units up/down changed the objective value by <code>objchange</code>.
+    */
+    void update(const int bcpind, const bool up,
+		const double change, const double objchange);
+    /*@}*/
+};
+
+#endif
@@ -143,11 +143,35 @@ public:
 	values from the LP solver. Vector members are copied out from the LP
 	solver. */
     void get_results(OsiSolverInterface& lp_solver);
+    /** Make this object a copy of <code>res</code> (the result obtained from
+	<code>lp_solver</code>) except that the dual solution is replaced by
+	<code>pi</code> and the reduced costs are recomputed from it. Used
+	to pass stabilized duals to pricing. */
+    void set_duals(const OsiSolverInterface& lp_solver,
+		   const BCP_lp_result& res, const double* pi);
     /** Set the lower bound and the exact and approximate objective values to
 	the value given in the argument. */ 
     void fake_objective_value(const double val) {
       _objval = val;
     }
+    /** Set the termination code, the iteration count and the objective value
+	without having an LP solution (e.g., when the result of presolving a
+	branching child is taken from the strong branching cache). The
+	vector members are cleared. */
+    void fake_result(const int termcode, const int iternum,
+		     const double objval) {
+      delete[] _x;
+      delete[] _pi;
+      delete[] _dj;
+      delete[] _lhs;
+      _x = 0;
+      _pi = 0;
+      _dj = 0;
+      _lhs = 0;
+      _termcode = termcode;
+      _iternum = iternum;
+      _objval = objval;
+    }
   /*@}*/
 };
 
@@ -0,0 +1,114 @@
+// Copyright (C) 2000, International Business Machines
+// Corporation and others.  All Rights Reserved.
+#ifndef _BCP_LP_SB_CACHE_H
+#define _BCP_LP_SB_CACHE_H
+
+#include <map>
+
+//#############################################################################
+
+/** Identifies a presolved child of a single variable branching candidate:
+    the <code>bcpind</code> of the variable and its bounds in the child. */
+
+struct BCP_sb_cache_key {
+    /** */
+    int bcpind;
+    /** */
+    double lb;
+    /** */
+    double ub;
+    /** */
+    BCP_sb_cache_key(const int ind, const double l, const double u) :
+	bcpind(ind), lb(l), ub(u) {}
+    /** */
+    inline bool operator<(const BCP_sb_cache_key& rhs) const {
+	if (bcpind != rhs.bcpind)
+	    return bcpind < rhs.bcpind;
+	if (lb != rhs.lb)
+	    return lb < rhs.lb;
+	return ub < rhs.ub;
+    }
+};
+
+//-----------------------------------------------------------------------------
+
+/** The outcome of presolving a child. */
+
+struct BCP_sb_cache_entry {
+    /** The objective change relative to the parent's LP relaxation */
+    double objchange;
+    /** The termination code of the presolve */
+    int termcode;
+    /** The number of iterations the presolve took */
+    int iternum;
+    /** The level of the search tree node where the child was presolved */
+    int level;
+    /** The strong branching round in which the child was presolved */
+    int round;
+};
+
+//#############################################################################
+
+/** A cache of strong branching results in an LP process.
+
+    Subsequent search tree nodes processed by the same LP process (a dive,
+    or siblings) often presolve the very same children. Their outcomes are
+    close enough to reuse for ranking the candidates as long as the nodes
+    are not too far from each other. An entry is valid for
+    <code>max_age</code> strong branching rounds (see
+    <code>new_round()</code>) and only at nodes whose level is within
+    <code>max_level_diff</code> of the level where it was computed. */
+
+class BCP_lp_sb_cache {
+private:
+    /**@name Disabled methods */
+    /*@{*/
+    /** The copy constructor is declared but not defined to disable it. */
+    BCP_lp_sb_cache(const BCP_lp_sb_cache&);
+    /** The assignment operator is declared but not defined to disable it. */
+    BCP_lp_sb_cache& operator=(const BCP_lp_sb_cache&);
+    /*@}*/
+
+private:
+    /** */
+    std::map<BCP_sb_cache_key, BCP_sb_cache_entry> _entries;
+    /** The current strong branching round */
+    int _round;
+
+public:
+    /**@name Constructor and destructor */
+    /*@{*/
+    /** */
+    BCP_lp_sb_cache() : _entries(), _round(0) {}
+    /** */
+    ~BCP_lp_sb_cache() {}
+    /*@}*/
+
+    /**@name Query methods */
+    /*@{*/
+    /** The number of cached results */
+    inline int size() const { return _entries.size(); }
+    /** Return the cached result for the child where the variable has bounds
+	<code>[lb,ub]</code> if there is a valid one at a node on
+	<code>level</code>, otherwise return 0. */
+    const BCP_sb_cache_entry* find(const int bcpind,
+				   const double lb, const double ub,
+				   const int level,
+				   const int max_level_diff) const;
+    /*@}*/
+
+    /**@name Modifying methods */
+    /*@{*/
+    /** Start a new strong branching round and drop the entries that are
+	older than <code>max_age</code> rounds. */
+    void new_round(const int max_age);
+    /** Store (or overwrite) the result of presolving a child. */
+    void insert(const int bcpind, const double lb, const double ub,
+		const int level, const int termcode, const int iternum,
+		const double objchange);
+    /** Drop every entry. */
+    inline void clear() { _entries.clear(); }
+    /*@}*/
+};
+
+#endif
@@ -0,0 +1,127 @@
+// Copyright (C) 2000, International Business Machines
+// Corporation and others.  All Rights Reserved.
+#ifndef _BCP_LP_SLACK_POOL_H
+#define _BCP_LP_SLACK_POOL_H
+
+#include "BCP_vector.hpp"
+
+class BCP_cut;
+class BCP_row;
+
+//#############################################################################
+
+/** The pool of the cuts that have become slack and were removed from the
+    formulation in the LP process.
+
+    Besides the cuts (which the user can inspect, e.g., to branch on them)
+    the pool keeps for each cut its row (if it has been expanded), the
+    violation at the last check, the number of checks it has survived
+    without being violated (its age), the search tree node where it was
+    removed from the formulation, and when it was last used. If the pool is
+    bounded and full then the least recently used cut is discarded to make
+    room for a new one.
+
+    Before new cuts are generated the LP process checks the pool against the
+    current primal solution and moves the violated cuts back into the local
+    cut pool. Only cuts removed at a node on the current dive path (i.e., at
+    the node being processed or at one of its ancestors processed by this LP
+    process right before it) are checked, cuts from elsewhere may be only
+    locally valid. */
+
+class BCP_lp_slack_pool {
+private:
+    /**@name Disabled methods */
+    /*@{*/
+    /** The copy constructor is declared but not defined to disable it. */
+    BCP_lp_slack_pool(const BCP_lp_slack_pool&);
+    /** The assignment operator is declared but not defined to disable it. */
+    BCP_lp_slack_pool& operator=(const BCP_lp_slack_pool&);
+    /*@}*/
+
+private:
+    /** The cuts */
+    BCP_vec<BCP_cut*> _cuts;
+    /**@name Data for each cut */
+    /*@{*/
+    /** The row of the cut, 0 if it is not expanded */
+    BCP_vec<BCP_row*> _rows;
+    /** The violation at the last check */
+    BCP_vec<double> _violation;
+    /** The number of checks survived */
+    BCP_vec<int> _age;
+    /** The index of the search tree node where the cut became slack */
+    BCP_vec<int> _node;
+    /** When the cut was last used (added or found violated) */
+    BCP_vec<int> _last_used;
+    /*@}*/
+    /** The clock for <code>_last_used</code>, ticks at every check */
+    int _clock;
+    /** The indices of the nodes on the current dive path */
+    BCP_vec<int> _path;
+
+private:
+    /** Remove the <code>i</code>-th entry, deleting the cut and the row if
+	<code>destroy</code> is true. The last entry takes its place. */
+    void _remove(const int i, const bool destroy);
+
+public:
+    /**@name Constructor and destructor */
+    /*@{*/
+    /** */
+    BCP_lp_slack_pool() : _clock(0) {}
+    /** The destructor deletes the cuts and their rows */
+    ~BCP_lp_slack_pool() { clear(); }
+    /*@}*/
+
+    /**@name Query methods */
+    /*@{*/
+    /** */
+    inline int size() const { return _cuts.size(); }
+    /** The cuts in the pool */
+    inline const BCP_vec<BCP_cut*>& cuts() const { return _cuts; }
+    /** */
+    inline BCP_cut* cut(const int i) { return _cuts[i]; }
+    /** */
+    inline const BCP_row* row(const int i) const { return _rows[i]; }
+    /** */
+    inline double violation(const int i) const { return _violation[i]; }
+    /** */
+    inline int age(const int i) const { return _age[i]; }
+    /** */
+    inline int node(const int i) const { return _node[i]; }
+    /** Whether the <code>i</code>-th cut became slack on the current dive
+	path, hence it is valid at the current node */
+    bool is_on_path(const int i) const;
+    /*@}*/
+
+    /**@name Modifying methods */
+    /*@{*/
+    /** Start a new search tree node. If <code>dived</code> is true then the
+	node is a child of the previous one, otherwise a new dive path
+	starts. */
+    void new_node(const int index, const bool dived);
+    /** Add a cut that became slack at node <code>node</code>. If the pool
+	already has <code>max_size</code> cuts (and <code>max_size</code> is
+	positive) then the least recently used one is discarded first. */
+    void add(BCP_cut* cut, const int node, const int max_size);
+    /** Set the row of the <code>i</code>-th cut (the pool takes over the
+	row and sets the argument to 0). */
+    void set_row(const int i, BCP_row*& row);
+    /** Delete the rows of the cuts (they must be expanded again). Must be
+	invoked whenever columns are added to or deleted from the LP. */
+    void delete_rows();
+    /** Record the violation found in a check */
+    void set_violation(const int i, const double viol, const double tol);
+    /** Advance the clock; to be invoked after every check of the pool */
+    inline void tick() { ++_clock; }
+    /** Remove the <code>i</code>-th entry without deleting its cut and row
+	and return them. The last entry takes its place. */
+    void take(const int i, BCP_cut*& cut, BCP_row*& row);
+    /** Delete the cuts (and rows) listed in <code>pos</code> */
+    void purge(const BCP_vec<int>& pos);
+    /** Delete every cut (and row) */
+    void clear();
+    /*@}*/
+};
+
+#endif
@@ -0,0 +1,103 @@
+// Copyright (C) 2000, International Business Machines
+// Corporation and others.  All Rights Reserved.
+#ifndef _BCP_LP_STABILIZER_H
+#define _BCP_LP_STABILIZER_H
+
+#include "BCP_vector.hpp"
+#include "BCP_lp_result.hpp"
+
+class OsiSolverInterface;
+
+//#############################################################################
+
+/** Dual stabilization for column generation.
+
+    Instead of the duals of the current LP relaxation, pricing is done with
+    stabilized duals: the convex combination of a stability center (weight
+    <code>alpha</code>) and the LP duals (smoothing, in the style of Wentges
+    and Neame), optionally restricted to a box around the center (box-step).
+    The center is moved to the duals used for pricing whenever pricing is
+    successful.
+
+    A variable generated for the stabilized duals is added only if it prices
+    out with the LP duals. If nothing does (a mispricing) then pricing is
+    repeated with less stabilized duals: the weight of the center is
+    decreased to <code>1-(k+1)(1-alpha)</code> after the k-th mispricing
+    and the box is doubled (and dropped after a few mispricings), until
+    eventually the LP duals themselves are used. Thus the column generation
+    terminates only if no variable prices out with the real LP duals. */
+
+class BCP_lp_dual_stabilizer {
+private:
+    /**@name Disabled methods */
+    /*@{*/
+    /** The copy constructor is declared but not defined to disable it. */
+    BCP_lp_dual_stabilizer(const BCP_lp_dual_stabilizer&);
+    /** The assignment operator is declared but not defined to disable it. */
+    BCP_lp_dual_stabilizer& operator=(const BCP_lp_dual_stabilizer&);
+    /*@}*/
+
+private:
+    /** The stability center */
+    BCP_vec<double> _center;
+    /** The LP result with the stabilized duals */
+    BCP_lp_result _result;
+    /** Whether pricing should use <code>_result</code> */
+    bool _active;
+    /** The smoothing factor and the box half-width of the current round */
+    double _alpha;
+    /** */
+    double _box;
+    /** The number of mispricings in the current round */
+    int _misprices;
+
+private:
+    /** Compute the stabilized duals for the current number of mispricings
+	and set <code>_active</code> accordingly */
+    void _stabilize(const OsiSolverInterface& lp, const BCP_lp_result& lpres);
+
+public:
+    /**@name Constructor and destructor */
+    /*@{*/
+    /** */
+    BCP_lp_dual_stabilizer() :
+	_active(false), _alpha(0.0), _box(0.0), _misprices(0) {}
+    /** */
+    ~BCP_lp_dual_stabilizer() {}
+    /*@}*/
+
+    /** Forget the stability center. Must be invoked whenever the rows of the
+	LP change. */
+    void reset() { _center.clear(); _active = false; }
+
+    /** Start pricing for the LP solution in <code>lpres</code> (the result
+	of <code>lp</code>). If there is no stability center yet (or it is
+	for a different set of rows) then the LP duals become the center and
+	are used for pricing. */
+    void start_round(const OsiSolverInterface& lp, const BCP_lp_result& lpres,
+		     const double alpha, const double box);
+
+    /** Report that nothing priced out with the LP duals. Return true if
+	pricing should be repeated with the newly computed (less stabilized)
+	duals, false if the LP duals were used already. */
+    bool misprice(const OsiSolverInterface& lp, const BCP_lp_result& lpres);
+
+    /** Finish the pricing round. If something has priced out then the
+	center is moved to the duals that were used. */
+    void end_round(const BCP_lp_result& lpres, const bool success);
+
+    /** Whether the duals used for pricing differ from the LP duals */
+    bool active() const { return _active; }
+    /** The number of mispricings in the current round */
+    int misprices() const { return _misprices; }
+    /** The smoothing factor currently in use */
+    double alpha() const;
+
+    /** The result pricing should work with: the stabilized one if
+	stabilization is active, <code>lpres</code> otherwise. */
+    const BCP_lp_result& pricing_result(const BCP_lp_result& lpres) const {
+	return _active ? _result : lpres;
+    }
+};
+
+#endif
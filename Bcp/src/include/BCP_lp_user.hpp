@@ -14,6 +14,7 @@
 
 #include "BCP_USER.hpp"
 
+#include "BCP_math.hpp"
 #include "BCP_buffer.hpp"
 #include "BCP_vector.hpp"
 #include "BCP_string.hpp"
@@ -148,6 +149,29 @@ public:
     /**@name A methods to send a solution to the Tree Manager. The user can
        invoke this method at any time to send off a solution. */
     void send_feasible_solution(const BCP_solution* sol);
+
+    /** Report the result of solving pricing subproblem
+	<code>subproblem</code> exactly, from generate_vars_in_lp() or
+	run_pricer() (in the latter use the index of the pricer). From the
+	reports of a pricing round BCP computes a Lagrangian lower bound for
+	the search tree node (see BCP_lp_lagrangian_bound) which may fathom
+	the node before the column generation converges. The bound is valid
+	only if every subproblem is reported in every round. Concurrently
+	running pricers must report on different subproblems, and from
+	run_pricer() the index must be less than pricer_num(); other reports
+	are rejected and there is no bound in that round.
+	@param subproblem   the index of the subproblem (IN)
+	@param min_rc       the smallest reduced cost of any column of the
+	                    subproblem (IN)
+	@param multiplicity an upper bound on the sum of the columns of the
+	                    subproblem in any solution, BCP_DBL_MAX if there
+			    is none (IN)
+	@param min_rc_ratio the smallest ratio of the reduced cost and the
+	                    cost of any column of the subproblem. Pass it only
+			    if every cost is positive. (IN) */
+    void report_pricing_bound(const int subproblem, const double min_rc,
+			      const double multiplicity,
+			      const double min_rc_ratio = -BCP_DBL_MAX);
     //=========================================================================
     /**@name Constructor, Destructor */
     /*@{*/
@@ -656,6 +680,67 @@ public:
 			BCP_vec<BCP_var*>& new_vars,
 			BCP_vec<BCP_col*>& new_cols);
     //-------------------------------------------------------------------------
+    /** Return the number of independent separators the user wants to run
+	in the LP process in addition to generate_cuts_in_lp() (e.g., one for
+	each family of cuts). They are run by run_separator(), concurrently
+	if the \c GeneratorThreadNum parameter is larger than 1. <br>
+	Default: 0. */
+    virtual int
+    separator_num();
+    /** Run the <code>sep</code>-th separator (0 <= <code>sep</code> <
+	separator_num()). This method may be invoked from several threads at
+	the same time (for different separators), therefore it must not
+	modify anything shared between the separators, neither in the user
+	object nor in the arguments. The rows need not be filled out; if
+	<code>new_rows</code> is left empty then the cuts are expanded with
+	cuts_to_rows() afterwards (in the main thread). <br>
+	Default: throw an exception (if this method is invoked then the user
+	must have overridden separator_num()).
+        @param sep      which separator to run (IN)
+        @param lpres    solution to the current LP relaxation (IN)
+        @param vars     the variabless currently in the relaxation (IN)
+        @param cuts     the cuts currently in the relaxation (IN)
+        @param new_cuts the vector of generated cuts (OUT)
+        @param new_rows the correspontding rows(OUT)
+    */
+    virtual void
+    run_separator(const int sep,
+		  const BCP_lp_result& lpres,
+		  const BCP_vec<BCP_var*>& vars,
+		  const BCP_vec<BCP_cut*>& cuts,
+		  BCP_vec<BCP_cut*>& new_cuts,
+		  BCP_vec<BCP_row*>& new_rows);
+    //-------------------------------------------------------------------------
+    /** Return the number of independent pricing subproblems the user wants
+	to solve in the LP process in addition to generate_vars_in_lp()
+	(e.g., one for each commodity in a multicommodity flow problem). They
+	are solved by run_pricer(), concurrently if the
+	\c GeneratorThreadNum parameter is larger than 1. <br>
+	Default: 0. */
+    virtual int
+    pricer_num();
+    /** Solve the <code>pricer</code>-th pricing subproblem (0 <=
+	<code>pricer</code> < pricer_num()). The same restrictions apply as
+	for run_separator(); if <code>new_cols</code> is left empty then the
+	variables are expanded with vars_to_cols() afterwards. <br>
+	Default: throw an exception (if this method is invoked then the user
+	must have overridden pricer_num()).
+        @param pricer        which pricing subproblem to solve (IN)
+        @param lpres         solution to the current LP relaxation (IN)
+        @param vars          the variabless currently in the relaxation (IN)
+        @param cuts          the cuts currently in the relaxation (IN)
+	@param before_fathom if true then BCP is about to fathom the node
+        @param new_vars      the vector of generated variables (OUT)
+        @param new_cols the correspontding columns(OUT) */
+    virtual void
+    run_pricer(const int pricer,
+	       const BCP_lp_result& lpres,
+	       const BCP_vec<BCP_var*>& vars,
+	       const BCP_vec<BCP_cut*>& cuts,
+	       const bool before_fathom,
+	       BCP_vec<BCP_var*>& new_vars,
+	       BCP_vec<BCP_col*>& new_cols);
+    //-------------------------------------------------------------------------
     /** Compare two generated cuts. Cuts are generated in different iterations,
         they come from the Cut Pool, etc. There is a very real possibility that
         the LP process receives several cuts that are either identical or one
@@ -810,6 +895,15 @@ public:
 			  const BCP_vec<BCP_var*>& vars,
 			  const BCP_vec<int>& select_pos,
 			  BCP_vec<BCP_lp_branching_object*>& candidates);
+    /** Select branching variables by reliability branching (see the \c
+	PseudoCostReliability parameter in BCP_lp_par) based on the
+	pseudo-costs collected in the LP process. Returns false if there is
+	no fractional integer variable (and thus no candidate was created).
+    */
+    bool
+    select_branching_candidates_by_pseudocost(const BCP_lp_result& lpres,
+				       const BCP_vec<BCP_var*>& vars,
+				       BCP_vec<BCP_lp_branching_object*>& cands);
     /*@}*/
   
     /** Decide which branching object is preferred for
@@ -825,6 +919,13 @@ public:
 
 	Default: The behavior of this method is governed by the
 	\c BranchingObjectComparison parameter in BCP_lp_par.
+
+	Note: if either candidate has children whose results were taken from
+	the strong branching cache (see the \c StrongBranchCacheAge
+	parameter) then those children have no LP solution (the
+	<code>x()</code>, <code>pi()</code>, etc. of their results are 0),
+	so such candidates are always compared by this default
+	implementation, never by an override.
     */
     virtual BCP_branching_object_relation
     compare_branching_candidates(BCP_presolved_lp_brobj* new_solved,
@@ -887,7 +988,8 @@ public:
 
 	Default: Purges the slack cut pool according to the
 	\c SlackCutDiscardingStrategy rule in BCP_lp_par (purge
-	everything before every iteration or before a new search tree node).
+	everything before every iteration or before a new search tree node,
+	or nothing if the pool discards the least recently used cuts itself).
 
 	@param slack_pool the pool of slacks. (IN)
 	@param to_be_purged the indices of the cuts to be purged. (OUT)
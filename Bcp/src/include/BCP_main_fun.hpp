@@ -20,7 +20,6 @@ BCP_process_t BCP_lp_main(BCP_message_environment* msg_env,
 			  USER_initialize* user_init,
 			  int my_id, int parent, double ub);
 
-#if 0
 BCP_process_t BCP_cp_main(BCP_message_environment* msg_env,
 			  USER_initialize* user_init,
 			  int my_id, int parent, double ub);
@@ -28,7 +27,6 @@ BCP_process_t BCP_cp_main(BCP_message_environment* msg_env,
 BCP_process_t BCP_vp_main(BCP_message_environment* msg_env,
 			  USER_initialize* user_init,
 			  int my_id, int parent, double ub);
-#endif
 
 BCP_process_t BCP_cg_main(BCP_message_environment* msg_env,
 			  USER_initialize* user_init,
@@ -46,6 +46,13 @@ public:
    inline double LowerBound() const { return _LowerBound; }
    /** Return the upper bound. */
    inline double UpperBound() const { return _UpperBound; }
+   /** Return a hash value of the column. The value does not depend on the
+       order of the entries. Unlike for rows, the column is not scaled: a
+       positive multiple of an integer column is a different variable. */
+   size_t hash_value() const;
+   /** Return whether the column is the same as <code>x</code> up to the
+       order of the entries. */
+   bool is_same(const BCP_col& x) const;
    /*@}*/
    //--------------------------------------------------------------------------
 
@@ -167,6 +174,14 @@ public:
    inline double LowerBound() const { return _LowerBound; }
    /** Return the upper bound. */
    inline double UpperBound() const { return _UpperBound; }
+   /** Return a hash value of the row. The value does not depend on the order
+       of the entries and it does not change if the coefficients and the
+       bounds are multiplied by the same positive number. */
+   size_t hash_value() const;
+   /** Return whether the row is the same as <code>x</code> up to the order of
+       the entries and up to positive scaling (as in
+       <code>hash_value()</code>). */
+   bool is_same_up_to_scaling(const BCP_row& x) const;
    /*@}*/
    //--------------------------------------------------------------------------
 
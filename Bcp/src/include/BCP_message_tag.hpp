@@ -76,6 +76,12 @@ enum BCP_message_tag{
    BCP_Msg_SomethingDied, 
    /** Any process to TM or TM to any process: a new upper bound found. */
    BCP_Msg_UpperBound,        
+   /** LP to TM: bounds on variables that are valid in the whole search
+       tree (derived by reduced cost fixing at the root). TM to LP: the
+       same bounds, forwarded to every LP process. The message contains the
+       number of variables followed by the index, lower and upper bound of
+       each. */
+   BCP_Msg_GlobalVarBounds,
    /*@}*/
 
    /**@name Messages from the Tree Manager to any slave process */
@@ -116,6 +122,13 @@ enum BCP_message_tag{
    /** Send a list of process ids the LP can use to do distributed strong
        branching */
    BCP_Msg_ProcessList,        // TM -> LP
+   /** TM forwards the final lower bound of a processed node that was
+       created by branching on a single variable to every LP process so
+       that they can update their pseudo-costs. The message contains the
+       bcpind of the branching variable, the distance it is moved in the
+       node (negative if it is branched down) and the difference between
+       the bound of the node and the objective value of its parent. */
+   BCP_Msg_ChildBound,         // TM -> LP
    /*@}*/
 
    /**@name Messages from an LP process to the Tree Manager */
@@ -197,7 +210,9 @@ enum BCP_message_tag{
    /**@name Messages from a Cut Genarator or Cut Pool process to the
       corresponding LP process */
    /*@{*/
-   /** The message contains the description of a cut. */
+   /** The message contains the description of a cut, preceded by the index
+       of the search tree node and the iteration the LP solution the cut was
+       generated for belongs to. */
    BCP_Msg_CutDescription,     // CG / CP -> LP
    /** No more (violated) cuts could be found. (Message body is empty.) */
    BCP_Msg_NoMoreCuts,         // CG / CP -> LP
@@ -206,7 +221,9 @@ enum BCP_message_tag{
    /**@name Messages from a Variable Genarator or Variable Pool process to the
       corresponding LP process */
    /*@{*/
-   /** The message contains the description of a variable. */
+   /** The message contains the description of a variable, preceded by the
+       index of the search tree node and the iteration the LP solution the
+       variable was generated for belongs to. */
    BCP_Msg_VarDescription,     // VG / VP -> LP
    /** No more (improving) variables could be found. (Message body is
        empty.) */
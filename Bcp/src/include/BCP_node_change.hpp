@@ -32,6 +32,10 @@ public:
 
     void pack(BCP_user_pack* packer, const bool def, BCP_buffer& buf) const;
     void unpack(BCP_user_pack* packer, const bool def, BCP_buffer& buf);
+
+    /** Return the memory used by the node description, including the
+	warmstart info. */
+    size_t size_in_bytes() const;
 };
 
 #endif
@@ -88,12 +88,23 @@ public:
     inline int added_num() const { return _new_objs.size(); }
 
     void update(const BCP_obj_set_change& objs_change);
+    /** Make this object the description of the explicit set
+	<code>cur</code> with respect to the explicit set <code>old</code>
+	(the set of the parent). The objects kept from <code>old</code>
+	must be in the same order in <code>cur</code> and precede the new
+	ones. <code>update()</code> applied to <code>old</code> with the
+	result gives back <code>cur</code>. */
+    void set_wrt_parent(const BCP_obj_set_change& old,
+			const BCP_obj_set_change& cur);
     void swap(BCP_obj_set_change& x);    // *INLINE ?*
 
     int pack_size() const;
     void pack(BCP_buffer& buf) const;
     void unpack(BCP_buffer& buf);
 
+    /** Return the memory (allocated capacity included) used by the object */
+    size_t size_in_bytes() const;
+
     void print() const;
 };
 
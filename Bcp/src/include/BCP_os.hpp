@@ -62,4 +62,28 @@ static inline long BCP_used_heap()
 }
 //-----------------------------------------------------------------------------
 
+/** The live total (in bytes) of the BCP data structures in this process that
+    report their own size (search tree nodes, node descriptions, vars, cuts,
+    warmstarts and user data). Unlike BCP_used_heap() this is not truncated,
+    and it counts exactly the data that could be moved to a TS process. This
+    is what the TM/TS memory balancing decisions are based on. */
+inline double& BCP_accounted_heap_ref()
+{
+  static double bytes = 0.0;
+  return bytes;
+}
+
+/** Return the number of bytes accounted so far in this process. */
+inline double BCP_accounted_heap()
+{
+  return BCP_accounted_heap_ref();
+}
+
+/** Add \c delta (which may be negative) to the accounted heap size. */
+inline void BCP_account_heap(const double delta)
+{
+  BCP_accounted_heap_ref() += delta;
+}
+//-----------------------------------------------------------------------------
+
 #endif
@@ -255,6 +255,9 @@ public:
   /*@{*/
     /** Return the buffer size needed to pack the data in the core change. */
     int pack_size() const;
+    /** Return the memory (allocated capacity included) used by the core
+	change. */
+    size_t size_in_bytes() const;
     /** Pack the core change into the buffer. */
     void pack(BCP_buffer& buf) const;
     /** Unpack the core change data from the buffer. */
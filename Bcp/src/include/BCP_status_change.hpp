@@ -0,0 +1,129 @@
+// Copyright (C) 2000, International Business Machines
+// Corporation and others.  All Rights Reserved.
+#ifndef _BCP_STATUS_CHANGE_H
+#define _BCP_STATUS_CHANGE_H
+
+// This file is fully docified.
+
+#include "BCP_enum.hpp"
+#include "BCP_vector.hpp"
+
+class BCP_buffer;
+
+//#############################################################################
+
+/** This class stores a vector of basis stati (values between 0 and 3, as in
+    CoinWarmStartBasis::Status) explicitly or relatively to another such
+    vector, in a compact form.
+
+    The stati are packed on 2 bits each, four of them in a byte. A relative
+    description lists the deleted entries of the parent vector and the
+    changed entries (after the deletion) as runs of consecutive positions
+    (a pair of the first position and the length of the run), since in a
+    basis that changed only slightly both tend to be clustered. The changed
+    values follow each other in the order of the runs, then come the new
+    entries appended to the end of the vector.
+
+    The same compact form is used in memory (e.g., in the node descriptions
+    stored in the Tree Manager) and in messages. */
+
+class BCP_status_change {
+private:
+    /** The storage type of the vector. */
+    BCP_storage_t _storage;
+    /** The number of stati in <code>_bits</code>. */
+    int _size;
+    /** Empty in case of explicit storage. Otherwise the runs of entries to
+	be deleted from the parent vector. */
+    BCP_vec<int> _del_runs;
+    /** Empty in case of explicit storage. Otherwise the runs of entries to
+	be changed in the parent vector <em>after</em> the ones to be deleted
+	are gone. */
+    BCP_vec<int> _change_runs;
+    /** The stati on 2 bits each. In case of explicit storage these are the
+	entries of the vector, otherwise the new values of the changed entries
+	followed by the new entries. */
+    BCP_vec<char> _bits;
+
+private:
+    /** Append a status to <code>_bits</code> */
+    inline void _push_back(const int st) {
+	const int shift = (_size & 3) << 1;
+	if (shift == 0)
+	    _bits.push_back(0);
+	_bits.back() |= static_cast<char>(st << shift);
+	++_size;
+    }
+    /** Replace the stati with those in <code>[first,last)</code> */
+    void _assign(const char* first, const char* last);
+
+public:
+    /**@name Constructors and destructor */
+    /*@{*/
+    /** Construct a status vector change that's empty and is of the given
+	storage (see the same constructor of BCP_vec_change). */
+    BCP_status_change(const BCP_storage_t st) : _storage(st), _size(0) {}
+    /** Construct an explicit description of the stati (one in every
+	character) in <code>[first,last)</code>. */
+    BCP_status_change(const char* first, const char* last) :
+	_storage(BCP_Storage_Explicit), _size(0) {
+	_assign(first, last);
+    }
+    /** Construct a relative description.
+	@param old_vec the original vector
+	@param new_vec the vector that should result after the change is
+	       applied to
+        @param del_pos specifies which entries are to be deleted from old_vec
+               before the change in this object can be applied.
+    */
+    BCP_status_change(const BCP_status_change& old_vec,
+		      const BCP_status_change& new_vec,
+		      const BCP_vec<int>& del_pos);
+    /** Construct the object by unpacking it from a buffer. */
+    BCP_status_change(BCP_buffer& buf) : _storage(BCP_Storage_NoData),
+					 _size(0) {
+	unpack(buf);
+    }
+    /** The destructor need not do anything. */
+    ~BCP_status_change() {}
+    /*@}*/
+
+    /**@name Query methods */
+    /*@{*/
+    /** Return the storage type of the vector */
+    inline BCP_storage_t storage() const { return _storage; }
+    /** Return the number of stati stored */
+    inline int size() const { return _size; }
+    /** Return the <code>i</code>-th stored status */
+    inline int status(const int i) const {
+	const unsigned char byte = _bits[i >> 2];
+	return (byte >> ((i & 3) << 1)) & 3;
+    }
+    /** Unpack the stati into <code>stat</code> (one in every character). It
+	is an error to invoke this method if the storage is not explicit. */
+    void explicit_vector(BCP_vec<char>& stat) const;
+    /** Return how much memory it takes to store (or pack) this info. It is
+	used when comparing which sort of storage is smaller */
+    inline int storage_size() const {
+	return (_del_runs.size() + _change_runs.size()) * sizeof(int) +
+	    _bits.size();
+    }
+    /*@}*/
+
+    /**@name Modifying methods */
+    /*@{*/
+    /** Update the current vector with the argument vector (see the same
+	method of BCP_vec_change). */
+    void update(const BCP_status_change& change);
+    /*@}*/
+
+    /**@name Packing and unpacking */
+    /*@{*/
+    /** Pack the data into a buffer. */
+    void pack(BCP_buffer& buf) const;
+    /** Unpack the data from a buffer. */
+    void unpack(BCP_buffer& buf);
+    /*@}*/
+};
+
+#endif
@@ -19,8 +19,8 @@
 #include "BCP_lp_param.hpp"
 #include "BCP_cg_param.hpp"
 #include "BCP_vg_param.hpp"
-//#include "BCP_cp_param.hpp"
-//#include "BCP_vp_param.hpp"
+#include "BCP_cp_param.hpp"
+#include "BCP_vp_param.hpp"
 #include "BCP_parameters.hpp"
 #include "BCP_tmstorage.hpp"
 
@@ -59,8 +59,10 @@ struct BCP_slave_params {
   BCP_parameter_set<BCP_ts_par> ts;
   /** */
   BCP_parameter_set<BCP_lp_par> lp;
-  //   BCP_parameter_set<BCP_cp_par> cp;
-  //   BCP_parameter_set<BCP_vp_par> vp;
+  /** */
+  BCP_parameter_set<BCP_cp_par> cp;
+  /** */
+  BCP_parameter_set<BCP_vp_par> vp;
   /** */
   BCP_parameter_set<BCP_cg_par> cg;
   /** */
@@ -184,6 +186,12 @@ public: // Data members
   /** */
   std::vector<int> ts_procs;
   std::vector<int> lp_procs;
+  /** The cut pool processes. The search tree nodes are distributed among
+      them, see <code>leaves_per_cp</code>. */
+  std::vector<int> cp_procs;
+  /** The variable pool processes. The search tree nodes are distributed
+      among them, see <code>leaves_per_vp</code>. */
+  std::vector<int> vp_procs;
   /** */
   BCP_scheduler lp_scheduler;
   /** members to measure how long it took to process the root node. Needed for
@@ -225,6 +233,10 @@ public: // Data members
   /** */
   std::map<int, int>      cuts_remote;
 
+  /** The globally valid bounds reported by the LP processes (keyed by the
+      index of the variable). */
+  std::map<int, std::pair<double, double> > global_var_bounds;
+
   /** */
   int next_cut_index_set_start;
   /** */
@@ -11,6 +11,7 @@
 #include "CoinSmartPtr.hpp"
 
 #include "BCP_math.hpp"
+#include "BCP_mempool.hpp"
 #include "BCP_vector.hpp"
 
 #include "BCP_message_tag.hpp"
@@ -57,8 +58,18 @@ public:
 
 //=============================================================================
 
+/** A node of the search tree in the TM.
+
+    Search tree nodes are allocated from a pool (see BCP_MemPool) so that
+    creating and freeing millions of them does not fragment the heap. The
+    children of a node are kept in an intrusive singly linked list
+    (first-child / next-sibling) instead of a separately allocated vector. */
+
 class BCP_tm_node : public CoinTreeNode {
 private:
+    /** The memory pool all search tree nodes are allocated from */
+    static BCP_MemPool memPool;
+
     /**@name Disabled methods */
     /*@{*/
     /** The copy constructor is declared but not defined to disable it. */
@@ -75,16 +86,19 @@ public:
     // *FIXME* break into groups 
     /*@{*/
     /** */
+    BCP_tm_node* _parent;
+    /** The first child of the node (NULL if the node is a leaf) */
+    BCP_tm_node* _first_child;
+    /** The next child of the parent of this node */
+    BCP_tm_node* _next_sibling;
+    /** */
     BCP_tm_node_status status;
     /** */
     int _index;
-    /** */
-    BCP_tm_node* _parent;
-
     /** */
     int _birth_index;
-    /** */
-    BCP_vec<BCP_tm_node*> _children;
+    /** The number of children in the list starting at \c _first_child */
+    int _child_num;
     /** */
     int lp, cg, cp, vg, vp;
     /** */
@@ -105,6 +119,18 @@ public:
     // Exactly one of the next two is always irrelevant */
     int _data_location:30;
     BCP_tm_node_data _data;
+    /** The number of bytes this node has added to the accounted heap (see
+	BCP_accounted_heap()) */
+    size_t _accounted_size;
+    /** If the node is created by branching on a single variable then the
+	bcpind of that variable, otherwise -1. Reset to -1 once the bound of
+	the processed node is forwarded to the LP processes. */
+    int _pc_bcpind;
+    /** The distance the branching variable is moved in the node (negative
+	if it is branched down) */
+    double _pc_change;
+    /** The LP objective value of the parent when it was branched on */
+    double _pc_objval;
 	
     /*@}*/
 
@@ -114,18 +140,20 @@ public:
     /** */
     BCP_tm_node(int level, BCP_node_change* desc);
 
+    /** Allocate the node from the memory pool */
+    static inline void* operator new(size_t size) {
+	return memPool.alloc(size);
+    }
+    /** Return the node to the memory pool */
+    static inline void operator delete(void* p, size_t size) {
+	memPool.free(p, size);
+    }
+
     /** */
 //     BCP_tm_node(int level, BCP_node_change* desc,
 // 		BCP_tm_node* parent, int index);
     /** */
-    ~BCP_tm_node()
-    {
-      if (_locally_stored) {
-	--num_local_nodes;
-      } else {
-	--num_remote_nodes;
-      }
-    }
+    ~BCP_tm_node();
     /*@}*/
 
     /**@name Query methods */
@@ -133,23 +161,46 @@ public:
     /** */
     inline int index() const { return _index; }
     /** */
-    inline int child_num() const { return _children.size(); }
+    inline int child_num() const { return _child_num; }
     /** */
     inline int birth_index() const { return _birth_index; }
 
     /** */
     //    inline BCP_user_data* user_data() { return _data._user; }
+    /** Return the <code>ind</code>-th child. This walks the list of
+	children, use first_child() / next_sibling() to iterate over them. */
+    inline BCP_tm_node* child(int ind) {
+	BCP_tm_node* c = _first_child;
+	while (--ind >= 0)
+	    c = c->_next_sibling;
+	return c;
+    }
     /** */
-    inline BCP_tm_node* child(int ind) { return _children[ind]; }
+    inline BCP_tm_node* first_child() { return _first_child; }
+    /** */
+    inline BCP_tm_node* next_sibling() { return _next_sibling; }
     /** */
     inline BCP_tm_node* parent() { return _parent; }
 
     /** */
     //    inline const BCP_user_data* user_data() const { return _data._user; }
     /** */
-    inline const BCP_tm_node* child(int ind) const { return _children[ind]; }
+    inline const BCP_tm_node* child(int ind) const {
+	const BCP_tm_node* c = _first_child;
+	while (--ind >= 0)
+	    c = c->_next_sibling;
+	return c;
+    }
+    /** */
+    inline const BCP_tm_node* first_child() const { return _first_child; }
+    /** */
+    inline const BCP_tm_node* next_sibling() const { return _next_sibling; }
     /** */
     inline const BCP_tm_node* parent() const { return _parent; }
+
+    /** Return the memory used by the node and its locally stored
+	description and user data. */
+    size_t size_in_bytes() const;
     /*@}*/
 
 
@@ -164,10 +215,13 @@ public:
     int mark_descendants_for_deletion();
     /** */
     void remove_child(BCP_tm_node* node);
-    /** */
-    inline void reserve_child_num(int num) { _children.reserve(num); }
-    /** */
-    inline void new_child(BCP_tm_node* node) { _children.push_back(node); }
+    /** Append <code>node</code> to the end of the list of children (so
+	that the children are listed in the order of their birth). */
+    void new_child(BCP_tm_node* node);
+    /** Bring the accounted heap size up to date with the current size of
+	the node. Must be invoked whenever the locally stored data of the node
+	changes. */
+    void update_accounted_size();
     /*@}*/
 };
 
@@ -46,6 +46,8 @@ private:
     int  _bcpind;
     /** The status of the variable. */ 
     BCP_obj_status _status;
+    /** Effectiveness counter (used only in the LP process). */
+    int _eff_cnt;
   /*@}*/
 
 protected:
@@ -70,7 +72,7 @@ public:
         other data members to the given arguments. */
     BCP_var(const BCP_var_t var_type,
 	    const double obj, const double lb, const double ub) :
-       _bcpind(0), _status(BCP_ObjNoInfo),
+       _bcpind(0), _status(BCP_ObjNoInfo), _eff_cnt(0),
        _var_type(var_type), _obj(obj), _lb(lb), _ub(ub) {}
     /** The destructor is virtual so that the appropriate destructor is invoked
         for every variable. */
@@ -91,6 +93,14 @@ public:
     inline double ub() const            { return _ub; }
     /** Return the internal index of the variable. */
     inline int bcpind() const { return _bcpind; }
+    /** Return the effectiveness count of the variable (only in LP
+	process). */
+    inline int effective_count() const { return _eff_cnt; }
+    /** Return the number of bytes the variable occupies in memory. This is
+	used for the memory accounting of the TM and TS processes.
+	Algorithmic variables holding a large amount of data should override
+	it. */
+    virtual size_t size_in_bytes() const { return sizeof(BCP_var); }
 
     /**@name Query methods about the status of the variable */
     /*@{*/
@@ -137,6 +147,20 @@ public:
       if (_ub - _lb < 1e-8)
 	_status = static_cast<BCP_obj_status>(_status | BCP_ObjInactive);
     }
+    /** Set the effectiveness count to the given value. */
+    inline void set_effective_count(const int cnt) { _eff_cnt = cnt; }
+    /** Increase the effectiveness count by 1 (or to 1 if it was negative).
+        Return the new effectiveness count. */
+    inline int increase_effective_count() {
+       _eff_cnt = _eff_cnt <= 0 ? 1 : _eff_cnt + 1;
+       return _eff_cnt;
+    }
+    /** Decrease the effectiveness count by 1 (or to -1 if it was positive).
+        Return the new effectiveness count. */
+    inline int decrease_effective_count() {
+       _eff_cnt = _eff_cnt >= 0 ? -1 : _eff_cnt - 1;
+       return _eff_cnt;
+    }
     /** Set the integrality type of the variable. */
     inline void set_var_type(const BCP_var_t type) { _var_type = type; }
     /** Set the objective coefficient. */
@@ -259,6 +283,8 @@ public:
    /*@{*/
    /** Return BCP_CoreObj indicating that the object is a core variable. */
    inline BCP_object_t obj_type() const  { return BCP_CoreObj; }
+   /** Return the memory occupied by the core variable. */
+   virtual size_t size_in_bytes() const { return sizeof(BCP_var_core); }
    /*@}*/
 };
 
@@ -304,6 +330,22 @@ public:
        algorithmic variable. */
    inline BCP_object_t obj_type() const   { return BCP_AlgoObj; }
    /*@}*/
+
+   /**@name Hashing */
+   /*@{*/
+   /** Return a hash value of the var for fast duplicate detection in the LP
+       process (see the <code>CompareNewVarsToOldOnes</code> parameter). If
+       the method returns a nonzero value then BCP_lp_user::compare_vars() is
+       invoked only for vars with the same hash value, thus vars that
+       compare_vars() may find the same (or one better than the other) must
+       have the same hash value. The default returns 0 (no hash), in which
+       case the column expanded from the var is hashed (see
+       BCP_col::hash_value()) and only vars with identical columns are
+       found; compare_vars() is not invoked. An application whose
+       compare_vars() finds other duplicates should override this
+       method. */
+   virtual size_t hash_value() const { return 0; }
+   /*@}*/
 };
 
 //#############################################################################
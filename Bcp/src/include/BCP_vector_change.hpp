@@ -218,6 +218,34 @@ trying to update a non-explicit storage with another non-explicit!\n");
       buf.unpack(st).unpack(_del_pos).unpack(_change_pos).unpack(_values);
       _storage = static_cast<BCP_storage_t>(st);
     }
+    /** Pack the data into a buffer converting the values to type \c U
+	(e.g., doubles to floats to halve the size of the values). */
+    template <class U> void pack_as(BCP_buffer& buf) const {
+      const int st = _storage;
+      buf.pack(st).pack(_del_pos).pack(_change_pos);
+      const int size = _values.size();
+      BCP_vec<U> values;
+      values.reserve(size);
+      for (int i = 0; i < size; ++i) {
+	values.unchecked_push_back(static_cast<U>(_values[i]));
+      }
+      buf.pack(values);
+    }
+    /** Unpack data packed by <code>pack_as<U>()</code> from a buffer. */
+    template <class U> void unpack_as(BCP_buffer& buf) {
+      _del_pos.clear();
+      _change_pos.clear();
+      _values.clear();
+      int st;
+      BCP_vec<U> values;
+      buf.unpack(st).unpack(_del_pos).unpack(_change_pos).unpack(values);
+      _storage = static_cast<BCP_storage_t>(st);
+      const int size = values.size();
+      _values.reserve(size);
+      for (int i = 0; i < size; ++i) {
+	_values.unchecked_push_back(static_cast<T>(values[i]));
+      }
+    }
   /*@}*/
 };
 
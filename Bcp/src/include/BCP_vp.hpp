@@ -0,0 +1,230 @@
+// Copyright (C) 2000, International Business Machines
+// Corporation and others.  All Rights Reserved.
+#ifndef _BCP_VP_H
+#define _BCP_VP_H
+
+// This file is fully docified.
+
+#include <map>
+
+#include "BCP_math.hpp"
+#include "BCP_message_tag.hpp"
+#include "BCP_vector.hpp"
+#include "BCP_buffer.hpp"
+#include "BCP_vp_param.hpp"
+#include "BCP_parameters.hpp"
+#include "BCP_process.hpp"
+
+class BCP_vp_user;
+class BCP_user_pack;
+class BCP_message_environment;
+class BCP_problem_core;
+class BCP_var;
+class BCP_cut;
+
+//#############################################################################
+
+/** A variable stored in the Variable Pool together with the statistics used
+    for deciding which variables to keep. Ages are measured in the number of
+    dual solutions the pool has priced (see BCP_vp_prob::price_round). */
+
+struct BCP_vp_var {
+   /** The variable itself */
+   BCP_var* var;
+   /** The smallest depth of the search tree nodes the variable was sent
+       from */
+   int level;
+   /** How many times the variable had negative reduced cost for a dual
+       solution priced by the pool */
+   int priced_out_count;
+   /** The pricing round when the variable last had negative reduced cost
+       (or when it entered the pool if that never happened) */
+   int last_priced_out;
+   /** */
+   BCP_vp_var(BCP_var* v, const int lvl, const int round) :
+      var(v), level(lvl), priced_out_count(0), last_priced_out(round) {}
+};
+
+//#############################################################################
+
+/**
+   This class is the central class of the Variable Pool process. Only one
+   object of this type is created and that holds all the data in the VP
+   process. A reference to that object is passed to (almost) every function
+   (or member method) that's invoked within the VP process.
+
+   The LP processes send the variables they have generated to the pool
+   (BCP_Msg_VarsToVarPool). The LP processes also send their dual solutions
+   and the pool sends back the stored variables with negative reduced cost
+   (followed by a BCP_Msg_NoMoreVars message) so that the LP processes need
+   not invoke the (usually much more expensive) pricing of the user.
+
+   To make pricing fast the coefficients of the variables in the core cuts
+   are expanded once, when the variables enter the pool, and are kept in a
+   column ordered (CSC) block. Pricing then needs only a pass over this block
+   with the core part of the dual solution; the user is asked to account for
+   the algorithmic cuts only if any of them has a nonzero dual value.
+*/
+
+class BCP_vp_prob : public BCP_process {
+private:
+   /**@name Disabled members */
+   /*@{*/
+   /** The copy constructor is declared but not defined to disable it. */
+   BCP_vp_prob(const BCP_vp_prob&);
+   /** The assignment operator is declared but not defined to disable it. */
+   BCP_vp_prob& operator=(const BCP_vp_prob&);
+   /*@}*/
+
+public:
+   /**@name Data members */
+   /*@{*/
+
+   // User provided members ---------------------------------------------------
+   /** The user object holding the user's data. This object
+       is created by a call to the appropriate member of
+       \URL[<code>USER_initialize</code>]{USER_initialize.html}. */
+   BCP_vp_user* user;
+
+   /** A class that holds the methods about how to pack things. */
+   BCP_user_pack* packer;
+
+   /** The message passing environment. This object
+       is created by a call to the appropriate member of
+       \URL[<code>USER_initialize</code>]{USER_initialize.html}. */
+   BCP_message_environment* msg_env;
+
+   /** The message buffer of the Variable Pool process. */
+   BCP_buffer  msg_buf;
+
+   /** The parameters controlling the Variable Pool process. */
+   BCP_parameter_set<BCP_vp_par> par;
+
+   /** The description of the core of the problem. */
+   BCP_problem_core* core;
+
+   /** The best currently known upper bound. */
+   double upper_bound;
+
+   // the pool itself
+   /** The variables in the pool. */
+   BCP_vec<BCP_vp_var*> vars;
+   /** Maps the (absolute value of the) internal index of a variable to its
+       position in <code>vars</code>. Used to recognize variables that arrive
+       to the pool again. */
+   std::map<int, int> var_position;
+   /** The number of dual solutions priced so far. */
+   int price_round;
+   /** The position in <code>vars</code> where the next partial pricing
+       scan starts. */
+   int price_start;
+
+   /**@name The core part of the columns of the variables in the pool in
+      column ordered format. The i-th column belongs to
+      <code>vars[i]</code>; the row indices are positions of the core cuts. */
+   /*@{*/
+   /** */
+   BCP_vec<int> csc_start;
+   /** */
+   BCP_vec<int> csc_ind;
+   /** */
+   BCP_vec<double> csc_val;
+   /** */
+   BCP_vec<double> csc_obj;
+   /*@}*/
+
+   // the dual solution, its sender and at which node in which iteration the
+   // dual solution was generated.
+   /** The cuts of the dual solution the variables are priced against. Not
+       all cuts need to be listed (e.g., list only those that have nonzero
+       dual values in the current LP solution).
+       \sa BCP_lp_user::pack_dual_solution()
+   */
+   BCP_vec<BCP_cut*> cuts;
+   /** The dual values corresponding to the cuts above. */
+   BCP_vec<double>   pi;
+   /** The process id of the LP process that sent the solution. */
+   int sender;
+
+   /** The phase the algorithm is in. */
+   int phase;
+   /** The level of search tree node where the solution was generated. */
+   int node_level;
+   /** The index of search tree node where the solution was generated. */
+   int node_index;
+   /** The iteration within the search tree node where the solution was
+       generated. */
+   int node_iteration;
+
+   /*@}*/
+
+public:
+   /**@name Constructor and destructor */
+   /*@{*/
+   /** The default constructor. Initializes every data member to a natural
+       state. */
+   BCP_vp_prob(int my_id, int parent);
+   /** The destructor deletes everything. */
+   virtual ~BCP_vp_prob();
+   /*@}*/
+
+   /**@name Query methods */
+   /*@{*/
+   /** Return true/false indicating whether any upper bound has been found. */
+   inline bool has_ub() const { return upper_bound < BCP_DBL_MAX / 10; }
+   /** Return the current upper bound (<code>BCP_DBL_MAX</code> if there's no
+       upper bound found yet.) */
+   inline double ub() const   { return upper_bound; }
+   /*@}*/
+
+   /**@name Modifying methods */
+   /*@{*/
+   /** Set the upper bound equal to the argument. */
+   inline void ub(const double bd) { upper_bound = bd; }
+   /*@}*/
+
+   /**@name Pool management */
+   /*@{*/
+   /** Unpack the variables in a BCP_Msg_VarsToVarPool message and add
+       those to the pool that are not there yet. Return the number of new
+       variables. */
+   int unpack_vars_to_pool();
+   /** Price the variables in the pool against the dual solution in
+       <code>cuts</code> and <code>pi</code>, update the statistics of the
+       variables and send the ones with negative reduced cost to the sender of
+       the solution. Return the number of variables sent. */
+   int price_vars();
+   /** Delete the variables that have not priced out for too long, then, if
+       the pool is still too large, the ones that priced out the longest
+       time ago. */
+   void purge_pool();
+   /*@}*/
+
+   /**@name Packing and unpacking */
+   /*@{*/
+   /** Unpack a variable sent by an LP process. */
+   BCP_var* unpack_var();
+   /** Unpack a cut. Invoked from the built-in
+       BCP_vp_user::unpack_dual_solution(). */
+   BCP_cut* unpack_cut();
+   /** Pack a variable into the message buffer the same way the LP process
+       does (i.e., so that BCP_lp_prob::unpack_var() can unpack it). */
+   void pack_var(const BCP_var& var);
+   /*@}*/
+   //--------------------------------------------------------------------------
+   virtual BCP_buffer& get_message_buffer() { return msg_buf; }
+   virtual void process_message();
+
+private:
+   /** Append the core part of the column of <code>var</code> to the CSC
+       block. */
+   void append_to_csc(const BCP_var& var);
+   /** Rebuild the CSC block after variables were deleted from the pool. */
+   void rebuild_csc(const BCP_vec<int>& kept);
+};
+
+// This function is used only internally.
+bool
+BCP_vp_process_message(BCP_vp_prob& p, BCP_buffer& buf);
+
+#endif
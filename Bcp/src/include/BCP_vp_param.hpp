@@ -0,0 +1,114 @@
+// Copyright (C) 2000, International Business Machines
+// Corporation and others.  All Rights Reserved.
+#ifndef _BCP_VP_PARAM_H
+#define _BCP_VP_PARAM_H
+
+// This file is fully docified.
+
+/** Parameters used in the Variable Pool process. These parameters can be set
+    in the original parameter file by including the following line: <br>
+    <code>BCP_{parameter name}  {parameter value}</code>. */
+
+struct BCP_vp_par{
+   /** Character parameters. All of these variables are used as booleans
+       (true = 1, false = 0). */
+   enum chr_params{
+      /** Indicates whether message passing is serial (all processes are on
+	  the same processor) or not. <br>
+	  Values: true (1), false (0). Default: 1. */
+      MessagePassingIsSerial,
+      /** Print out a message when the default version of an overridable
+	  method is executed. Default: 1. */
+      ReportWhenDefaultIsExecuted,
+      /** If true then only those columns are priced for a dual solution
+	  that were sent to the pool from a search tree node at the same or at
+	  a smaller depth than the node where the dual solution was generated
+	  (columns found deeper in the tree are less likely to be useful
+	  higher up). <br>
+	  Values: true (1), false (0). Default: 0. */
+      VarPoolCheckOnlyShallowerVars,
+      /** Just a marker for the first VpVerb */
+      VpVerb_First,
+      /** Print the number of variables received from an LP process and the
+	  number of variables sent back for a dual solution.
+	  (BCP_vp_prob::process_message) */
+      VpVerb_VarsReceivedAndSent,
+      /** Print the size of the pool after variables are purged from it.
+	  (BCP_vp_prob::purge_pool) */
+      VpVerb_PoolPurge,
+      /** Just a marker for the last VpVerb */
+      VpVerb_Last,
+      //
+      end_of_chr_params
+   };
+
+   /** Integer parameters. */
+   enum int_params{
+      /** The "nice" level the process should run at. On Linux and on AIX this
+	  value should be between -20 and 20. The higher this value the less
+	  resource the process will receive from the system. Note that
+	  <ol>
+	    <li> The process starts with 0 priority and it can only be
+	         increased.
+	    <li> If the load is low on the machine (e.g., when all other
+	         processes are interactive like netscape or text editors) then
+		 even with 20 priority the process will use close to 100% of
+		 the cpu, and the interactive processes will be noticably more
+		 responsive than they would be if this process ran with 0
+		 priority.
+	  </ol>
+	  @see the man page of the <code>setpriority</code> system function.
+      */
+      NiceLevel,
+      /** The maximum number of variables kept in the pool. When the pool
+	  grows larger than this then the variables that have not priced out
+	  for the longest time are deleted. Default: 10000. */
+      VarPoolMaxSize,
+      /** A variable is deleted from the pool if it did not have negative
+	  reduced cost for any of the last this many dual solutions the pool
+	  has priced. Default: 1000. */
+      VarPoolMaxAge,
+      /** The maximum number of variables sent back to an LP process for one
+	  dual solution. The ones with the most negative reduced costs are
+	  sent. 0 means no limit. Default: 0. */
+      VarPoolMaxVarsToSend,
+      /** Partial pricing: the pool is scanned cyclically, starting where
+	  the previous scan stopped, and the scan stops as soon as this many
+	  variables with negative reduced cost are found. 0 means that every
+	  variable is priced. (This is the VP counterpart of the LP parameter
+	  \c VarPoolPartialPricingNum.) Default: 0. */
+      VpPartialPricingNum,
+      //
+      end_of_int_params
+   };
+
+   /** Double parameters. */
+   enum dbl_params{
+      /** A variable prices out if its reduced cost is less than the negative
+	  of this value. Default: 1e-6. */
+      VarPoolRedCostTolerance,
+      //
+      end_of_dbl_params
+   };
+
+   /** String parameters. */
+   enum str_params{
+      /** The file where the output from this process should be logged. To
+	  distinguish the output of this VP process from that of the others,
+	  the string "-vp-<process_id>" is appended to the given logfile name
+	  to form the real filename. */
+      LogFileName,
+      //
+      end_of_str_params
+   };
+
+   /** There are no string array parameters. */
+   enum str_array_params{
+      str_array_dummy,
+      //
+      end_of_str_array_params
+   };
+
+};
+
+#endif
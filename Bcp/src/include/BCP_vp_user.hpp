@@ -0,0 +1,160 @@
+// Copyright (C) 2000, International Business Machines
+// Corporation and others.  All Rights Reserved.
+#ifndef _BCP_VP_USER_H
+#define _BCP_VP_USER_H
+
+// This file is fully docified.
+
+#include "BCP_math.hpp"
+#include "BCP_vector.hpp"
+#include "BCP_vp_param.hpp"
+#include "BCP_string.hpp"
+#include "BCP_USER.hpp"
+
+class BCP_vp_prob;
+class BCP_buffer;
+class BCP_var;
+class BCP_cut;
+
+/**
+   The BCP_vp_user class is the base class from which the user
+   can derive a problem specific class to be used in the Variable Pool
+   process.
+
+   In that derived class the user can store data to be used in the methods she
+   overrides. Also that is the object the user must return in the
+   USER_initialize::vp_init() method.
+
+   There are two kind of methods in the class. The non-virtual methods are
+   helper functions for the built-in defaults, but the user can use them as
+   well. The virtual methods execute steps in the BCP algorithm where the user
+   might want to override the default behavior.
+
+   The default implementations fall into three major categories.
+   <ul>
+     <li> Empty; doesn't do anything and immediately returns (e.g.,
+          unpack_module_data()).
+     <li> There is no reasonable default, so throw an exception. This
+          happens with expand_var_on_core() and adjust_red_costs(): the pool
+	  stores only algorithmic variables and only the user knows their
+	  coefficients.
+     <li> A default is given. Frequently there are multiple defaults and
+          parameters govern which one is selected (e.g.,
+	  unpack_dual_solution()).
+   </ul>
+*/
+
+class BCP_vp_user : public BCP_user_class {
+private:
+  BCP_vp_prob * p;
+public:
+  /**@name Methods to set and get the pointer to the BCP_vp_prob
+     object. It is unlikely that the users would want to muck around with
+     these (especially with the set method!) but they are here to provide
+     total control.
+  */
+  /*@{*/
+    /// Set the pointer
+    void setVpProblemPointer(BCP_vp_prob * ptr) { p = ptr; }
+    /// Get the pointer
+    BCP_vp_prob * getVpProblemPointer() { return p; }
+  /*@}*/
+
+  /**@name Informational methods for the user. */
+  /*@{*/
+    /** Return what is the best known upper bound (might be BCP_DBL_MAX) */
+    double upper_bound() const;
+    /** Return the phase the algorithm is in */
+    int current_phase() const;
+    /** Return the level of the search tree node for which variables are
+        being priced */
+    int current_level() const;
+    /** Return the internal index of the search tree node for which variables
+	are being priced */
+    int current_index() const;
+    /** Return the iteration count within the search tree node for which
+	variables are being priced */
+    int current_iteration() const;
+  /*@}*/
+
+  /**@name Methods to get/set BCP parameters on the fly */
+  /*@{*/
+    ///
+    char              get_param(const BCP_vp_par::chr_params key) const;
+    ///
+    int               get_param(const BCP_vp_par::int_params key) const;
+    ///
+    double            get_param(const BCP_vp_par::dbl_params key) const;
+    ///
+    const BCP_string& get_param(const BCP_vp_par::str_params key) const;
+
+    ///
+    void set_param(const BCP_vp_par::chr_params key, const bool val);
+    ///
+    void set_param(const BCP_vp_par::chr_params key, const char val);
+    ///
+    void set_param(const BCP_vp_par::int_params key, const int val);
+    ///
+    void set_param(const BCP_vp_par::dbl_params key, const double val);
+    ///
+    void set_param(const BCP_vp_par::str_params key, const char * val);
+  /*@}*/
+
+  //===========================================================================
+  /**@name Constructor, Destructor */
+  /*@{*/
+    BCP_vp_user() : p(0) {}
+    /** Being virtual, the destructor invokes the destructor for the real type
+	of the object being deleted. */
+    virtual ~BCP_vp_user() {}
+  /*@}*/
+
+  //===========================================================================
+  // Here are the user defined functions. For each of them a default is given
+  // which can be overridden when the concrete user class is defined.
+  //===========================================================================
+  /** Unpack the initial information sent to the Variable Pool process by
+      the Tree Manager. This information was packed by the method
+      BCP_tm_user::pack_module_data() invoked with \c BCP_ProcessType_VP as
+      the third (target process type) argument. <br>
+      Default: empty method. */
+  virtual void
+  unpack_module_data(BCP_buffer & buf);
+
+  //---------------------------------------------------------------------------
+  /** Unpack the LP solution arriving from the LP process. This method is
+      invoked only if the user packs the info necessary for variable
+      generation by herself, i.e., she overrides the
+      BCP_lp_user::pack_dual_solution(). If that's the case the user has to
+      unpack the same info she has packed in the LP process. */
+  virtual void
+  unpack_dual_solution(BCP_buffer& buf);
+
+  //---------------------------------------------------------------------------
+  /** Return the coefficients of <code>var</code> in the core cuts. The
+      indices placed into <code>ind</code> are positions of the cuts in the
+      core (i.e., in BCP_problem_core::cuts), the coefficients go into
+      <code>val</code>. Both vectors are empty upon invocation. This method
+      is invoked only once for every variable, when it enters the pool. <br>
+      Default: throw an exception. */
+  virtual void
+  expand_var_on_core(const BCP_var& var,
+		     BCP_vec<int>& ind, BCP_vec<double>& val);
+
+  //---------------------------------------------------------------------------
+  /** Account for the algorithmic cuts in the reduced costs of
+      <code>vars</code>. Upon invocation <code>red_costs[i]</code> holds the
+      reduced cost of the i-th variable with respect to the core cuts only;
+      the method must subtract the contribution of <code>cuts</code> (the
+      algorithmic cuts with nonzero dual values in the solution being priced)
+      and <code>pi</code> (their dual values). The method is not invoked if
+      there are no such cuts. <br>
+      Default: throw an exception. */
+  virtual void
+  adjust_red_costs(const BCP_vec<BCP_var*>& vars,
+		   const BCP_vec<BCP_cut*>& cuts,
+		   const BCP_vec<double>& pi,
+		   BCP_vec<double>& red_costs);
+};
+
+#endif
@@ -70,6 +70,11 @@ public:
    /** Return how much memory it'll take to pack this warmstart info. It is
        used when comparing which sort of storage is smaller. */
    virtual int storage_size() const = 0;
+
+   /** Return how much memory the warmstart info occupies. It is used for the
+       memory accounting of the TM and TS processes. The default returns the
+       packed size. */
+   virtual size_t size_in_bytes() const { return storage_size(); }
 };
 
 #endif
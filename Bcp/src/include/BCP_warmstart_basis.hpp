@@ -4,7 +4,7 @@
 #define _BCP_WARMSTART_BASIS_H
 
 #include "BCP_warmstart.hpp"
-#include "BCP_vector_change.hpp"
+#include "BCP_status_change.hpp"
 
 /* NOTE:
    Doxygen gracefully generates description for all inherited methods if they
@@ -17,7 +17,9 @@
 /** This class describes a warmstart information that consists of basis
     information for structural and artificial variables.
 
-    "basic / on_upper / on_lower" info is stored on 2 bits for every variable.
+    "basic / on_upper / on_lower" info is stored on 2 bits for every variable
+    (see BCP_status_change), both in memory and in messages, and a change
+    wrt the parent's basis is stored as runs of changed positions.
     Only the added methods are documented in details on this page, for the
     inherited methods see the description of the base class. */
 
@@ -34,9 +36,9 @@ private:
 
 private:
   /** The stati of the variables stored as a vector change. */
-  BCP_vec_change<char> _var_stat;
+  BCP_status_change _var_stat;
   /** The stati of the cuts stored as a vector change. */
-  BCP_vec_change<char> _cut_stat;
+  BCP_status_change _cut_stat;
 
 public:
   /**@name Constructors and destructor */
@@ -46,7 +48,8 @@ public:
     /** Create an explicitly stored warmstart info by considering the two
 	character arrays (<code>[vfirst,vlast)</code> and
 	<code>[cfirst,clast)</code>) as the status arrays for the
-	variables/cuts */
+	variables/cuts. Every character holds one status (a
+	CoinWarmStartBasis::Status value). */
     BCP_warmstart_basis(const char* vfirst, const char* vlast,
 			const char* cfirst, const char* clast) :
        _var_stat(vfirst, vlast), _cut_stat(cfirst, clast) {}
@@ -80,6 +83,10 @@ public:
     return _var_stat.storage_size() + _cut_stat.storage_size();
   }
 
+  virtual size_t size_in_bytes() const {
+    return sizeof(BCP_warmstart_basis) + storage_size();
+  }
+
   virtual void update(const BCP_warmstart* const change);
 
   virtual BCP_warmstart* as_change(const BCP_warmstart* const old_ws,
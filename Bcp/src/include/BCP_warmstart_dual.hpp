@@ -22,27 +22,40 @@ private:
   /** The assignment operator is declared but not defined to disable it. */
   BCP_warmstart_dual& operator=(const BCP_warmstart_dual&);
 
-  /** The default constructor creates an empty WrtParent warmstart info (i.e.,
-      no change wrt the parent). This is a private method since only the
+  /** This constructor creates an empty WrtParent warmstart info (i.e., no
+      change wrt the parent). This is a private method since only the
       empty_wrt_this() method should be able to use this form of creation. */
-  BCP_warmstart_dual() : _dual(BCP_Storage_WrtParent) {}
+  BCP_warmstart_dual(const bool single_precision) :
+    _dual(BCP_Storage_WrtParent), _single_precision(single_precision) {}
 
 private:
   /** The dual vector stored as a vector change. */
   BCP_vec_change<double> _dual;
+  /** Whether the values are packed in single precision */
+  bool _single_precision;
    /*@}*/
 
 public:
   /**@name Constructors and destructor */
   /*@{*/
     /** Create the object by unpacking it from a buffer */
-    BCP_warmstart_dual(BCP_buffer& buf) : _dual(buf) {}
+    BCP_warmstart_dual(BCP_buffer& buf) : _dual(BCP_Storage_NoData) {
+      buf.unpack(_single_precision);
+      if (_single_precision)
+	_dual.unpack_as<float>(buf);
+      else
+	_dual.unpack(buf);
+    }
     /** Create an explicitly stored warmstart info by considering the double
-	array <code>[first,last)</code> as the dual vector. */
-    BCP_warmstart_dual(const double* first, const double* last) :
-       _dual(first, last) {}
+	array <code>[first,last)</code> as the dual vector. If
+	<code>single_precision</code> is true then the values are packed as
+	floats into the messages. */
+    BCP_warmstart_dual(const double* first, const double* last,
+		       const bool single_precision = false) :
+       _dual(first, last), _single_precision(single_precision) {}
     /** Copy constructor */
-    BCP_warmstart_dual(const BCP_warmstart_dual& ws) : _dual(ws._dual) {}
+    BCP_warmstart_dual(const BCP_warmstart_dual& ws) :
+       _dual(ws._dual), _single_precision(ws._single_precision) {}
 
     virtual ~BCP_warmstart_dual() {}
   /*@}*/
@@ -62,13 +75,17 @@ public:
   virtual BCP_warmstart* empty_wrt_this() const {
     // The default constructor creates an empty WrtParent warmstart info
     // (i.e., no change wrt the parent)
-    return new BCP_warmstart_dual();
+    return new BCP_warmstart_dual(_single_precision);
   }
 
   virtual int storage_size() const {
     return _dual.storage_size();
   }
 
+  virtual size_t size_in_bytes() const {
+    return sizeof(BCP_warmstart_dual) + storage_size();
+  }
+
   virtual void update(const BCP_warmstart* const change);
 
   virtual BCP_warmstart* as_change(const BCP_warmstart* const old_ws,
@@ -81,7 +98,11 @@ public:
 
   /** Pack the warmstart info into a buffer. */
   void pack(BCP_buffer& buf) const {
-    _dual.pack(buf);
+    buf.pack(_single_precision);
+    if (_single_precision)
+      _dual.pack_as<float>(buf);
+    else
+      _dual.pack(buf);
   }
 };
 
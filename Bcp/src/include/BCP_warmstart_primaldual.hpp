@@ -23,33 +23,50 @@ private:
   /** The assignment operator is declared but not defined to disable it. */
   BCP_warmstart_primaldual& operator=(const BCP_warmstart_primaldual&);
 
-  /** The default constructor creates an empty WrtParent warmstart info (i.e.,
-      no change wrt the parent). This is a private method since only the
+  /** This constructor creates an empty WrtParent warmstart info (i.e., no
+      change wrt the parent). This is a private method since only the
       empty_wrt_this() method should be able to use this form of creation. */
-  BCP_warmstart_primaldual() :
-      _primal(BCP_Storage_WrtParent), _dual(BCP_Storage_WrtParent) {}
+  BCP_warmstart_primaldual(const bool single_precision) :
+      _primal(BCP_Storage_WrtParent), _dual(BCP_Storage_WrtParent),
+      _single_precision(single_precision) {}
 
 private:
   /** The primal vector stored as a vector change. */
   BCP_vec_change<double> _primal;
   /** The dual vector stored as a vector change. */
   BCP_vec_change<double> _dual;
+  /** Whether the values are packed in single precision */
+  bool _single_precision;
    /*@}*/
 
 public:
   /**@name Constructors and destructor */
   /*@{*/
     /** Create the object by unpacking it from a buffer */
-    BCP_warmstart_primaldual(BCP_buffer& buf) : _primal(buf), _dual(buf) {}
+    BCP_warmstart_primaldual(BCP_buffer& buf) :
+	_primal(BCP_Storage_NoData), _dual(BCP_Storage_NoData) {
+	buf.unpack(_single_precision);
+	if (_single_precision) {
+	    _primal.unpack_as<float>(buf);
+	    _dual.unpack_as<float>(buf);
+	} else {
+	    _primal.unpack(buf);
+	    _dual.unpack(buf);
+	}
+    }
     /** Create an explicitly stored warmstart info by considering the double
 	arrays <code>[fpirst,plast)</code> and <code>[dpirst,dlast)</code> as
-	the primal and dual vectors. */
+	the primal and dual vectors. If <code>single_precision</code> is true
+	then the values are packed as floats into the messages. */
     BCP_warmstart_primaldual(const double* pfirst, const double* plast,
-			     const double* dfirst, const double* dlast) :
-	_primal(pfirst, plast), _dual(dfirst, dlast) {}
+			     const double* dfirst, const double* dlast,
+			     const bool single_precision = false) :
+	_primal(pfirst, plast), _dual(dfirst, dlast),
+	_single_precision(single_precision) {}
     /** Copy constructor */
     BCP_warmstart_primaldual(const BCP_warmstart_primaldual& ws) :
-	_primal(ws._primal), _dual(ws._dual) {}
+	_primal(ws._primal), _dual(ws._dual),
+	_single_precision(ws._single_precision) {}
 
     virtual ~BCP_warmstart_primaldual() {}
   /*@}*/
@@ -86,13 +103,17 @@ public:
   virtual BCP_warmstart* empty_wrt_this() const {
     // The default constructor creates an empty WrtParent warmstart info
     // (i.e., no change wrt the parent)
-    return new BCP_warmstart_primaldual();
+    return new BCP_warmstart_primaldual(_single_precision);
   }
 
   virtual int storage_size() const {
     return _primal.storage_size() + _dual.storage_size();
   }
 
+  virtual size_t size_in_bytes() const {
+    return sizeof(BCP_warmstart_primaldual) + storage_size();
+  }
+
   virtual void update(const BCP_warmstart* const change);
 
   virtual BCP_warmstart* as_change(const BCP_warmstart* const old_ws,
@@ -105,8 +126,14 @@ public:
 
   /** Pack the warmstart info into a buffer. */
   void pack(BCP_buffer& buf) const {
-      _primal.pack(buf);
-      _dual.pack(buf);
+      buf.pack(_single_precision);
+      if (_single_precision) {
+	  _primal.pack_as<float>(buf);
+	  _dual.pack_as<float>(buf);
+      } else {
+	  _primal.pack(buf);
+	  _dual.pack(buf);
+      }
   }
 };
 
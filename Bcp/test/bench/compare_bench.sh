@@ -0,0 +1,116 @@
+#! /bin/sh
+
+# Copyright (C) 2006, International Business Machines
+# Corporation and others.  All Rights Reserved.
+
+# Compare the result file of run_bench.sh against a baseline result file.
+#
+# The runs of an instance in an environment are averaged, then every figure
+# is compared with the baseline. A figure that got worse by more than the
+# threshold is reported as REGRESSION, one that improved by as much is
+# reported as IMPROVED. The exit status is 1 if there is any regression (or
+# if an instance that succeeded in the baseline fails now).
+#
+# The thresholds can be overridden in the environment:
+#   BENCH_TIME_REL (0.10) and BENCH_TIME_ABS (0.5 seconds) for the time,
+#   BENCH_RSS_REL (0.10) for the peak memory,
+#   BENCH_COUNT_REL (0.05) for the number of nodes and LP iterations,
+#   BENCH_GAP_ABS (0.01 percentage points) for the final gap.
+#
+# Usage: compare_bench.sh baseline results
+#        compare_bench.sh --save results baseline   (store a new baseline)
+
+if test "x$1" = "x--save"; then
+    test $# -eq 3 || { echo "usage: $0 --save results baseline" 1>&2; exit 2; }
+    cp "$2" "$3" && echo "Baseline $3 updated from $2"
+    exit $?
+fi
+
+if test $# -ne 2; then
+    echo "usage: $0 baseline results" 1>&2
+    echo "       $0 --save results baseline" 1>&2
+    exit 2
+fi
+for f in "$1" "$2"; do
+    test -r "$f" || { echo "$0: can not read $f" 1>&2; exit 2; }
+done
+
+awk -F'\t' \
+    -v time_rel=${BENCH_TIME_REL:-0.10} -v time_abs=${BENCH_TIME_ABS:-0.5} \
+    -v rss_rel=${BENCH_RSS_REL:-0.10} -v count_rel=${BENCH_COUNT_REL:-0.05} \
+    -v gap_abs=${BENCH_GAP_ABS:-0.01} '
+# Accumulate a column of file f for key k, skipping the missing values
+function acc(f, k, col, val) {
+    if (val == "NA" || val == "")
+	return;
+    sum[f, k, col] += val;
+    cnt[f, k, col]++;
+}
+function avg(f, k, col) {
+    return cnt[f, k, col] > 0 ? sum[f, k, col] / cnt[f, k, col] : "NA";
+}
+# Compare the averages of a column; worse means larger
+function cmp(k, col, name, rel, abs,    b, r, lim) {
+    b = avg(1, k, col);
+    r = avg(2, k, col);
+    if (b == "NA" || r == "NA")
+	return;
+    lim = b * rel + abs;
+    verdict = "ok";
+    if (r > b + lim) {
+	verdict = "REGRESSION";
+	regressions++;
+    } else if (r < b - lim) {
+	verdict = "IMPROVED";
+    }
+    printf("%-10s %-7s %-14s %14.3f %14.3f   %s\n",
+	   inst[k], env[k], name, b, r, verdict);
+}
+FNR == 1 { ++file; next }
+{
+    k = $1 SUBSEP $2;
+    if (!(k in inst)) {
+	inst[k] = $1;
+	env[k] = $2;
+	keys[++nkeys] = k;
+    }
+    runs[file, k]++;
+    if ($4 == "ok" || $4 == "timeout")
+	good[file, k]++;
+    acc(file, k, "time", $5);
+    acc(file, k, "nodes", $6);
+    acc(file, k, "iters", $7);
+    acc(file, k, "rss", $8);
+    acc(file, k, "gap", $9);
+}
+END {
+    printf("%-10s %-7s %-14s %14s %14s\n",
+	   "instance", "env", "measure", "baseline", "current");
+    regressions = 0;
+    for (i = 1; i <= nkeys; ++i) {
+	k = keys[i];
+	if (runs[1, k] == 0) {
+	    printf("%-10s %-7s not in the baseline\n", inst[k], env[k]);
+	    continue;
+	}
+	if (runs[2, k] == 0) {
+	    printf("%-10s %-7s not in the current results\n", inst[k], env[k]);
+	    continue;
+	}
+	if (good[2, k] < runs[2, k] && good[1, k] == runs[1, k]) {
+	    printf("%-10s %-7s %d of %d runs failed   REGRESSION\n",
+		   inst[k], env[k], runs[2, k] - good[2, k], runs[2, k]);
+	    regressions++;
+	}
+	cmp(k, "time", "wall_sec", time_rel, time_abs);
+	cmp(k, "rss", "peak_rss_kb", rss_rel, 0);
+	cmp(k, "nodes", "nodes", count_rel, 0);
+	cmp(k, "iters", "lp_iterations", count_rel, 0);
+	cmp(k, "gap", "gap_pct", 0, gap_abs);
+    }
+    if (regressions > 0) {
+	printf("\n%d regression(s) found\n", regressions);
+	exit 1;
+    }
+    printf("\nNo regression found\n");
+}' "$1" "$2"
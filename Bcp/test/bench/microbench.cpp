@@ -0,0 +1,514 @@
+// Copyright (C) 2006, International Business Machines
+// Corporation and others.  All Rights Reserved.
+
+// Microbenchmarks of the data structures BCP uses at every search tree node:
+// message buffers, BCP_vec, the memory pool of the search tree nodes, object
+// set changes, warmstart bases and node descriptions. Each benchmark prints
+// the CPU time per operation, so the figures can be compared before and
+// after a change in these routines.
+//
+// Usage: bcp_microbench [scale [name ...]]
+//   scale multiplies the number of repetitions (default 1),
+//   the names select the benchmarks to run (default: all of them).
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include "CoinTime.hpp"
+#include "CoinWarmStartBasis.hpp"
+
+#include "BCP_error.hpp"
+#include "BCP_string.hpp"
+#include "BCP_vector.hpp"
+#include "BCP_buffer.hpp"
+#include "BCP_mempool.hpp"
+#include "BCP_obj_change.hpp"
+#include "BCP_node_change.hpp"
+#include "BCP_warmstart_basis.hpp"
+#include "BCP_USER.hpp"
+
+//#############################################################################
+
+static int scale = 1;
+// Every benchmark adds something to it, so that the work can not be
+// optimized away
+static double checksum = 0;
+
+static void
+report(const char* name, const double start, const int ops)
+{
+    const double t = CoinCpuTime() - start;
+    printf("%-40s %10i ops %10.3f s %12.1f ns/op\n",
+	   name, ops, t, ops > 0 ? t * 1e9 / ops : 0.0);
+}
+
+// A simple linear congruential generator, so that the runs are repeatable
+// on every platform
+static unsigned int rnd_state = 12345;
+static inline int
+rnd(const int n)
+{
+    rnd_state = rnd_state * 1103515245 + 12345;
+    return static_cast<int>((rnd_state >> 8) % n);
+}
+
+// Sorted positions of about every step-th entry in [0,n)
+static void
+sample_positions(BCP_vec<int>& pos, const int n, const int step)
+{
+    pos.clear();
+    for (int i = rnd(step); i < n; i += 1 + rnd(2 * step - 1))
+	pos.push_back(i);
+}
+
+//#############################################################################
+// BCP_buffer
+//#############################################################################
+
+static void
+bench_buffer()
+{
+    const int reps = 200 * scale;
+    const int num = 10000;
+    BCP_buffer buf;
+    int i, k;
+    double start;
+
+    start = CoinCpuTime();
+    for (k = 0; k < reps; ++k) {
+	buf.clear();
+	for (i = 0; i < num; ++i)
+	    buf.pack(i);
+	int x;
+	for (i = 0; i < num; ++i) {
+	    buf.unpack(x);
+	    checksum += x;
+	}
+    }
+    report("buffer: pack/unpack int", start, reps * num);
+
+    start = CoinCpuTime();
+    for (k = 0; k < reps; ++k) {
+	buf.clear();
+	for (i = 0; i < num; ++i)
+	    buf.pack(i * 0.5);
+	double x;
+	for (i = 0; i < num; ++i) {
+	    buf.unpack(x);
+	    checksum += x;
+	}
+    }
+    report("buffer: pack/unpack double", start, reps * num);
+
+    double* darr = new double[num];
+    for (i = 0; i < num; ++i)
+	darr[i] = i;
+    start = CoinCpuTime();
+    for (k = 0; k < reps * 10; ++k) {
+	buf.clear();
+	buf.pack(darr, num);
+	double* x = 0;
+	int len;
+	buf.unpack(x, len);
+	checksum += x[len - 1];
+	delete[] x;
+    }
+    report("buffer: pack/unpack double[10000]", start, reps * 10);
+    delete[] darr;
+
+    const BCP_string str("BCP_VerbosityShutUp 1 // a parameter line");
+    start = CoinCpuTime();
+    for (k = 0; k < reps; ++k) {
+	buf.clear();
+	for (i = 0; i < 1000; ++i)
+	    buf.pack(str);
+	BCP_string x;
+	for (i = 0; i < 1000; ++i) {
+	    buf.unpack(x);
+	    checksum += x.length();
+	}
+    }
+    report("buffer: pack/unpack BCP_string", start, reps * 1000);
+
+    BCP_vec<int> ivec;
+    for (i = 0; i < num; ++i)
+	ivec.push_back(i);
+    start = CoinCpuTime();
+    for (k = 0; k < reps * 10; ++k) {
+	buf.clear();
+	buf.pack(ivec);
+	BCP_vec<int> x;
+	buf.unpack(x);
+	checksum += x.back();
+    }
+    report("buffer: pack/unpack BCP_vec<int>(10000)", start, reps * 10);
+}
+
+//#############################################################################
+// BCP_vec
+//#############################################################################
+
+template <class T> static void
+bench_vec_type(const char* tname)
+{
+    const int reps = 200 * scale;
+    const int num = 10000;
+    char name[100];
+    int i, k;
+    double start;
+
+    BCP_vec<T> v;
+    start = CoinCpuTime();
+    for (k = 0; k < reps; ++k) {
+	v.clear();
+	for (i = 0; i < num; ++i)
+	    v.push_back(static_cast<T>(i));
+	checksum += v.size();
+    }
+    sprintf(name, "vec<%s>: push_back", tname);
+    report(name, start, reps * num);
+
+    BCP_vec<T> orig(v);
+    BCP_vec<int> pos;
+    sample_positions(pos, num, 4);
+
+    start = CoinCpuTime();
+    for (k = 0; k < reps; ++k) {
+	v = orig;
+	v.erase_by_index(pos);
+	checksum += v.size();
+    }
+    sprintf(name, "vec<%s>: erase_by_index (1/4)", tname);
+    report(name, start, reps);
+
+    start = CoinCpuTime();
+    for (k = 0; k < reps; ++k) {
+	v = orig;
+	v.keep_by_index(pos);
+	checksum += v.size();
+    }
+    sprintf(name, "vec<%s>: keep_by_index (1/4)", tname);
+    report(name, start, reps);
+
+    BCP_vec<T> values;
+    for (i = pos.size() - 1; i >= 0; --i)
+	values.push_back(static_cast<T>(i));
+    v = orig;
+    start = CoinCpuTime();
+    for (k = 0; k < reps; ++k) {
+	v.update(pos, values);
+	checksum += static_cast<double>(v[pos[0]]);
+    }
+    sprintf(name, "vec<%s>: update (1/4)", tname);
+    report(name, start, reps);
+}
+
+static void
+bench_vec()
+{
+    bench_vec_type<int>("int");
+    bench_vec_type<double>("double");
+    bench_vec_type<char>("char");
+}
+
+//#############################################################################
+// BCP_MemPool
+//#############################################################################
+
+static void
+bench_mempool()
+{
+    const int reps = 100 * scale;
+    const int num = 10000;
+    const size_t size = 56;
+    void** ptrs = new void*[num];
+    int i, k;
+    double start;
+
+    BCP_MemPool pool(size);
+    start = CoinCpuTime();
+    for (k = 0; k < reps; ++k) {
+	for (i = 0; i < num; ++i)
+	    ptrs[i] = pool.alloc(size);
+	// free them in an order different from the allocation
+	for (i = 0; i < num; i += 2)
+	    pool.free(ptrs[i], size);
+	for (i = 1; i < num; i += 2)
+	    pool.free(ptrs[i], size);
+    }
+    report("mempool: alloc/free", start, reps * num);
+
+    start = CoinCpuTime();
+    for (k = 0; k < reps; ++k) {
+	for (i = 0; i < num; ++i)
+	    ptrs[i] = ::operator new(size);
+	for (i = 0; i < num; i += 2)
+	    ::operator delete(ptrs[i]);
+	for (i = 1; i < num; i += 2)
+	    ::operator delete(ptrs[i]);
+    }
+    report("mempool: operator new/delete (reference)", start, reps * num);
+
+    delete[] ptrs;
+}
+
+//#############################################################################
+// BCP_obj_set_change
+//#############################################################################
+
+// Fill in an explicit object set with num objects
+static void
+make_explicit_set(BCP_obj_set_change& set, const int num)
+{
+    set._storage = BCP_Storage_Explicit;
+    set._deleted_num = 0;
+    set._del_change_pos.clear();
+    set._new_objs.clear();
+    set._change.clear();
+    for (int i = 0; i < num; ++i) {
+	set._new_objs.push_back(i + 1);
+	set._change.push_back(BCP_obj_change(0.0, 1.0, BCP_ObjNotRemovable));
+    }
+}
+
+// Throw if the two explicit object sets differ
+static void
+check_same_set(const BCP_obj_set_change& set0, const BCP_obj_set_change& set1,
+	       const char* what)
+{
+    const int num = set0._new_objs.size();
+    bool same = (set1._new_objs.size() == set0._new_objs.size() &&
+		 set0._change.size() == set0._new_objs.size() &&
+		 set1._change.size() == set1._new_objs.size());
+    for (int i = 0; same && i < num; ++i) {
+	same = (set0._new_objs[i] == set1._new_objs[i] &&
+		set0._change[i] == set1._change[i]);
+    }
+    if (! same)
+	throw BCP_fatal_error("microbench: %s round trip failed\n", what);
+}
+
+static void
+bench_obj_set_change()
+{
+    const int reps = 200 * scale;
+    const int num = 5000;
+    int i, k;
+    double start;
+
+    BCP_obj_set_change old;
+    make_explicit_set(old, num);
+
+    // the child: delete a few, change a few, append a few
+    BCP_obj_set_change cur;
+    BCP_vec<int> del;
+    sample_positions(del, num, 20);
+    cur = old;
+    cur._new_objs.erase_by_index(del);
+    cur._change.erase_by_index(del);
+    const int curnum = cur._change.size();
+    for (i = 0; i < curnum; i += 1 + rnd(20))
+	cur._change[i].ub = 0.0;
+    for (i = 0; i < num / 20; ++i) {
+	cur._new_objs.push_back(num + i + 1);
+	cur._change.push_back(BCP_obj_change(0.0, 1.0, BCP_ObjNotRemovable));
+    }
+
+    BCP_obj_set_change wrtp;
+    start = CoinCpuTime();
+    for (k = 0; k < reps; ++k) {
+	wrtp.set_wrt_parent(old, cur);
+	checksum += wrtp._del_change_pos.size();
+    }
+    report("obj_set_change: diff (5000 objects)", start, reps);
+
+    BCP_obj_set_change res;
+    start = CoinCpuTime();
+    for (k = 0; k < reps; ++k) {
+	res = old;
+	res.update(wrtp);
+	checksum += res.added_num();
+    }
+    report("obj_set_change: apply (5000 objects)", start, reps);
+
+    check_same_set(res, cur, "obj_set_change");
+}
+
+//#############################################################################
+// BCP_warmstart_basis
+//#############################################################################
+
+// An explicit basis with the given stati of the variables and cuts
+static BCP_warmstart_basis*
+make_basis(BCP_vec<char>& vstat, BCP_vec<char>& cstat)
+{
+    return new BCP_warmstart_basis(vstat.begin(), vstat.end(),
+				   cstat.begin(), cstat.end());
+}
+
+// Throw if the two explicit bases differ in any status
+static void
+check_same_basis(const BCP_warmstart* ws0, const BCP_warmstart* ws1,
+		 const char* what)
+{
+    CoinWarmStartBasis* b0 =
+	dynamic_cast<CoinWarmStartBasis*>(ws0->convert_to_CoinWarmStart());
+    CoinWarmStartBasis* b1 =
+	dynamic_cast<CoinWarmStartBasis*>(ws1->convert_to_CoinWarmStart());
+    bool same = (b0 != 0 && b1 != 0 &&
+		 b0->getNumStructural() == b1->getNumStructural() &&
+		 b0->getNumArtificial() == b1->getNumArtificial());
+    int i;
+    for (i = 0; same && i < b0->getNumStructural(); ++i)
+	same = b0->getStructStatus(i) == b1->getStructStatus(i);
+    for (i = 0; same && i < b0->getNumArtificial(); ++i)
+	same = b0->getArtifStatus(i) == b1->getArtifStatus(i);
+    delete b0;
+    delete b1;
+    if (! same)
+	throw BCP_fatal_error("microbench: %s round trip failed\n", what);
+}
+
+static void
+bench_warmstart_basis()
+{
+    const int reps = 200 * scale;
+    const int num = 5000;
+    int i, k;
+    double start;
+
+    BCP_vec<char> vstat, cstat;
+    for (i = 0; i < num; ++i) {
+	vstat.push_back(static_cast<char>(rnd(4)));
+	cstat.push_back(static_cast<char>(rnd(4)));
+    }
+    BCP_warmstart_basis* old_ws = make_basis(vstat, cstat);
+
+    // the child basis: a few cuts are deleted, a few stati change
+    BCP_vec<int> del_vars;
+    BCP_vec<int> del_cuts;
+    sample_positions(del_cuts, num, 20);
+    cstat.erase_by_index(del_cuts);
+    for (i = 0; i < num; i += 1 + rnd(40))
+	vstat[i] = static_cast<char>(rnd(4));
+    for (i = cstat.size() - 1; i >= 0; i -= 1 + rnd(40))
+	cstat[i] = static_cast<char>(rnd(4));
+    BCP_warmstart_basis* new_ws = make_basis(vstat, cstat);
+
+    BCP_warmstart* change = 0;
+    start = CoinCpuTime();
+    for (k = 0; k < reps; ++k) {
+	delete change;
+	change = new_ws->as_change(old_ws, del_vars, del_cuts, 1e-9, 1e-9);
+	checksum += change->storage_size();
+    }
+    report("warmstart_basis: diff (5000+5000)", start, reps);
+
+    BCP_warmstart* res = 0;
+    start = CoinCpuTime();
+    for (k = 0; k < reps; ++k) {
+	delete res;
+	res = old_ws->clone();
+	res->update(change);
+	checksum += res->storage_size();
+    }
+    report("warmstart_basis: update (5000+5000)", start, reps);
+
+    check_same_basis(res, new_ws, "warmstart_basis");
+
+    delete res;
+    delete change;
+    delete new_ws;
+    delete old_ws;
+}
+
+//#############################################################################
+// BCP_node_change
+//#############################################################################
+
+static void
+bench_node_change()
+{
+    const int reps = 200 * scale;
+    const int num = 5000;
+    int i, k;
+    double start;
+
+    BCP_node_change node;
+    make_explicit_set(node.var_change, num);
+    make_explicit_set(node.cut_change, num);
+    BCP_vec<char> vstat, cstat;
+    for (i = 0; i < num; ++i) {
+	vstat.push_back(static_cast<char>(rnd(4)));
+	cstat.push_back(static_cast<char>(rnd(4)));
+    }
+    node.warmstart = make_basis(vstat, cstat);
+
+    BCP_user_pack packer;
+    packer.user_class = 0;
+    BCP_buffer buf;
+    BCP_node_change* copy = 0;
+    start = CoinCpuTime();
+    for (k = 0; k < reps; ++k) {
+	buf.clear();
+	node.pack(&packer, false, buf);
+	delete copy;
+	copy = new BCP_node_change(&packer, false, buf);
+	checksum += copy->var_change.added_num() + copy->cut_change.added_num();
+    }
+    report("node_change: pack/unpack (5000+5000)", start, reps);
+    printf("%-40s %10i bytes\n", "node_change: message size", buf.size());
+
+    check_same_set(copy->var_change, node.var_change, "node_change vars");
+    check_same_set(copy->cut_change, node.cut_change, "node_change cuts");
+    check_same_basis(copy->warmstart, node.warmstart, "node_change warmstart");
+    delete copy;
+}
+
+//#############################################################################
+
+struct BCP_microbench {
+    const char* name;
+    void (*run)();
+};
+
+static const BCP_microbench benchmarks[] = {
+    { "buffer", bench_buffer },
+    { "vec", bench_vec },
+    { "mempool", bench_mempool },
+    { "obj_set_change", bench_obj_set_change },
+    { "warmstart_basis", bench_warmstart_basis },
+    { "node_change", bench_node_change }
+};
+
+int main(int argc, char* argv[])
+{
+    // a failed check must end the run with an exit status, not abort()
+    BCP_fatal_error::abort_on_error = false;
+    if (argc > 1) {
+	scale = atoi(argv[1]);
+	if (scale <= 0) {
+	    printf("Usage: %s [scale [name ...]]\n", argv[0]);
+	    return 1;
+	}
+    }
+    const int num = sizeof(benchmarks) / sizeof(BCP_microbench);
+    try {
+	for (int i = 0; i < num; ++i) {
+	    bool selected = argc <= 2;
+	    for (int j = 2; j < argc; ++j) {
+		if (strcmp(argv[j], benchmarks[i].name) == 0)
+		    selected = true;
+	    }
+	    if (selected)
+		benchmarks[i].run();
+	}
+    }
+    catch (BCP_fatal_error& err) {
+	// the error message has already been printed
+	return 1;
+    }
+    printf("checksum: %g\n", checksum);
+    return 0;
+}
@@ -0,0 +1,162 @@
+#! /bin/sh
+
+# Copyright (C) 2006, International Business Machines
+# Corporation and others.  All Rights Reserved.
+
+# End-to-end benchmark of BCP over the bundled examples and applications.
+#
+# Every instance listed in instances.txt is built (if it has a Makefile),
+# then run a number of times in each requested environment (the serial
+# "single" environment and/or "mpi" under $MPIRUN). For every run one line
+# is written into the result file:
+#
+#   instance env run status wall_sec nodes lp_iterations peak_rss_kb gap_pct
+#
+# status is "ok", "timeout" (BCP_MaxRunTime in bench.par has been hit) or
+# "fail(<exit code>)". A value that can not be determined is printed as NA.
+# The result file can be compared against a stored baseline with
+# compare_bench.sh.
+#
+# Usage: run_bench.sh [-b builddir] [-r runs] [-o resultfile]
+#                     [-e "single mpi"] [instance ...]
+
+benchdir=`cd \`dirname $0\` && pwd`
+builddir=`pwd`
+runs=3
+results=bench_results.tsv
+envs=single
+: ${MPIRUN:=mpirun}
+: ${BENCH_MPI_NP:=3}
+
+usage() {
+    echo "usage: $0 [-b builddir] [-r runs] [-o resultfile] [-e envs] [instance ...]" 1>&2
+    exit 2
+}
+
+while getopts b:r:o:e:h opt; do
+    case $opt in
+	b) builddir=$OPTARG ;;
+	r) runs=$OPTARG ;;
+	o) results=$OPTARG ;;
+	e) envs=$OPTARG ;;
+	*) usage ;;
+    esac
+done
+shift `expr $OPTIND - 1`
+
+builddir=`cd $builddir && pwd` || exit 2
+case $results in
+    /*) ;;
+    *) results=`pwd`/$results ;;
+esac
+logdir=`dirname $results`/bench_logs
+mkdir -p $logdir || exit 2
+
+if test -x /usr/bin/time && /usr/bin/time -f "%e %M" true 2>/dev/null; then
+    gnutime=yes
+else
+    gnutime=no
+fi
+
+# Extract the figures of a finished run from its log into the variables
+# nodes, iters and gap.
+parse_log() {
+    nodes=`sed -n 's/^TM: search tree size: *[0-9]* *( processed *\([0-9]*\) *).*/\1/p' $1 | tail -1`
+    iters=`sed -n 's/^ *LP iterations *: *\([0-9]*\).*/\1/p' $1 | awk '{s += $1} END {if (NR > 0) print s}'`
+    gap=`sed -n 's/^TM: Best lower bound:.*gap: *\([-0-9.e+]*\)%.*/\1/p' $1 | tail -1`
+    if test -z "$gap"; then
+	if grep 'TM: The best solution found has value' $1 >/dev/null; then
+	    gap=0
+	else
+	    gap=NA
+	fi
+    fi
+    test -z "$nodes" && nodes=NA
+    test -z "$iters" && iters=NA
+}
+
+echo "instance	env	run	status	wall_sec	nodes	lp_iterations	peak_rss_kb	gap_pct" > $results
+
+grep -v '^#' $benchdir/instances.txt | grep -v '^ *$' |
+while read name dir exe parfile; do
+    if test $# -gt 0; then
+	case " $* " in
+	    *" $name "*) ;;
+	    *) continue ;;
+	esac
+    fi
+    rundir=$builddir/$dir
+    if test ! -d $rundir; then
+	echo "$name: $rundir does not exist, skipping" 1>&2
+	continue
+    fi
+    if test -f $rundir/Makefile; then
+	echo "$name: building" 1>&2
+	(cd $rundir && ${MAKE:-make} >$logdir/$name.build.log 2>&1) || {
+	    echo "$name: build failed, see $logdir/$name.build.log" 1>&2
+	    continue
+	}
+    fi
+    if test ! -x $rundir/$exe; then
+	echo "$name: $rundir/$exe is not built, skipping" 1>&2
+	continue
+    fi
+    # decompress the input files the parameter file may refer to
+    for gz in $rundir/*.gz; do
+	test -f "$gz" || continue
+	test -f "${gz%.gz}" || gunzip -c "$gz" > "${gz%.gz}"
+    done
+
+    for env in $envs; do
+	par=$logdir/$name.$env.par
+	cat $rundir/$parfile $benchdir/bench.par > $par
+	case $env in
+	    single) cmd="./$exe $par" ;;
+	    mpi)
+		echo "BCP_LpProcessNum `expr $BENCH_MPI_NP - 1`" >> $par
+		cmd="$MPIRUN -np $BENCH_MPI_NP ./$exe $par" ;;
+	    *)
+		echo "unknown environment $env" 1>&2
+		continue ;;
+	esac
+
+	run=1
+	while test $run -le $runs; do
+	    log=$logdir/$name.$env.$run.log
+	    echo "$name: $env run $run" 1>&2
+	    if test $gnutime = yes; then
+		(cd $rundir && /usr/bin/time -f "%e %M" -o $log.time $cmd \
+		    > $log 2>&1)
+		code=$?
+		# GNU time reports a non-zero exit status on a line of its own
+		# before the figures, those are on the last line
+		wall=`tail -1 $log.time | awk '{print $1}'`
+		rss=`tail -1 $log.time | awk '{print $2}'`
+		test -z "$wall" && wall=NA
+		test -z "$rss" && rss=NA
+	    else
+		start=`date +%s`
+		(cd $rundir && $cmd > $log 2>&1)
+		code=$?
+		wall=`expr \`date +%s\` - $start`
+		rss=NA
+	    fi
+	    if grep 'TM: Time has ran out' $log >/dev/null; then
+		status=timeout
+	    elif test $code -ne 0; then
+		status="fail($code)"
+	    else
+		status=ok
+	    fi
+	    # the time and memory of a failed run are not comparable
+	    case $status in
+		fail*) wall=NA; rss=NA ;;
+	    esac
+	    parse_log $log
+	    echo "$name	$env	$run	$status	$wall	$nodes	$iters	$rss	$gap" >> $results
+	    run=`expr $run + 1`
+	done
+    done
+done
+
+echo "Results are in $results, the logs in $logdir" 1>&2